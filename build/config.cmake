@@ -80,6 +80,10 @@ IF (NOT DEFINED ESCARGOT_LIBICU_SUPPORT_WITH_DLOPEN)
     SET (ESCARGOT_LIBICU_SUPPORT_WITH_DLOPEN ON)
 ENDIF()
 
+IF (NOT DEFINED ESCARGOT_REGEXP_COMPILED_MATCHER)
+    SET (ESCARGOT_REGEXP_COMPILED_MATCHER OFF)
+ENDIF()
+
 #######################################################
 # FLAGS FOR ADDITIONAL FUNCTION
 #######################################################
@@ -140,6 +144,10 @@ IF (ESCARGOT_WASM)
     SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_WASM)
 ENDIF()
 
+IF (ESCARGOT_REGEXP_COMPILED_MATCHER)
+    SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_REGEXP_COMPILED_MATCHER)
+ENDIF()
+
 IF (ESCARGOT_THREADING)
     SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_THREADING -DGC_THREAD_ISOLATE)
 ENDIF()
@@ -555,6 +555,16 @@ typedef uint16_t LexicalBlockIndex;
 #define STRING_SUB_STRING_MIN_VIEW_LENGTH 32
 #endif
 
+// sub strings of a string longer than this are tracked for compaction
+#ifndef STRING_VIEW_COMPACTION_MIN_PARENT_LENGTH
+#define STRING_VIEW_COMPACTION_MIN_PARENT_LENGTH (1024 * 64)
+#endif
+
+// views are copied out when they use less than 1/STRING_VIEW_COMPACTION_RATIO of their parent
+#ifndef STRING_VIEW_COMPACTION_RATIO
+#define STRING_VIEW_COMPACTION_RATIO 8
+#endif
+
 #ifndef STRING_BUILDER_INLINE_STORAGE_DEFAULT
 #define STRING_BUILDER_INLINE_STORAGE_DEFAULT 24
 #endif
@@ -563,8 +573,24 @@ typedef uint16_t LexicalBlockIndex;
 #define SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX 1024 * 256
 #endif
 
-#ifndef REGEXP_CACHE_SIZE_MAX
-#define REGEXP_CACHE_SIZE_MAX 64
+// estimated bytes of compiled patterns kept in the VM-wide RegExp cache
+#ifndef REGEXP_CACHE_BYTE_BUDGET
+#define REGEXP_CACHE_BYTE_BUDGET (1024 * 1024)
+#endif
+
+// register files of finished generator and async functions up to this size are reused (see VMInstance::recycleGeneratorRegisterFile)
+#ifndef GENERATOR_REGISTER_FILE_RECYCLE_MAX_SIZE
+#define GENERATOR_REGISTER_FILE_RECYCLE_MAX_SIZE 32
+#endif
+
+// maximum number of register files kept for reuse
+#ifndef GENERATOR_REGISTER_FILE_FREE_LIST_MAX_COUNT
+#define GENERATOR_REGISTER_FILE_FREE_LIST_MAX_COUNT 16
+#endif
+
+// WebAssembly.compile/instantiate compile a module larger than this size on another thread
+#ifndef WASM_ASYNC_COMPILE_THREAD_MIN_SIZE
+#define WASM_ASYNC_COMPILE_THREAD_MIN_SIZE (1024 * 64)
 #endif
 
 // maximum number of tail call arguments allowed
@@ -25,6 +25,7 @@
 #include "parser/CodeBlock.h"
 #include "runtime/Global.h"
 #include "runtime/ThreadLocal.h"
+#include "runtime/StringViewCompactor.h"
 #include "runtime/Context.h"
 #include "runtime/Platform.h"
 #include "runtime/FunctionObject.h"
@@ -67,6 +68,7 @@
 #include "runtime/BigIntObject.h"
 #include "runtime/SharedArrayBufferObject.h"
 #include "runtime/serialization/Serializer.h"
+#include "util/MPSCQueue.h"
 #include "interpreter/ByteCode.h"
 #include "api/internal/ValueAdapter.h"
 #if defined(ENABLE_CODE_CACHE)
@@ -399,6 +401,16 @@ size_t Memory::totalSize()
     return GC_get_total_bytes();
 }
 
+size_t Memory::subStringRetainedSize()
+{
+    return ThreadLocal::stringViewCompactor()->retainedBytes();
+}
+
+size_t Memory::subStringUsedSize()
+{
+    return ThreadLocal::stringViewCompactor()->usedBytes();
+}
+
 void Memory::addGCEventListener(GCEventType type, OnGCEventListener l, void* data)
 {
     GCEventListenerSet& list = ThreadLocal::gcEventListenerSet();
@@ -1213,6 +1225,18 @@ void VMInstanceRef::clearCachesRelatedWithContext()
     toImpl(this)->clearCachesRelatedWithContext();
 }
 
+VMInstanceRef::RegExpCacheStatistics VMInstanceRef::regexpCacheStatistics()
+{
+    RegExpCache* cache = toImpl(this)->regexpCache();
+    RegExpCacheStatistics result = { cache->size(), cache->totalSizeInBytes(), cache->hitCount(), cache->missCount() };
+    return result;
+}
+
+void VMInstanceRef::evictRegExpCache(size_t byteBudget)
+{
+    toImpl(this)->regexpCache()->evictIfNeeded(byteBudget);
+}
+
 #define DECLARE_GLOBAL_SYMBOLS(name)                      \
     SymbolRef* VMInstanceRef::name##Symbol()              \
     {                                                     \
@@ -1292,6 +1316,15 @@ void VMInstanceRef::setCodeCacheShouldLoadFunctionOnScriptLoading(bool s)
 {
     toImpl(this)->codeCache()->setShouldLoadFunctionOnScriptLoading(s);
 }
+
+size_t VMInstanceRef::codeCacheWASMModuleLoadCount()
+{
+#if defined(ENABLE_WASM)
+    return toImpl(this)->codeCache()->wasmModuleLoadCount();
+#else
+    return 0;
+#endif
+}
 #else // ENABLE_CODE_CACHE
 bool VMInstanceRef::isCodeCacheEnabled()
 {
@@ -1333,6 +1366,12 @@ void VMInstanceRef::setCodeCacheShouldLoadFunctionOnScriptLoading(bool s)
     ESCARGOT_LOG_ERROR("If you want to use this function, you should enable code cache");
     RELEASE_ASSERT_NOT_REACHED();
 }
+
+size_t VMInstanceRef::codeCacheWASMModuleLoadCount()
+{
+    ESCARGOT_LOG_ERROR("If you want to use this function, you should enable code cache");
+    RELEASE_ASSERT_NOT_REACHED();
+}
 #endif // ENABLE_CODE_CACHE
 
 #ifdef ESCARGOT_DEBUGGER
@@ -1868,6 +1907,9 @@ void ContextRef::clearRelatedQueuedJobs()
 {
     Context* imp = toImpl(this);
     imp->vmInstance()->jobQueue()->clearJobRelatedWithSpecificContext(imp);
+#if defined(ENABLE_THREADING)
+    imp->vmInstance()->cancelJobsFromAnotherThread(imp);
+#endif
 }
 
 ContextRef* ExecutionStateRef::context()
@@ -3037,6 +3079,21 @@ void FunctionObjectRef::markFunctionNeedsSlowVirtualIdentifierOperation()
     }
 }
 
+FunctionObjectRef::CallSiteCacheStatistics FunctionObjectRef::callSiteCacheStatistics()
+{
+    CallSiteCacheStatistics result = { 0, 0, 0 };
+    FunctionObject* o = toImpl(this);
+    if (o->isScriptFunctionObject()) {
+        ByteCodeBlock* block = o->asScriptFunctionObject()->interpretedCodeBlock()->byteCodeBlock();
+        if (block) {
+            result.hitCount = block->m_callInlineCacheHitCount;
+            result.missCount = block->m_callInlineCacheMissCount;
+            result.inlinedCallCount = block->m_inlinedCallCount;
+        }
+    }
+    return result;
+}
+
 bool FunctionObjectRef::setName(AtomicStringRef* name)
 {
     return toImpl(this)->setName(toImpl(name));
@@ -3178,6 +3235,13 @@ void ContextRef::setSecurityPolicyCheckCallback(SecurityPolicyCheckCallback cb)
                                                  (void*)cb);
 }
 
+ContextRef::ObjectStructureStatistics ContextRef::objectStructureStatistics()
+{
+    const auto& statistics = toImpl(this)->objectStructureStatistics();
+    ObjectStructureStatistics result = { statistics.m_structureCount, statistics.m_transitionCount, statistics.m_byteSize };
+    return result;
+}
+
 StackOverflowDisabler::StackOverflowDisabler(ExecutionStateRef* es)
     : m_executionState(es)
     , m_originStackLimit(ThreadLocal::stackLimit())
@@ -4795,21 +4859,358 @@ bool SerializerRef::serializeInto(ValueRef* value, std::ostringstream& output)
     return Serializer::serializeInto(toImpl(value), output);
 }
 
-ValueRef* SerializerRef::deserializeFrom(ContextRef* context, std::istringstream& input)
+SerializedTransferTableRef* SerializedTransferTableRef::create()
 {
-    std::unique_ptr<SerializedValue> value = Serializer::deserializeFrom(input);
+    return reinterpret_cast<SerializedTransferTableRef*>(new SerializedTransferTable());
+}
 
+void SerializedTransferTableRef::destroy()
+{
+    delete reinterpret_cast<SerializedTransferTable*>(this);
+}
+
+size_t SerializedTransferTableRef::size()
+{
+    return reinterpret_cast<SerializedTransferTable*>(this)->size();
+}
+
+bool SerializerRef::serializeInto(ExecutionStateRef* state, ValueRef* value, std::ostringstream& output, ValueVectorRef* transferList, SerializedTransferTableRef* transferTable)
+{
+    if (transferList) {
+        RELEASE_ASSERT(transferTable);
+        EncodedValueVector* list = toImpl(transferList);
+        ValueVector transferValues;
+        transferValues.resizeWithUninitializedValues(list->size());
+        for (size_t i = 0; i < list->size(); i++) {
+            transferValues[i] = (*list)[i];
+        }
+        return Serializer::serializeInto(*toImpl(state), toImpl(value), output, &transferValues, reinterpret_cast<SerializedTransferTable*>(transferTable));
+    }
+    return Serializer::serializeInto(*toImpl(state), toImpl(value), output);
+}
+
+ValueRef* SerializerRef::deserializeFrom(ContextRef* context, std::istringstream& input, SerializedTransferTableRef* transferTable)
+{
     SandBox sb(toImpl(context));
+    std::pair<std::istringstream*, SerializedTransferTable*> data(&input, reinterpret_cast<SerializedTransferTable*>(transferTable));
     auto result = sb.run([](ExecutionState& state, void* data) -> Value {
-        std::unique_ptr<SerializedValue>* value = (std::unique_ptr<SerializedValue>*)data;
-        return value->get()->toValue(state);
+        auto pair = (std::pair<std::istringstream*, SerializedTransferTable*>*)data;
+        return Serializer::deserializeValueFrom(state, *pair->first, pair->second);
     },
-                         &value);
+                         &data);
 
-    ASSERT(result.error.isEmpty());
+    if (!result.error.isEmpty()) {
+        return nullptr;
+    }
     return toRef(result.result);
 }
 
+ValueRef* SerializerRef::deserializeFrom(ExecutionStateRef* state, std::istringstream& input, SerializedTransferTableRef* transferTable, ValueVectorRef* transferredArrayBuffers)
+{
+    if (transferredArrayBuffers) {
+        ValueVector buffers;
+        Value result = Serializer::deserializeValueFrom(*toImpl(state), input, reinterpret_cast<SerializedTransferTable*>(transferTable), &buffers);
+        transferredArrayBuffers->resize(buffers.size());
+        for (size_t i = 0; i < buffers.size(); i++) {
+            transferredArrayBuffers->set(i, toRef(buffers[i]));
+        }
+        return toRef(result);
+    }
+    return toRef(Serializer::deserializeValueFrom(*toImpl(state), input, reinterpret_cast<SerializedTransferTable*>(transferTable)));
+}
+
+#if defined(ENABLE_THREADING)
+class WorkerPool {
+public:
+    struct Message {
+        std::string m_data;
+        // data blocks of ArrayBuffers transferred with this message
+        std::unique_ptr<SerializedTransferTable> m_transferTable;
+    };
+
+    struct Worker {
+        Worker()
+            : m_instance(nullptr)
+            , m_postedMessageCount(0)
+            , m_handledMessageCount(0)
+            , m_failedMessageCount(0)
+            , m_rejectedMessageCount(0)
+            , m_pendingMessageCount(0)
+        {
+        }
+
+        std::thread m_thread;
+        // serialized messages
+        MPSCQueue<Message> m_queue;
+        // assigned by worker thread before WorkerPool::start returns
+        VMInstance* m_instance;
+        std::atomic_size_t m_postedMessageCount;
+        std::atomic_size_t m_handledMessageCount;
+        std::atomic_size_t m_failedMessageCount;
+        std::atomic_size_t m_rejectedMessageCount;
+        std::atomic_size_t m_pendingMessageCount;
+    };
+
+    WorkerPool(size_t workerCount, size_t maxPendingMessageCount, WorkerPoolRef::WorkerContextCreator contextCreator,
+               WorkerPoolRef::WorkerMessageHandler messageHandler, void* data)
+        : m_maxPendingMessageCount(maxPendingMessageCount)
+        , m_contextCreator(contextCreator)
+        , m_messageHandler(messageHandler)
+        , m_data(data)
+        , m_readyWorkerCount(0)
+        , m_terminating(false)
+    {
+        for (size_t i = 0; i < workerCount; i++) {
+            m_workers.push_back(std::unique_ptr<Worker>(new Worker()));
+        }
+    }
+
+    void start()
+    {
+        for (size_t i = 0; i < m_workers.size(); i++) {
+            m_workers[i]->m_thread = std::thread(&WorkerPool::run, this, i);
+        }
+
+        std::unique_lock<std::mutex> ul(m_mutex);
+        m_condition.wait(ul, [this]() -> bool {
+            return m_readyWorkerCount == m_workers.size();
+        });
+    }
+
+    void terminate()
+    {
+        {
+            // no message is enqueued after this point
+            // workers handle every message enqueued before it and then exit
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_terminating = true;
+        }
+        for (size_t i = 0; i < m_workers.size(); i++) {
+            notify(*m_workers[i]);
+        }
+        for (size_t i = 0; i < m_workers.size(); i++) {
+            m_workers[i]->m_thread.join();
+        }
+    }
+
+    size_t workerCount()
+    {
+        return m_workers.size();
+    }
+
+    bool postMessage(ExecutionStateRef* state, size_t workerIndex, ValueRef* message, ValueVectorRef* transferList)
+    {
+        RELEASE_ASSERT(workerIndex < m_workers.size());
+        Worker& worker = *m_workers[workerIndex];
+        if (UNLIKELY(m_terminating)) {
+            worker.m_rejectedMessageCount.fetch_add(1);
+            return false;
+        }
+
+        // reserve a slot before serialization so that a rejected message never detaches transferred buffers
+        size_t pendingMessageCount = worker.m_pendingMessageCount.fetch_add(1);
+        if (m_maxPendingMessageCount && pendingMessageCount >= m_maxPendingMessageCount) {
+            worker.m_pendingMessageCount.fetch_sub(1);
+            worker.m_rejectedMessageCount.fetch_add(1);
+            return false;
+        }
+
+        std::ostringstream ostream;
+        std::unique_ptr<SerializedTransferTable> transferTable(transferList ? new SerializedTransferTable() : nullptr);
+        bool serialized;
+        try {
+            serialized = SerializerRef::serializeInto(state, message, ostream, transferList, reinterpret_cast<SerializedTransferTableRef*>(transferTable.get()));
+        } catch (...) {
+            // getter threw an exception while serializing
+            worker.m_pendingMessageCount.fetch_sub(1);
+            throw;
+        }
+
+        if (!serialized) {
+            worker.m_pendingMessageCount.fetch_sub(1);
+            return false;
+        }
+
+        Message serializedMessage;
+        serializedMessage.m_data = ostream.str();
+        serializedMessage.m_transferTable = std::move(transferTable);
+
+        // the pool could start terminating while serializing
+        // checking it and enqueueing under the lock guarantees that worker is alive to handle the message
+        std::lock_guard<std::mutex> guard(m_mutex);
+        if (UNLIKELY(m_terminating)) {
+            worker.m_pendingMessageCount.fetch_sub(1);
+            worker.m_rejectedMessageCount.fetch_add(1);
+            return false;
+        }
+        worker.m_queue.enqueue(std::move(serializedMessage));
+        worker.m_postedMessageCount.fetch_add(1);
+        notify(worker);
+        return true;
+    }
+
+    WorkerPoolRef::WorkerMetrics metrics(size_t workerIndex)
+    {
+        RELEASE_ASSERT(workerIndex < m_workers.size());
+        Worker& worker = *m_workers[workerIndex];
+
+        WorkerPoolRef::WorkerMetrics result;
+        result.postedMessageCount = worker.m_postedMessageCount.load();
+        result.handledMessageCount = worker.m_handledMessageCount.load();
+        result.failedMessageCount = worker.m_failedMessageCount.load();
+        result.rejectedMessageCount = worker.m_rejectedMessageCount.load();
+        result.pendingMessageCount = worker.m_pendingMessageCount.load();
+        return result;
+    }
+
+private:
+    void notify(Worker& worker)
+    {
+        // worker checks its queue while holding this mutex before waiting
+        // so locking it here prevents lost wakeup
+        {
+            std::lock_guard<std::mutex> guard(worker.m_instance->asyncWaiterDataMutex());
+        }
+        worker.m_instance->waitEventFromAnotherThreadConditionVariable().notify_all();
+    }
+
+    void run(size_t workerIndex)
+    {
+        Globals::initializeThread();
+
+        Worker& worker = *m_workers[workerIndex];
+        PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create();
+        PersistentRefHolder<ContextRef> context = m_contextCreator(instance.get(), workerIndex, m_data);
+        VMInstance* vmInstance = toImpl(instance.get());
+
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            worker.m_instance = vmInstance;
+            m_readyWorkerCount++;
+        }
+        m_condition.notify_all();
+
+        while (true) {
+            Message message;
+            while (worker.m_queue.dequeue(message)) {
+                handleMessage(context.get(), workerIndex, message);
+                worker.m_pendingMessageCount.fetch_sub(1);
+                worker.m_handledMessageCount.fetch_add(1);
+            }
+
+            if (vmInstance->hasPendingJobFromAnotherThread()) {
+                vmInstance->executePendingJobFromAnotherThread();
+            }
+            while (vmInstance->hasPendingJob()) {
+                // there is no receiver for uncaught errors of jobs
+                instance->executePendingJob();
+            }
+
+            std::unique_lock<std::mutex> ul(vmInstance->asyncWaiterDataMutex());
+            if (worker.m_queue.isEmpty() && !vmInstance->pendingAsyncWaiterCount() && !vmInstance->hasPendingJob()) {
+                if (m_terminating) {
+                    break;
+                }
+                vmInstance->waitEventFromAnotherThreadConditionVariable().wait(ul);
+            }
+        }
+
+        context.release();
+        instance.release();
+
+        Globals::finalizeThread();
+    }
+
+    void handleMessage(ContextRef* context, size_t workerIndex, Message& message)
+    {
+        std::istringstream istream(message.m_data);
+        auto result = Evaluator::execute(context, [](ExecutionStateRef* state, WorkerPool* pool, size_t workerIndex, std::istringstream* istream, SerializedTransferTable* transferTable) -> ValueRef* {
+            // malformed message throws TypeError and is counted as failed
+            ValueRef* value = toRef(Serializer::deserializeValueFrom(*toImpl(state), *istream, transferTable));
+            pool->m_messageHandler(state, workerIndex, value, pool->m_data);
+            return ValueRef::createUndefined();
+        },
+                                         this, workerIndex, &istream, message.m_transferTable.get());
+
+        if (result.error) {
+            m_workers[workerIndex]->m_failedMessageCount.fetch_add(1);
+        }
+    }
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    size_t m_maxPendingMessageCount;
+    WorkerPoolRef::WorkerContextCreator m_contextCreator;
+    WorkerPoolRef::WorkerMessageHandler m_messageHandler;
+    void* m_data;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    size_t m_readyWorkerCount;
+    std::atomic_bool m_terminating;
+};
+
+WorkerPoolRef* WorkerPoolRef::create(size_t workerCount, size_t maxPendingMessageCount,
+                                     WorkerContextCreator contextCreator, WorkerMessageHandler messageHandler, void* data)
+{
+    RELEASE_ASSERT(workerCount && contextCreator && messageHandler);
+    WorkerPool* pool = new WorkerPool(workerCount, maxPendingMessageCount, contextCreator, messageHandler, data);
+    pool->start();
+    return reinterpret_cast<WorkerPoolRef*>(pool);
+}
+
+void WorkerPoolRef::destroy()
+{
+    WorkerPool* pool = reinterpret_cast<WorkerPool*>(this);
+    pool->terminate();
+    delete pool;
+}
+
+size_t WorkerPoolRef::workerCount()
+{
+    return reinterpret_cast<WorkerPool*>(this)->workerCount();
+}
+
+bool WorkerPoolRef::postMessage(ExecutionStateRef* state, size_t workerIndex, ValueRef* message, ValueVectorRef* transferList)
+{
+    return reinterpret_cast<WorkerPool*>(this)->postMessage(state, workerIndex, message, transferList);
+}
+
+WorkerPoolRef::WorkerMetrics WorkerPoolRef::metrics(size_t workerIndex)
+{
+    return reinterpret_cast<WorkerPool*>(this)->metrics(workerIndex);
+}
+#else
+WorkerPoolRef* WorkerPoolRef::create(size_t workerCount, size_t maxPendingMessageCount,
+                                     WorkerContextCreator contextCreator, WorkerMessageHandler messageHandler, void* data)
+{
+    RELEASE_ASSERT_NOT_REACHED();
+    return nullptr;
+}
+
+void WorkerPoolRef::destroy()
+{
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+size_t WorkerPoolRef::workerCount()
+{
+    RELEASE_ASSERT_NOT_REACHED();
+    return 0;
+}
+
+bool WorkerPoolRef::postMessage(ExecutionStateRef* state, size_t workerIndex, ValueRef* message, ValueVectorRef* transferList)
+{
+    RELEASE_ASSERT_NOT_REACHED();
+    return false;
+}
+
+WorkerPoolRef::WorkerMetrics WorkerPoolRef::metrics(size_t workerIndex)
+{
+    RELEASE_ASSERT_NOT_REACHED();
+    return WorkerPoolRef::WorkerMetrics();
+}
+#endif
+
 bool WASMOperationsRef::isWASMOperationsEnabled()
 {
 #if defined(ENABLE_WASM)
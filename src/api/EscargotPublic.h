@@ -172,6 +172,12 @@ public:
     static size_t heapSize(); // Return the number of bytes in the heap.  Excludes bdwgc private data structures. Excludes the unmapped memory
     static size_t totalSize(); // Return the total number of bytes allocated in this process
 
+    // Sub strings of a large string keep the whole string alive
+    // GC copies out small sub strings once nothing else refers to the large string, so that it can be freed
+    // These return bytes of large strings still referred from elsewhere and bytes their sub strings refer to, measured at the last GC
+    static size_t subStringRetainedSize();
+    static size_t subStringUsedSize();
+
     enum GCEventType {
         MARK_START,
         MARK_END,
@@ -703,6 +709,19 @@ public:
     // you can call this function if you don't want to use every alive contexts
     void clearCachesRelatedWithContext();
 
+    struct RegExpCacheStatistics {
+        size_t entryCount;
+        // estimated size of compiled patterns in the cache
+        size_t byteSize;
+        // lookups of compiled pattern by source and flags
+        size_t hitCount;
+        size_t missCount;
+    };
+    RegExpCacheStatistics regexpCacheStatistics();
+    // drops least recently used compiled patterns until the cache fits in byteBudget
+    // GC does the same with REGEXP_CACHE_BYTE_BUDGET
+    void evictRegExpCache(size_t byteBudget);
+
     SymbolRef* toStringTagSymbol();
     SymbolRef* iteratorSymbol();
     SymbolRef* unscopablesSymbol();
@@ -734,6 +753,8 @@ public:
     void setCodeCacheMaxCacheCount(size_t s);
     bool codeCacheShouldLoadFunctionOnScriptLoading();
     void setCodeCacheShouldLoadFunctionOnScriptLoading(bool s);
+    // number of WebAssembly modules loaded from code cache (zero without WebAssembly)
+    size_t codeCacheWASMModuleLoadCount();
 };
 
 class ESCARGOT_EXPORT DebuggerOperationsRef {
@@ -886,6 +907,7 @@ class ESCARGOT_EXPORT ContextRef {
 public:
     static PersistentRefHolder<ContextRef> create(VMInstanceRef* vmInstance);
 
+    // drop queued jobs of this context, and cancel its works running on another thread
     void clearRelatedQueuedJobs();
 
     VMInstanceRef* vmInstance();
@@ -920,6 +942,15 @@ public:
     VirtualIdentifierCallback virtualIdentifierCallback();
 
     void setSecurityPolicyCheckCallback(SecurityPolicyCheckCallback cb);
+
+    struct ObjectStructureStatistics {
+        size_t structureCount;
+        size_t transitionCount;
+        size_t byteSize;
+    };
+    // returns counts of object structures created by adding properties to objects of this context
+    // counts only grow. structures freed by GC are not subtracted
+    ObjectStructureStatistics objectStructureStatistics();
 };
 
 // AtomicStringRef is never deleted by gc until VMInstance destroyed
@@ -1595,6 +1626,17 @@ public:
     bool isConstructor();
     void markFunctionNeedsSlowVirtualIdentifierOperation();
 
+    struct CallSiteCacheStatistics {
+        size_t hitCount;
+        size_t missCount;
+        // hits which evaluated the callee body at call-site instead of calling it
+        size_t inlinedCallCount;
+    };
+    // returns hit/miss counts of call-site inline caches of calls made inside this function
+    // counts are zero for native function or function not yet executed, and reset when its bytecode is released
+    // refilling a cache emptied by GC is counted as miss
+    CallSiteCacheStatistics callSiteCacheStatistics();
+
     // set function name is allowed only for native function or dynamically created function except class constructor
     bool setName(AtomicStringRef* name);
 };
@@ -2081,11 +2123,68 @@ public:
     OptionalRef<FunctionTemplateRef> parent();
 };
 
+// out-of-band storage for data blocks of ArrayBuffers transferred by SerializerRef
+// serialized stream only has indexes into this table, so the stream should be deserialized with the same table
+// each data block is adopted once, and blocks which were never adopted are freed when the table is destroyed
+class ESCARGOT_EXPORT SerializedTransferTableRef {
+public:
+    static SerializedTransferTableRef* create();
+    void destroy();
+    size_t size();
+};
+
 class ESCARGOT_EXPORT SerializerRef {
 public:
     // returns the serialization was successful
     static bool serializeInto(ValueRef* value, std::ostringstream& output);
-    static ValueRef* deserializeFrom(ContextRef* context, std::istringstream& input);
+    // structured clone version which can serialize objects too
+    // ArrayBuffers in transferList are detached and their data blocks are moved into transferTable
+    // transferTable is required if transferList is given
+    static bool serializeInto(ExecutionStateRef* state, ValueRef* value, std::ostringstream& output,
+                              ValueVectorRef* transferList = nullptr, SerializedTransferTableRef* transferTable = nullptr);
+    // transferred ArrayBuffers are left detached if transferTable is not given
+    // returns nullptr if input is malformed
+    static ValueRef* deserializeFrom(ContextRef* context, std::istringstream& input, SerializedTransferTableRef* transferTable = nullptr);
+    // throws TypeError if input is malformed
+    // if transferredArrayBuffers is given, it is filled with an ArrayBuffer for each entry of transferTable in transferList order
+    // so that ArrayBuffers which are not reachable from the value are not lost
+    static ValueRef* deserializeFrom(ExecutionStateRef* state, std::istringstream& input, SerializedTransferTableRef* transferTable = nullptr,
+                                     ValueVectorRef* transferredArrayBuffers = nullptr);
+};
+
+// Fixed size pool of worker threads. each worker owns its own VMInstance and Context
+// messages are serialized by sender and delivered through lock-free queue of each worker
+// worker runs received messages and pending jobs of its VMInstance in its own job loop
+// available only when threading is enabled (see Globals::supportsThreading)
+class ESCARGOT_EXPORT WorkerPoolRef {
+public:
+    struct WorkerMetrics {
+        size_t postedMessageCount;
+        size_t handledMessageCount;
+        size_t failedMessageCount; // message handler threw an exception
+        size_t rejectedMessageCount; // by backpressure or termination
+        size_t pendingMessageCount;
+    };
+
+    // called on each worker thread after VMInstance creation. should return a new Context for worker
+    // returned Context is kept alive until the pool is destroyed
+    typedef PersistentRefHolder<ContextRef> (*WorkerContextCreator)(VMInstanceRef* instance, size_t workerIndex, void* data);
+    // called on worker thread for each received message
+    typedef void (*WorkerMessageHandler)(ExecutionStateRef* state, size_t workerIndex, ValueRef* message, void* data);
+
+    // maxPendingMessageCount limits messages waiting in each worker (zero means unlimited)
+    // returns after every worker is ready to receive messages
+    static WorkerPoolRef* create(size_t workerCount, size_t maxPendingMessageCount,
+                                 WorkerContextCreator contextCreator, WorkerMessageHandler messageHandler, void* data = nullptr);
+    // waits until every worker handles its pending messages, then terminates workers and frees the pool
+    // should not be called from worker thread
+    void destroy();
+
+    size_t workerCount();
+    // can be called from any thread which has ExecutionStateRef (e.g. main thread or another worker)
+    // returns false if message cannot be serialized, the queue of worker is full or the pool is terminating
+    bool postMessage(ExecutionStateRef* state, size_t workerIndex, ValueRef* message, ValueVectorRef* transferList = nullptr);
+    WorkerMetrics metrics(size_t workerIndex);
 };
 
 class ESCARGOT_EXPORT ScriptParserRef {
@@ -138,6 +138,14 @@ static Object* arraySpeciesCreate(ExecutionState& state, Object* originalArray,
     return Object::construct(state, C, 1, argv).toObject(state);
 }
 
+// Reads O[k] straight from fast-mode storage.
+// Returns false when the generic [[HasProperty]]/[[Get]] steps are needed (see ArrayObject::tryGetFastModeElement).
+// Iteration builtins call this for every index, so a callback that changes the array is noticed on the next step.
+static ALWAYS_INLINE bool getFastModeArrayElement(ExecutionState& state, Object* O, int64_t k, Value& result)
+{
+    return O->isArrayObject() && O->asArrayObject()->tryGetFastModeElement(state, k, result);
+}
+
 // http://ecma-international.org/ecma-262/10.0/#sec-flattenintoarray
 // FlattenIntoArray(target, source, sourceLen, start, depth [ , mapperFunction, thisArg ])
 static int64_t flattenIntoArray(ExecutionState& state, Value target, Value source, int64_t sourceLen, int64_t start, double depth, Value mappedValue = Value(Value::EmptyValue), Value thisArg = Value(Value::EmptyValue))
@@ -574,6 +582,12 @@ static Value builtinArraySplice(ExecutionState& state, Value thisValue, size_t a
     // Let k be 0.
     int64_t k = 0;
 
+    // copy deleted elements at once when both arrays are in fast mode
+    bool canUseFastSplice = O->isArrayObject() && A->isArrayObject() && O->asArrayObject()->isFastModeRangePacked(state, actualStart, len);
+    if (canUseFastSplice && A->asArrayObject()->fastModeCopyElements(state, O->asArrayObject(), actualStart, actualDeleteCount, 0)) {
+        k = actualDeleteCount;
+    }
+
     // Repeat, while k < actualDeleteCount
     while (k < actualDeleteCount) {
         // Let from be ToString(actualStart+k).
@@ -602,6 +616,11 @@ static Value builtinArraySplice(ExecutionState& state, Value thisValue, size_t a
         itemCount = argc - 2;
     }
 
+    // move the tail with memmove and store items directly
+    if (canUseFastSplice && O->asArrayObject()->fastModeSplice(state, actualStart, actualDeleteCount, items, itemCount)) {
+        return A;
+    }
+
     // If itemCount < actualDeleteCount, then
     if (itemCount < actualDeleteCount) {
         // Let k be actualStart.
@@ -707,6 +726,10 @@ static Value builtinArrayConcat(ExecutionState& state, Value thisValue, size_t a
                 // If n + len > 2^53 - 1, throw a TypeError exception.
                 CHECK_ARRAY_LENGTH(n + len > Value::maximumLength());
 
+                if (obj->isArrayObject() && arr->isArrayObject() && obj->asArrayObject()->fastModeCopyElements(state, arr->asArrayObject(), 0, len, n)) {
+                    k = len;
+                }
+
                 // Repeat, while k < len
                 while (k < len) {
                     // Let exists be the result of calling the [[HasProperty]] internal method of E with P.
@@ -752,6 +775,10 @@ static Value builtinArraySlice(ExecutionState& state, Value thisValue, size_t ar
     // Let count be max(final - k, 0).
     // Let A be ArraySpeciesCreate(O, count).
     Object* ArrayObject = arraySpeciesCreate(state, thisObject, std::max(((int64_t)finalEnd - (int64_t)k), (int64_t)0));
+    if (k < finalEnd && thisObject->isArrayObject() && ArrayObject->isArrayObject()
+        && ArrayObject->asArrayObject()->fastModeCopyElements(state, thisObject->asArrayObject(), k, finalEnd - k, 0)) {
+        k = finalEnd;
+    }
     while (k < finalEnd) {
         ObjectHasPropertyResult exists = thisObject->hasIndexedProperty(state, Value(k));
         if (exists) {
@@ -909,9 +936,16 @@ static Value builtinArrayForEach(ExecutionState& state, Value thisValue, size_t
     int64_t k = 0;
     while (k < len) {
         Value Pk = Value(k);
+        Value kValue;
+        if (LIKELY(getFastModeArrayElement(state, thisObject, k, kValue))) {
+            Value args[3] = { kValue, Pk, thisObject };
+            Object::call(state, callbackfn, T, 3, args);
+            k++;
+            continue;
+        }
         auto res = thisObject->hasProperty(state, ObjectPropertyName(state, Pk));
         if (res) {
-            Value kValue = res.value(state, ObjectPropertyName(state, k), thisObject);
+            kValue = res.value(state, ObjectPropertyName(state, k), thisObject);
             Value args[3] = { kValue, Pk, thisObject };
             Object::call(state, callbackfn, T, 3, args);
             k++;
@@ -970,6 +1004,14 @@ static Value builtinArrayIndexOf(ExecutionState& state, Value thisValue, size_t
 
     // Repeat, while k<len
     while (k < len) {
+        Value fastValue;
+        if (LIKELY(getFastModeArrayElement(state, O, k, fastValue))) {
+            if (fastValue.equalsTo(state, argv[0])) {
+                return Value(k);
+            }
+            k++;
+            continue;
+        }
         // Let kPresent be the result of calling the [[HasProperty]] internal method of O with argument ToString(k).
         auto kPresent = O->hasIndexedProperty(state, Value(k));
         // If kPresent is true, then
@@ -1084,6 +1126,15 @@ static Value builtinArrayEvery(ExecutionState& state, Value thisValue, size_t ar
     int64_t k = 0;
 
     while (k < len) {
+        Value kValue;
+        if (LIKELY(getFastModeArrayElement(state, O, k, kValue))) {
+            Value args[] = { kValue, Value(k), O };
+            if (!Object::call(state, callbackfn, T, 3, args).toBoolean()) {
+                return Value(false);
+            }
+            k++;
+            continue;
+        }
         // Let Pk be ToString(k).
         // Let kPresent be the result of calling the [[HasProperty]] internal method of O with argument Pk.
         auto kPresent = O->hasIndexedProperty(state, Value(k));
@@ -1091,7 +1142,7 @@ static Value builtinArrayEvery(ExecutionState& state, Value thisValue, size_t ar
         // If kPresent is true, then
         if (kPresent) {
             // Let kValue be the result of calling the [[Get]] internal method of O with argument Pk.
-            Value kValue = kPresent.value(state, ObjectPropertyName(state, k), O);
+            kValue = kPresent.value(state, ObjectPropertyName(state, k), O);
             // Let testResult be the result of calling the [[Call]] internal method of callbackfn with T as the this value and argument list containing kValue, k, and O.
             Value args[] = { kValue, Value(k), O };
             Value testResult = Object::call(state, callbackfn, T, 3, args);
@@ -1175,13 +1226,20 @@ static Value builtinArrayFilter(ExecutionState& state, Value thisValue, size_t a
     int64_t to = 0;
     // Repeat, while k < len
     while (k < len) {
+        Value kValue;
         // Let Pk be ToString(k).
         // Let kPresent be the result of calling the [[HasProperty]] internal method of O with argument Pk.
-        ObjectHasPropertyResult kPresent = O->hasIndexedProperty(state, Value(k));
+        ObjectHasPropertyResult kPresent;
+        bool isFastModeElement = getFastModeArrayElement(state, O, k, kValue);
+        if (!isFastModeElement) {
+            kPresent = O->hasIndexedProperty(state, Value(k));
+        }
         // If kPresent is true, then
-        if (kPresent) {
+        if (isFastModeElement || kPresent) {
             // Let kValue be the result of calling the [[Get]] internal method of O with argument Pk.
-            Value kValue = kPresent.value(state, ObjectPropertyName(state, k), O);
+            if (!isFastModeElement) {
+                kValue = kPresent.value(state, ObjectPropertyName(state, k), O);
+            }
 
             // Let selected be the result of calling the [[Call]] internal method of callbackfn with T as the this value and argument list containing kValue, k, and O.
             Value v[] = { kValue, Value(k), O };
@@ -1236,14 +1294,21 @@ static Value builtinArrayMap(ExecutionState& state, Value thisValue, size_t argc
 
     // Repeat, while k < len
     while (k < len) {
+        Value kValue;
         // Let Pk be ToString(k).
         // Let kPresent be the result of calling the [[HasProperty]] internal method of O with argument Pk.
-        auto kPresent = O->hasIndexedProperty(state, Value(k));
+        ObjectHasPropertyResult kPresent;
+        bool isFastModeElement = getFastModeArrayElement(state, O, k, kValue);
+        if (!isFastModeElement) {
+            kPresent = O->hasIndexedProperty(state, Value(k));
+        }
         // If kPresent is true, then
-        if (kPresent) {
+        if (isFastModeElement || kPresent) {
             // Let kValue be the result of calling the [[Get]] internal method of O with argument Pk.
             auto Pk = ObjectPropertyName(state, k);
-            Value kValue = kPresent.value(state, Pk, O);
+            if (!isFastModeElement) {
+                kValue = kPresent.value(state, Pk, O);
+            }
             // Let mappedValue be the result of calling the [[Call]] internal method of callbackfn with T as the this value and argument list containing kValue, k, and O.
             Value v[] = { kValue, Value(k), O };
             Value mappedValue = Object::call(state, callbackfn, T, 3, v);
@@ -1285,6 +1350,15 @@ static Value builtinArraySome(ExecutionState& state, Value thisValue, size_t arg
     int64_t k = 0;
     // Repeat, while k < len
     while (k < len) {
+        Value kValue;
+        if (LIKELY(getFastModeArrayElement(state, O, k, kValue))) {
+            Value args[] = { kValue, Value(k), O };
+            if (Object::call(state, callbackfn, T, 3, args).toBoolean()) {
+                return Value(true);
+            }
+            k++;
+            continue;
+        }
         // Let Pk be ToString(k).
         // Let kPresent be the result of calling the [[HasProperty]] internal method of O with argument Pk.
         ObjectHasPropertyResult kPresent = O->hasIndexedProperty(state, Value(k));
@@ -1292,7 +1366,7 @@ static Value builtinArraySome(ExecutionState& state, Value thisValue, size_t arg
         if (kPresent) {
             // Let kValue be the result of calling the [[Get]] internal method of O with argument Pk.
             ObjectPropertyName Pk(state, k);
-            Value kValue = kPresent.value(state, Pk, O);
+            kValue = kPresent.value(state, Pk, O);
             // Let testResult be the result of calling the [[Call]] internal method of callbackfn with T as the this value and argument list containing kValue, k, and O.
             Value argv[] = { kValue, Value(k), O };
             Value testResult = Object::call(state, callbackfn, T, 3, argv);
@@ -1350,7 +1424,10 @@ static Value builtinArrayIncludes(ExecutionState& state, Value thisValue, size_t
     // Repeat, while k < len
     while (doubleK < len) {
         // Let elementK be the result of ? Get(O, ! ToString(k)).
-        Value elementK = O->get(state, ObjectPropertyName(state, Value(Value::DoubleToIntConvertibleTestNeeds, doubleK))).value(state, O);
+        Value elementK;
+        if (!getFastModeArrayElement(state, O, (int64_t)doubleK, elementK)) {
+            elementK = O->get(state, ObjectPropertyName(state, Value(Value::DoubleToIntConvertibleTestNeeds, doubleK))).value(state, O);
+        }
         // If SameValueZero(searchElement, elementK) is true, return true.
         if (elementK.equalsToByTheSameValueZeroAlgorithm(state, searchElement)) {
             return Value(true);
@@ -1451,9 +1528,16 @@ static Value builtinArrayReduce(ExecutionState& state, Value thisValue, size_t a
             ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, state.context()->staticStrings().Array.string(), true, state.context()->staticStrings().reduce.string(), ErrorObject::Messages::GlobalObject_ReduceError);
     }
     while (k < len) { // 9
+        Value kValue;
+        if (LIKELY(getFastModeArrayElement(state, O, k, kValue))) {
+            Value fnargs[] = { accumulator, kValue, Value(k), O };
+            accumulator = Object::call(state, callbackfn, Value(), 4, fnargs);
+            k++;
+            continue;
+        }
         ObjectHasPropertyResult kPresent = O->hasIndexedProperty(state, Value(k)); // 9.b
         if (kPresent) { // 9.c
-            Value kValue = kPresent.value(state, ObjectPropertyName(state, k), O); // 9.c.i
+            kValue = kPresent.value(state, ObjectPropertyName(state, k), O); // 9.c.i
             const int fnargc = 4;
             Value fnargs[] = { accumulator, kValue, Value(k), O };
             accumulator = Object::call(state, callbackfn, Value(), fnargc, fnargs);
@@ -1566,6 +1650,11 @@ static Value builtinArrayPop(ExecutionState& state, Value thisValue, size_t argc
         // Return undefined.
         return Value();
     } else {
+        Value lastElement;
+        if (LIKELY(O->isArrayObject() && O->asArrayObject()->fastModePop(state, lastElement))) {
+            return lastElement;
+        }
+
         // Else, len > 0
         // Let indx be ToString(len–1).
         ObjectPropertyName indx(state, len - 1);
@@ -1593,6 +1682,10 @@ static Value builtinArrayPush(ExecutionState& state, Value thisValue, size_t arg
     // If len + argCount > 2^53 - 1, throw a TypeError exception.
     CHECK_ARRAY_LENGTH((uint64_t)n + argc > Value::maximumLength());
 
+    if (LIKELY(O->isArrayObject() && O->asArrayObject()->fastModePush(state, argv, argc))) {
+        return Value(n + (int64_t)argc);
+    }
+
     // Let items be an internal List whose elements are, in left to right order, the arguments that were passed to this function invocation.
     // Repeat, while items is not empty
     // Remove the first element from items and let E be the value of the element.
@@ -1658,8 +1751,12 @@ static Value builtinArrayShift(ExecutionState& state, Value thisValue, size_t ar
         // Return undefined.
         return Value();
     }
+    Value first;
+    if (LIKELY(O->isArrayObject() && O->asArrayObject()->fastModeShift(state, first))) {
+        return first;
+    }
     // Let first be the result of calling the [[Get]] internal method of O with argument "0".
-    Value first = O->get(state, ObjectPropertyName(state, Value(0))).value(state, O);
+    first = O->get(state, ObjectPropertyName(state, Value(0))).value(state, O);
     // Let k be 1.
     int64_t k = 1;
     // Repeat, while k < len
@@ -1726,6 +1823,10 @@ static Value builtinArrayUnshift(ExecutionState& state, Value thisValue, size_t
         // If len + argCount > 2^53 - 1, throw a TypeError exception.
         CHECK_ARRAY_LENGTH(len + argCount > Value::maximumLength());
 
+        if (LIKELY(O->isArrayObject() && O->asArrayObject()->fastModeUnshift(state, argv, argc))) {
+            return Value(len + argCount);
+        }
+
         // Repeat, while k > 0,
         while (k > 0) {
             // Let from be ToString(k–1).
@@ -1805,7 +1906,10 @@ static Value builtinArrayFind(ExecutionState& state, Value thisValue, size_t arg
     while (k < len) {
         // Let Pk be ! ToString(k).
         // Let kValue be ? Get(O, Pk).
-        Value kValue = O->get(state, ObjectPropertyName(state, Value(k))).value(state, O);
+        Value kValue;
+        if (!getFastModeArrayElement(state, O, k, kValue)) {
+            kValue = O->get(state, ObjectPropertyName(state, Value(k))).value(state, O);
+        }
         // Let testResult be ToBoolean(? Call(predicate, thisArg, « kValue, k, O »)).
         Value v[] = { kValue, Value(k), O };
         bool testResult = Object::call(state, argv[0], thisArg, 3, v).toBoolean();
@@ -1840,7 +1944,10 @@ static Value builtinArrayFindIndex(ExecutionState& state, Value thisValue, size_
     while (k < len) {
         // Let Pk be ! ToString(k).
         // Let kValue be ? Get(O, Pk).
-        Value kValue = O->get(state, ObjectPropertyName(state, Value(k))).value(state, O);
+        Value kValue;
+        if (!getFastModeArrayElement(state, O, k, kValue)) {
+            kValue = O->get(state, ObjectPropertyName(state, Value(k))).value(state, O);
+        }
         // Let testResult be ToBoolean(? Call(predicate, thisArg, « kValue, k, O »)).
         Value v[] = { kValue, Value(k), O };
         bool testResult = Object::call(state, argv[0], thisArg, 3, v).toBoolean();
@@ -2222,8 +2329,9 @@ void GlobalObject::installArray(ExecutionState& state)
     m_arrayIteratorPrototype = new PrototypeObject(state, m_iteratorPrototype);
     m_arrayIteratorPrototype->setGlobalIntrinsicObject(state, true);
 
+    m_arrayIteratorPrototypeNext = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinArrayIteratorNext, 0, NativeFunctionInfo::Strict));
     m_arrayIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                      ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinArrayIteratorNext, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+                                                      ObjectPropertyDescriptor(m_arrayIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
     m_arrayIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->vmInstance()->globalSymbols().toStringTag),
                                                       ObjectPropertyDescriptor(Value(String::fromASCII("Array Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
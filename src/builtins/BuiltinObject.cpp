@@ -24,6 +24,7 @@
 #include "runtime/ArrayObject.h"
 #include "runtime/NativeFunctionObject.h"
 #include "runtime/IteratorObject.h"
+#include "runtime/ObjectKeysCache.h"
 
 namespace Escargot {
 
@@ -563,6 +564,12 @@ static Value builtinObjectAssign(ExecutionState& state, Value thisValue, size_t
         if (!nextSource.isUndefinedOrNull()) {
             // Let from be ! ToObject(nextSource).
             from = nextSource.toObject(state);
+            if (from->canCopyOwnPropertiesByStructure()) {
+                // FAST PATH
+                // keys and values are read by structure iteration
+                to->assignOwnPropertiesByStructure(state, from);
+                continue;
+            }
             // Let keys be ? from.[[OwnPropertyKeys]]().
             keys = from->ownPropertyKeys(state);
         }
@@ -603,6 +610,11 @@ static Value builtinObjectKeys(ExecutionState& state, Value thisValue, size_t ar
 
     // Let obj be ? ToObject(O).
     Object* obj = argv[0].toObject(state);
+    if (obj->isPlainObject() && obj->isInlineCacheable()) {
+        // FAST PATH
+        // own keys of plain object are cached per structure
+        return state.context()->objectKeysCache()->keys(state, obj);
+    }
     // Let nameList be ? EnumerableOwnProperties(obj, "key").
     auto nameList = Object::enumerableOwnProperties(state, obj, EnumerableOwnPropertiesType::Key);
     // Return CreateArrayFromList(nameList).
@@ -81,15 +81,9 @@ static Value builtinRegExpConstructor(ExecutionState& state, Value thisValue, si
     return regexp;
 }
 
-static Value builtinRegExpExec(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
+static Value regExpBuiltinExec(ExecutionState& state, RegExpObject* regexp, String* str, RegexMatchOffsets& offsets)
 {
-    Object* thisObject = thisValue.toObject(state);
-    if (!thisObject->isRegExpObject()) {
-        ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, state.context()->staticStrings().RegExp.string(), true, state.context()->staticStrings().exec.string(), ErrorObject::Messages::GlobalObject_ThisNotRegExpObject);
-    }
-    RegExpObject* regexp = thisObject->asRegExpObject();
     unsigned int option = regexp->option();
-    String* str = argv[0].toString(state);
     uint64_t lastIndex = 0;
     if (option & (RegExpObject::Global | RegExpObject::Sticky)) {
         lastIndex = regexp->computedLastIndex(state);
@@ -102,9 +96,8 @@ static Value builtinRegExpExec(ExecutionState& state, Value thisValue, size_t ar
         regexp->computedLastIndex(state);
     }
 
-    RegexMatchResult result;
-    if (regexp->matchNonGlobally(state, str, result, false, lastIndex)) {
-        int e = result.m_matchResults[0][0].m_end;
+    if (regexp->matchOffsets(state, str, offsets, lastIndex)) {
+        int e = offsets.end(0);
         if (option & RegExpObject::Option::Unicode) {
             char16_t utfRes = (static_cast<size_t>(e) == str->length()) ? 0 : str->charAt(e);
             const char* buf = reinterpret_cast<const char*>(&utfRes);
@@ -121,7 +114,7 @@ static Value builtinRegExpExec(ExecutionState& state, Value thisValue, size_t ar
             regexp->setLastIndex(state, Value(e));
         }
 
-        return regexp->createRegExpMatchedArray(state, result, str);
+        return regexp->createRegExpMatchedArray(state, offsets, str);
     }
 
     if (option & (RegExpObject::Option::Sticky | RegExpObject::Option::Global)) {
@@ -131,11 +124,32 @@ static Value builtinRegExpExec(ExecutionState& state, Value thisValue, size_t ar
     return Value(Value::Null);
 }
 
-static Value regExpExec(ExecutionState& state, Object* R, String* S)
+static Value builtinRegExpExec(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
+{
+    Object* thisObject = thisValue.toObject(state);
+    if (!thisObject->isRegExpObject()) {
+        ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, state.context()->staticStrings().RegExp.string(), true, state.context()->staticStrings().exec.string(), ErrorObject::Messages::GlobalObject_ThisNotRegExpObject);
+    }
+    String* str = argv[0].toString(state);
+    RegexMatchOffsets offsets;
+    return regExpBuiltinExec(state, thisObject->asRegExpObject(), str, offsets);
+}
+
+// When R uses the builtin exec, the offsets of a successful match are left in builtinOffsets
+// so that callers can inspect the match without reading the result array back
+static Value regExpExec(ExecutionState& state, Object* R, String* S, RegexMatchOffsets* builtinOffsets = nullptr)
 {
     ASSERT(R->isObject());
     ASSERT(S->isString());
     Value exec = R->get(state, ObjectPropertyName(state.context()->staticStrings().exec)).value(state, R);
+    if (exec.isPointerValue() && exec.asPointerValue() == state.context()->globalObject()->regexpExecMethod() && R->isRegExpObject()) {
+        if (builtinOffsets) {
+            return regExpBuiltinExec(state, R->asRegExpObject(), S, *builtinOffsets);
+        }
+        RegexMatchOffsets offsets;
+        return regExpBuiltinExec(state, R->asRegExpObject(), S, offsets);
+    }
+
     Value arg[1] = { S };
     if (exec.isCallable()) {
         Value result = Object::call(state, exec, R, 1, arg);
@@ -735,6 +749,7 @@ static Value builtinRegExpInputSetter(ExecutionState& state, Value thisValue, si
         if (!status.isValid()) {                                                                                                            \
             ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, ErrorObject::Messages::String_InvalidStringLength);                 \
         }                                                                                                                                   \
+        status.materializeIfNeeded();                                                                                                       \
         return new StringView(status.name);                                                                                                 \
     }
 
@@ -748,6 +763,7 @@ static Value builtinRegExpInputSetter(ExecutionState& state, Value thisValue, si
         if (!status.isValid()) {                                                                                                                    \
             ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, ErrorObject::Messages::String_InvalidStringLength);                         \
         }                                                                                                                                           \
+        status.materializeIfNeeded();                                                                                                               \
         return (status.dollarCount < number) ? String::emptyString : new StringView(status.dollars[number - 1]);                                    \
     }
 
@@ -772,15 +788,23 @@ std::pair<Value, bool> RegExpStringIteratorObject::advance(ExecutionState& state
     String* s = m_string;
     bool global = m_isGlobal;
     bool unicode = m_isUnicode;
-    Value match = regExpExec(state, r, s);
+    RegexMatchOffsets offsets;
+    Value match = regExpExec(state, r, s, &offsets);
 
     if (match.isNull()) {
         m_isDone = true;
         return std::make_pair(Value(), true);
     }
     if (global) {
-        String* matchStr = match.asObject()->get(state, ObjectPropertyName(state, Value(0))).value(state, match).toString(state);
-        if (matchStr->length() == 0) {
+        bool isEmptyMatch;
+        if (offsets.hasCapture(0)) {
+            // matched by the builtin exec, so the result array doesn't have to be read back
+            isEmptyMatch = offsets.start(0) == offsets.end(0);
+        } else {
+            String* matchStr = match.asObject()->get(state, ObjectPropertyName(state, Value(0))).value(state, match).toString(state);
+            isEmptyMatch = matchStr->length() == 0;
+        }
+        if (isEmptyMatch) {
             //21.2.5.6.8.g.iv.5
             uint64_t thisIndex = r->get(state, ObjectPropertyName(state, state.context()->staticStrings().lastIndex)).value(state, r).toLength(state);
             uint64_t nextIndex = s->advanceStringIndex(thisIndex, unicode);
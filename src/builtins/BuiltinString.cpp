@@ -340,89 +340,114 @@ static Value builtinStringRepeat(ExecutionState& state, Value thisValue, size_t
     return builder.finalize();
 }
 
-static Value stringReplaceFastPathHelper(ExecutionState& state, String* string, String* replaceString, RegexMatchResult& result)
+static bool hasDollarSign(String* replaceString)
 {
-    ASSERT(string && replaceString);
-
-    bool hasDollar = false;
     for (size_t i = 0; i < replaceString->length(); i++) {
         if (replaceString->charAt(i) == '$') {
-            hasDollar = true;
-            break;
+            return true;
         }
     }
+    return false;
+}
 
-    StringBuilder builder;
+// appends the replacement of a single match, match[0] is the whole match and match[1 ... pieceCount - 1] are the captures
+static void appendReplacementFastPath(StringBuilder& builder, String* string, String* replaceString, bool hasDollar, const RegexMatchResult::RegexMatchResultPiece* match, size_t pieceCount)
+{
     if (!hasDollar) {
         // flat replace
-        int32_t matchCount = result.m_matchResults.size();
-        builder.appendSubString(string, 0, result.m_matchResults[0][0].m_start);
-        for (int32_t i = 0; i < matchCount; i++) {
-            String* res = replaceString;
-            builder.appendString(res);
-            if (i < matchCount - 1) {
-                builder.appendSubString(string, result.m_matchResults[i][0].m_end, result.m_matchResults[i + 1][0].m_start);
-            }
-        }
-        builder.appendSubString(string, result.m_matchResults[matchCount - 1][0].m_end, string->length());
-    } else {
-        // dollar replace
-        int32_t matchCount = result.m_matchResults.size();
-        builder.appendSubString(string, 0, result.m_matchResults[0][0].m_start);
-        for (int32_t i = 0; i < matchCount; i++) {
-            for (unsigned j = 0; j < replaceString->length(); j++) {
-                if (replaceString->charAt(j) == '$' && (j + 1) < replaceString->length()) {
-                    char16_t c = replaceString->charAt(j + 1);
-                    if (c == '$') {
-                        builder.appendChar(replaceString->charAt(j));
-                    } else if (c == '&') {
-                        builder.appendSubString(string, result.m_matchResults[i][0].m_start, result.m_matchResults[i][0].m_end);
-                    } else if (c == '\'') {
-                        builder.appendSubString(string, result.m_matchResults[i][0].m_end, string->length());
-                    } else if (c == '`') {
-                        builder.appendSubString(string, 0, result.m_matchResults[i][0].m_start);
-                    } else if ('0' <= c && c <= '9') {
-                        size_t idx = c - '0';
-                        bool usePeek = false;
-                        if (j + 2 < replaceString->length()) {
-                            int peek = replaceString->charAt(j + 2) - '0';
-                            if (0 <= peek && peek <= 9) {
-                                idx *= 10;
-                                idx += peek;
-                                usePeek = true;
-                            }
-                        }
-
-                        if (idx < result.m_matchResults[i].size() && idx != 0) {
-                            builder.appendSubString(string, result.m_matchResults[i][idx].m_start, result.m_matchResults[i][idx].m_end);
-                            if (usePeek)
-                                j++;
-                        } else {
-                            idx = c - '0';
-                            if (idx < result.m_matchResults[i].size() && idx != 0) {
-                                builder.appendSubString(string, result.m_matchResults[i][idx].m_start, result.m_matchResults[i][idx].m_end);
-                            } else {
-                                builder.appendChar('$');
-                                builder.appendChar(c);
-                            }
-                        }
+        builder.appendString(replaceString);
+        return;
+    }
+
+    // dollar replace
+    for (unsigned j = 0; j < replaceString->length(); j++) {
+        if (replaceString->charAt(j) == '$' && (j + 1) < replaceString->length()) {
+            char16_t c = replaceString->charAt(j + 1);
+            if (c == '$') {
+                builder.appendChar(replaceString->charAt(j));
+            } else if (c == '&') {
+                builder.appendSubString(string, match[0].m_start, match[0].m_end);
+            } else if (c == '\'') {
+                builder.appendSubString(string, match[0].m_end, string->length());
+            } else if (c == '`') {
+                builder.appendSubString(string, 0, match[0].m_start);
+            } else if ('0' <= c && c <= '9') {
+                size_t idx = c - '0';
+                bool usePeek = false;
+                if (j + 2 < replaceString->length()) {
+                    int peek = replaceString->charAt(j + 2) - '0';
+                    if (0 <= peek && peek <= 9) {
+                        idx *= 10;
+                        idx += peek;
+                        usePeek = true;
+                    }
+                }
+
+                if (idx < pieceCount && idx != 0) {
+                    builder.appendSubString(string, match[idx].m_start, match[idx].m_end);
+                    if (usePeek)
+                        j++;
+                } else {
+                    idx = c - '0';
+                    if (idx < pieceCount && idx != 0) {
+                        builder.appendSubString(string, match[idx].m_start, match[idx].m_end);
                     } else {
                         builder.appendChar('$');
                         builder.appendChar(c);
                     }
-                    j++;
-                } else {
-                    builder.appendChar(replaceString->charAt(j));
                 }
+            } else {
+                builder.appendChar('$');
+                builder.appendChar(c);
             }
-            if (i < matchCount - 1) {
-                builder.appendSubString(string, result.m_matchResults[i][0].m_end, result.m_matchResults[i + 1][0].m_start);
-            }
+            j++;
+        } else {
+            builder.appendChar(replaceString->charAt(j));
+        }
+    }
+}
+
+static Value stringReplaceFastPathHelper(ExecutionState& state, String* string, String* replaceString, RegexMatchResult& result)
+{
+    ASSERT(string && replaceString);
+
+    bool hasDollar = hasDollarSign(replaceString);
+    int32_t matchCount = result.m_matchResults.size();
+
+    StringBuilder builder;
+    builder.appendSubString(string, 0, result.m_matchResults[0][0].m_start);
+    for (int32_t i = 0; i < matchCount; i++) {
+        appendReplacementFastPath(builder, string, replaceString, hasDollar, result.m_matchResults[i].data(), result.m_matchResults[i].size());
+        if (i < matchCount - 1) {
+            builder.appendSubString(string, result.m_matchResults[i][0].m_end, result.m_matchResults[i + 1][0].m_start);
         }
+    }
+    builder.appendSubString(string, result.m_matchResults[matchCount - 1][0].m_end, string->length());
+
+    return builder.finalize(&state);
+}
 
-        builder.appendSubString(string, result.m_matchResults[matchCount - 1][0].m_end, string->length());
+// replaces each match as soon as it is found, reusing a single offsets buffer for the whole string
+static Value stringReplaceWithRegExpFastPath(ExecutionState& state, String* string, RegExpObject* regexp, String* replaceString, bool isGlobal)
+{
+    RegexMatchOffsets offsets;
+    if (!regexp->matchOffsets(state, string, offsets, 0)) {
+        return string;
     }
 
+    bool hasDollar = hasDollarSign(replaceString);
+    StringBuilder builder;
+    size_t previousEnd = 0;
+    do {
+        builder.appendSubString(string, previousEnd, offsets.start(0));
+        appendReplacementFastPath(builder, string, replaceString, hasDollar, offsets.pieces(), offsets.subPatternNum() + 1);
+        previousEnd = offsets.end(0);
+        if (!isGlobal) {
+            break;
+        }
+    } while (regexp->matchOffsets(state, string, offsets, offsets.start(0) == offsets.end(0) ? previousEnd + 1 : previousEnd));
+    builder.appendSubString(string, previousEnd, string->length());
+
     return builder.finalize(&state);
 }
 
@@ -471,6 +496,9 @@ static Value builtinStringReplace(ExecutionState& state, Value thisValue, size_t
             if (isGlobal) {
                 regexp->setLastIndex(state, Value(0));
             }
+            if (!functionalReplace && replaceValue.isString() && !(regexp->option() & RegExpObject::Option::Sticky)) {
+                return stringReplaceWithRegExpFastPath(state, string, regexp, replaceValue.asString(), isGlobal);
+            }
             bool testResult = regexp->matchNonGlobally(state, string, result, false, 0);
             if (testResult) {
                 if (isGlobal) {
@@ -727,8 +755,8 @@ static Value builtinStringSplit(ExecutionState& state, Value thisValue, size_t a
     if (s == 0) {
         bool ret = true;
         if (P->isRegExpObject()) {
-            RegexMatchResult result;
-            ret = P->asRegExpObject()->matchNonGlobally(state, S, result, false, 0);
+            RegexMatchOffsets offsets;
+            ret = P->asRegExpObject()->matchOffsets(state, S, offsets, 0);
         } else {
             Value z = splitMatchUsingStr(S, 0, P->asString());
             if (z.isBoolean()) {
@@ -746,25 +774,25 @@ static Value builtinStringSplit(ExecutionState& state, Value thisValue, size_t a
     // 13
     if (P->isRegExpObject()) {
         RegExpObject* R = P->asRegExpObject();
+        RegexMatchOffsets offsets;
         while (q != s) {
-            RegexMatchResult result;
-            bool ret = R->matchNonGlobally(state, S, result, false, (size_t)q);
+            bool ret = R->matchOffsets(state, S, offsets, (size_t)q);
             if (!ret) {
                 break;
             }
 
-            if ((size_t)result.m_matchResults[0][0].m_end == p) {
+            if ((size_t)offsets.end(0) == p) {
                 q++;
             } else {
-                if (result.m_matchResults[0][0].m_start >= S->length())
+                if (offsets.start(0) >= S->length())
                     break;
 
-                String* T = S->substring(p, result.m_matchResults[0][0].m_start);
+                String* T = S->substring(p, offsets.start(0));
                 A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
                 if (lengthA == lim)
                     return A;
-                p = result.m_matchResults[0][0].m_end;
-                R->pushBackToRegExpMatchedArray(state, A, lengthA, lim, result, S);
+                p = offsets.end(0);
+                R->pushBackToRegExpMatchedArray(state, A, lengthA, lim, offsets, S);
                 if (lengthA == lim)
                     return A;
                 q = p;
@@ -964,7 +992,8 @@ static Value builtinStringToLowerCase(ExecutionState& state, Value thisValue, si
             dest = newStr.data();
         }
 
-        for (size_t i = 0; i < len; i++) {
+        // ASCII prefix is converted in bulk, the rest continues per character
+        for (size_t i = StringKernels::convertASCIICase<false>(from, dest, len); i < len; i++) {
 #if defined(ENABLE_ICU)
             char32_t u2 = u_tolower(from[i]);
 #else
@@ -987,11 +1016,8 @@ static Value builtinStringToLowerCase(ExecutionState& state, Value thisValue, si
     size_t len = str->length();
     UTF16StringData newStr;
     if (str->has8BitContent()) {
-        const LChar* buf = str->characters8();
         newStr.resizeWithUninitializedValues(len);
-        for (size_t i = 0; i < len; i++) {
-            newStr[i] = buf[i];
-        }
+        StringKernels::copyCharacters(newStr.data(), str->characters8(), len);
     } else {
         newStr = UTF16StringData(str->characters16(), len);
     }
@@ -1025,7 +1051,7 @@ static Value builtinStringToUpperCase(ExecutionState& state, Value thisValue, si
         bool fitTo8Bit = true;
         size_t sharpSCount = 0;
         const LChar* buf = str->characters8();
-        for (size_t i = 0; i < len; i++) {
+        for (size_t i = StringKernels::convertASCIICase<true>(buf, newStr.data(), len); i < len; i++) {
             LChar ch = buf[i];
             // U+00B5 and U+00FF are mapped to a character beyond U+00FF
             if (UNLIKELY(ch == 0xB5 || ch == 0xFF)) {
@@ -1072,11 +1098,8 @@ static Value builtinStringToUpperCase(ExecutionState& state, Value thisValue, si
     size_t len = str->length();
     UTF16StringData newStr;
     if (str->has8BitContent()) {
-        const LChar* buf = str->characters8();
         newStr.resizeWithUninitializedValues(len);
-        for (size_t i = 0; i < len; i++) {
-            newStr[i] = buf[i];
-        }
+        StringKernels::copyCharacters(newStr.data(), str->characters8(), len);
     } else
         newStr = UTF16StringData(str->characters16(), len);
     char16_t* buf = newStr.data();
@@ -1831,8 +1854,9 @@ void GlobalObject::installString(ExecutionState& state)
     m_stringIteratorPrototype = new PrototypeObject(state, m_iteratorPrototype);
     m_stringIteratorPrototype->setGlobalIntrinsicObject(state, true);
 
+    m_stringIteratorPrototypeNext = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinStringIteratorNext, 0, NativeFunctionInfo::Strict));
     m_stringIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                       ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinStringIteratorNext, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+                                                       ObjectPropertyDescriptor(m_stringIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_stringIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->vmInstance()->globalSymbols().toStringTag),
                                                        ObjectPropertyDescriptor(Value(String::fromASCII("String Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
@@ -38,6 +38,8 @@
 
 #define CODE_CACHE_FILE_DIR "/Escargot-cache/"
 #define CODE_CACHE_LIST_FILE_NAME "cache_list"
+// function index of WebAssembly module entries, SIZE_MAX is used by global code
+#define CODE_CACHE_WASM_MODULE_INDEX (SIZE_MAX - 1)
 
 namespace Escargot {
 
@@ -75,6 +77,9 @@ CodeCache::CodeCache(const char* baseCacheDir)
     , m_status(Status::NONE)
     , m_minSourceLength(CODE_CACHE_MIN_SOURCE_LENGTH)
     , m_maxCacheCount(CODE_CACHE_MAX_CACHE_COUNT)
+#if defined(ENABLE_WASM)
+    , m_wasmModuleLoadCount(0)
+#endif
 {
     initialize(baseCacheDir);
 }
@@ -206,6 +211,13 @@ bool CodeCache::tryInitCacheList()
         return false;
     }
 
+    // list file written by a build of another entry layout is rejected
+    if (UNLIKELY((size_t)statFile.st_size != sizeof(size_t) * 2 + listSize * sizeof(CodeCacheEntryChunk))) {
+        ESCARGOT_LOG_ERROR("[CodeCache] invalid size of the cache list file %s, clear cache\n", listFilePath.data());
+        fclose(listFile);
+        return false;
+    }
+
     for (size_t i = 0; i < listSize; i++) {
         CodeCacheEntryChunk entryChunk;
         if (UNLIKELY(fread(&entryChunk, sizeof(CodeCacheEntryChunk), 1, listFile) != 1)) {
@@ -517,6 +529,83 @@ bool CodeCache::storeFunctionCache(Context* context, const CodeCacheIndex& cache
     return result;
 }
 
+#if defined(ENABLE_WASM)
+static size_t hashWASMBinary(const uint8_t* binary, size_t length, size_t seed)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL ^ seed;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= binary[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash ? (size_t)hash : 1;
+}
+
+bool CodeCache::loadWASMModuleCache(const uint8_t* binary, size_t binaryLength, std::vector<uint8_t>& artifact)
+{
+    ASSERT(m_enabled && m_status == Status::READY);
+    ASSERT(binaryLength);
+
+    CodeCacheIndex cacheIndex(hashWASMBinary(binary, binaryLength, 0), binaryLength, CODE_CACHE_WASM_MODULE_INDEX);
+    auto result = searchCache(cacheIndex);
+    if (!result.first) {
+        return false;
+    }
+
+    CodeCacheMetaInfo& metaInfo = result.second.m_metaInfos[(size_t)CodeCacheType::CACHE_WASM_MODULE];
+    ASSERT(metaInfo.cacheType == CodeCacheType::CACHE_WASM_MODULE);
+
+    m_status = Status::IN_PROGRESS;
+    m_currentContext.m_cacheFilePath = createCacheFilePath(m_cacheDirPath, cacheIndex);
+    m_currentContext.m_cacheEntry = result.second;
+    m_currentContext.m_cacheFile = fopen(m_currentContext.m_cacheFilePath.data(), "rb");
+    if (UNLIKELY(!m_currentContext.m_cacheFile)) {
+        ESCARGOT_LOG_ERROR("[CodeCache] can't open the cache data file %s\n", m_currentContext.m_cacheFilePath.data());
+        m_status = Status::FAILED;
+    } else if (UNLIKELY(!readCacheData(metaInfo) || !m_cacheReader->loadWASMModule(hashWASMBinary(binary, binaryLength, binaryLength), metaInfo.dataSize, artifact))) {
+        m_status = Status::FAILED;
+    } else {
+        m_status = Status::FINISH;
+    }
+    m_cacheReader->clearBuffer();
+
+    bool loaded = postCacheLoading();
+    if (loaded) {
+        m_wasmModuleLoadCount++;
+#ifndef NDEBUG
+        ESCARGOT_LOG_INFO("[CodeCache] Load WebAssembly module cache Done (size %zu)\n", binaryLength);
+#endif
+    }
+    return loaded;
+}
+
+bool CodeCache::storeWASMModuleCache(const uint8_t* binary, size_t binaryLength, const uint8_t* artifact, size_t artifactLength)
+{
+    ASSERT(m_enabled && m_status == Status::READY);
+    ASSERT(binaryLength && artifactLength);
+
+    CodeCacheIndex cacheIndex(hashWASMBinary(binary, binaryLength, 0), binaryLength, CODE_CACHE_WASM_MODULE_INDEX);
+    if (searchCache(cacheIndex).first) {
+        // already stored
+        return true;
+    }
+
+    prepareCacheWriting(cacheIndex);
+    if (m_status == Status::IN_PROGRESS) {
+        m_cacheWriter->storeWASMModule(hashWASMBinary(binary, binaryLength, binaryLength), artifact, artifactLength);
+        m_status = writeCacheData(CodeCacheType::CACHE_WASM_MODULE) ? Status::FINISH : Status::FAILED;
+    }
+
+    bool stored = postCacheWriting(cacheIndex);
+#ifndef NDEBUG
+    if (stored) {
+        ESCARGOT_LOG_INFO("[CodeCache] Store WebAssembly module cache Done (size %zu)\n", binaryLength);
+    }
+#endif
+    return stored;
+}
+#endif
+
 void CodeCache::prepareCacheLoading(Context* context, const CodeCacheIndex& cacheIndex, const CodeCacheEntry& entry)
 {
     ASSERT(m_enabled && m_status == Status::READY);
@@ -921,7 +1010,7 @@ bool CodeCache::writeCacheList()
 bool CodeCache::writeCacheData(CodeCacheType type, size_t extraCount)
 {
     ASSERT(m_enabled);
-    ASSERT(type == CodeCacheType::CACHE_CODEBLOCK || type == CodeCacheType::CACHE_BYTECODE || type == CodeCacheType::CACHE_STRING);
+    ASSERT(type == CodeCacheType::CACHE_CODEBLOCK || type == CodeCacheType::CACHE_BYTECODE || type == CodeCacheType::CACHE_STRING || type == CodeCacheType::CACHE_WASM_MODULE);
     ASSERT(!!m_currentContext.m_cacheFilePath.length());
     ASSERT(!!m_currentContext.m_cacheFile);
 
@@ -963,7 +1052,7 @@ bool CodeCache::writeCacheData(CodeCacheType type, size_t extraCount)
 bool CodeCache::readCacheData(CodeCacheMetaInfo& metaInfo)
 {
     ASSERT(m_enabled);
-    ASSERT(metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK || metaInfo.cacheType == CodeCacheType::CACHE_BYTECODE || metaInfo.cacheType == CodeCacheType::CACHE_STRING);
+    ASSERT(metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK || metaInfo.cacheType == CodeCacheType::CACHE_BYTECODE || metaInfo.cacheType == CodeCacheType::CACHE_STRING || metaInfo.cacheType == CodeCacheType::CACHE_WASM_MODULE);
     ASSERT(!!m_currentContext.m_cacheFilePath.length());
     ASSERT(!!m_currentContext.m_cacheFile);
 
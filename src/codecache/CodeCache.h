@@ -63,7 +63,8 @@ enum class CodeCacheType : uint8_t {
     CACHE_CODEBLOCK = 0,
     CACHE_BYTECODE = 1,
     CACHE_STRING = 2,
-    CACHE_INVALID = 3,
+    CACHE_WASM_MODULE = 3,
+    CACHE_INVALID = 4,
     CACHE_TYPE_NUM = CACHE_INVALID
 };
 
@@ -265,6 +266,14 @@ public:
     bool storeGlobalCache(Context* context, const CodeCacheIndex& cacheIndex, InterpretedCodeBlock* topCodeBlock, CodeBlockCacheInfo* codeBlockCacheInfo, Node* programNode, bool inWith);
     bool storeFunctionCache(Context* context, const CodeCacheIndex& cacheIndex, InterpretedCodeBlock* codeBlock, Node* functionNode);
 
+#if defined(ENABLE_WASM)
+    // compiled WebAssembly module artifacts are cached as entries of the same cache list
+    // each entry is keyed by hash and length of its wasm binary
+    bool loadWASMModuleCache(const uint8_t* binary, size_t binaryLength, std::vector<uint8_t>& artifact);
+    bool storeWASMModuleCache(const uint8_t* binary, size_t binaryLength, const uint8_t* artifact, size_t artifactLength);
+    size_t wasmModuleLoadCount() const { return m_wasmModuleLoadCount; }
+#endif
+
     void clear();
 
     size_t minSourceLength();
@@ -294,6 +303,9 @@ private:
 
     size_t m_minSourceLength;
     size_t m_maxCacheCount;
+#if defined(ENABLE_WASM)
+    size_t m_wasmModuleLoadCount; // number of modules loaded from cache
+#endif
 
     void initialize(const char* baseCacheDir);
     bool tryInitCacheDir();
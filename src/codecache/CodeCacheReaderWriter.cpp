@@ -376,6 +376,15 @@ void CodeCacheWriter::storeStringTable()
     }
 }
 
+#if defined(ENABLE_WASM)
+void CodeCacheWriter::storeWASMModule(size_t binaryCheckHash, const uint8_t* artifact, size_t artifactLength)
+{
+    m_buffer.ensureSize(sizeof(size_t));
+    m_buffer.put(binaryCheckHash);
+    m_buffer.putData(artifact, artifactLength);
+}
+#endif
+
 #define STORE_ATOMICSTRING_RELOC(member)                 \
     size_t stringIndex = m_stringTable->add(bc->member); \
     relocInfoVector.push_back(ByteCodeRelocInfo(ByteCodeRelocType::RELOC_ATOMICSTRING, (size_t)currentCode - codeBase, stringIndex));
@@ -595,6 +604,14 @@ void CodeCacheWriter::storeByteCodeStream(ByteCodeBlock* block)
                 STORE_ATOMICSTRING_RELOC(m_propertyName.asAtomicString());
                 break;
             }
+            case CallOpcode: {
+                ASSERT(!static_cast<Call*>(currentCode)->m_inlineCache);
+                break;
+            }
+            case CallWithReceiverOpcode: {
+                ASSERT(!static_cast<CallWithReceiver*>(currentCode)->m_inlineCache);
+                break;
+            }
             case GetGlobalVariableOpcode: {
                 GetGlobalVariable* bc = static_cast<GetGlobalVariable*>(currentCode);
                 ASSERT(!!bc->m_slot);
@@ -958,6 +975,29 @@ CacheStringTable* CodeCacheReader::loadStringTable(Context* context)
     return table;
 }
 
+#if defined(ENABLE_WASM)
+bool CodeCacheReader::loadWASMModule(size_t binaryCheckHash, size_t dataSize, std::vector<uint8_t>& artifact)
+{
+    if (UNLIKELY(dataSize < 2 * sizeof(size_t))) {
+        return false;
+    }
+
+    // check hash rejects another binary of the same hash and length
+    if (UNLIKELY(m_buffer.get<size_t>() != binaryCheckHash)) {
+        return false;
+    }
+
+    size_t length = m_buffer.get<size_t>();
+    if (UNLIKELY(!length || length != dataSize - 2 * sizeof(size_t))) {
+        return false;
+    }
+
+    artifact.resize(length);
+    m_buffer.getData(artifact.data(), length);
+    return true;
+}
+#endif
+
 #define LOAD_ATOMICSTRING_RELOC(member)                              \
     ASSERT(info.relocType == ByteCodeRelocType::RELOC_ATOMICSTRING); \
     size_t stringIndex = info.dataOffset;                            \
@@ -1180,6 +1220,14 @@ void CodeCacheReader::loadByteCodeStream(Context* context, ByteCodeBlock* block)
                 LOAD_ATOMICSTRING_RELOC(m_propertyName);
                 break;
             }
+            case CallOpcode: {
+                ASSERT(!static_cast<Call*>(currentCode)->m_inlineCache);
+                break;
+            }
+            case CallWithReceiverOpcode: {
+                ASSERT(!static_cast<CallWithReceiver*>(currentCode)->m_inlineCache);
+                break;
+            }
             case GetGlobalVariableOpcode: {
                 GetGlobalVariable* bc = static_cast<GetGlobalVariable*>(currentCode);
                 size_t stringIndex = info.dataOffset;
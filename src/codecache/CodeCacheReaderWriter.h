@@ -215,6 +215,9 @@ public:
     void storeInterpretedCodeBlock(InterpretedCodeBlock* codeBlock);
     void storeByteCodeBlock(ByteCodeBlock* block);
     void storeStringTable();
+#if defined(ENABLE_WASM)
+    void storeWASMModule(size_t binaryCheckHash, const uint8_t* artifact, size_t artifactLength);
+#endif
 
 private:
     CacheBuffer m_buffer;
@@ -338,6 +341,9 @@ public:
     InterpretedCodeBlock* loadInterpretedCodeBlock(Context* context, Script* script);
     ByteCodeBlock* loadByteCodeBlock(Context* context, InterpretedCodeBlock* topCodeBlock);
     CacheStringTable* loadStringTable(Context* context);
+#if defined(ENABLE_WASM)
+    bool loadWASMModule(size_t binaryCheckHash, size_t dataSize, std::vector<uint8_t>& artifact);
+#endif
 
 private:
     CacheBuffer m_buffer;
@@ -959,6 +959,7 @@ public:
         Init,
         FillKeyValue,
         DefineGetterSetter,
+        FillSpreadElement,
     };
 
     struct CreateObjectData : public gc {
@@ -969,6 +970,9 @@ public:
         EncodedValueVector m_values;
         Object* m_target;
         CreateObjectPrepare* m_initCode;
+        // structure of source object when spread element is the first property
+        // created object can share it if properties are not changed after spread
+        ObjectStructure* m_spreadSourceStructure;
         CreateObjectData(bool allPrecomputed, bool wasStructureComputed, bool canStoreStructureOnCode,
                          size_t reserveSize, Object* target, CreateObjectPrepare* initCode)
             : m_allPrecomputed(allPrecomputed)
@@ -976,6 +980,7 @@ public:
             , m_canStoreStructureOnCode(canStoreStructureOnCode)
             , m_target(target)
             , m_initCode(initCode)
+            , m_spreadSourceStructure(nullptr)
         {
             if (!wasStructureComputed) {
                 m_properties.reserve(reserveSize);
@@ -1023,6 +1028,20 @@ public:
     {
     }
 
+    CreateObjectPrepare(const ByteCodeLOC& loc, const Stage stage, const size_t dataRegisterIndex, const size_t sourceIndex)
+        : ByteCode(Opcode::CreateObjectPrepareOpcode, loc)
+        , m_stage(stage)
+        , m_allPrecomputed(false)
+        , m_hasPrecomputedKey(false)
+        , m_needsToUpdateFunctionName(false)
+        , m_isGetter(false)
+        , m_dataRegisterIndex(dataRegisterIndex)
+        , m_keyIndex(REGISTER_LIMIT)
+        , m_valueIndex(sourceIndex)
+    {
+        ASSERT(stage == Stage::FillSpreadElement);
+    }
+
     Stage m_stage : 2;
     bool m_allPrecomputed : 1;
     bool m_hasPrecomputedKey : 1;
@@ -1275,6 +1294,7 @@ public:
 #endif
 };
 
+// m_cachedIndex is an index of Object::m_values wherever the values live (see ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
 struct GetObjectInlineCacheData {
     GetObjectInlineCacheData()
     {
@@ -2058,6 +2078,73 @@ public:
 #endif
 };
 
+// body of small function which can be evaluated at call-site without entering the interpreter
+// computed from AST of function while generating its bytecode
+struct InlineableFunctionBody {
+    enum Kind : uint8_t {
+        None,
+        ReturnParameter, // return a
+        ReturnThisProperty, // return this.name
+        ReturnParameterPlus, // return a + b
+        ReturnParameterMinus, // return a - b
+        ReturnParameterMultiply, // return a * b
+    };
+
+    InlineableFunctionBody()
+        : m_kind(None)
+        , m_parameterIndex0(0)
+        , m_parameterIndex1(0)
+    {
+    }
+
+    Kind m_kind;
+    uint16_t m_parameterIndex0;
+    uint16_t m_parameterIndex1;
+    AtomicString m_propertyName;
+};
+
+// monomorphic cache of the last script callee of Call/CallWithReceiver
+// entry of cached callee is selected when the cache is filled (see ScriptFunctionObject::callEntry)
+// so cache hit only guards identity of callee and calls the entry without virtual dispatch
+// after InlineCallThreshold hits, body of small callee is evaluated directly at call-site
+// inlined body never throws; it falls back to normal call when its operands are not handled
+// cache is cleared at every GC start not to keep the callee alive (see ByteCodeBlock::clearCallInlineCaches)
+struct CallInlineCacheData : public gc {
+    typedef Value (*CallEntry)(ScriptFunctionObject* self, ExecutionState& state, const Value& thisValue, const size_t argc, Value* argv);
+
+    CallInlineCacheData()
+        : m_cachedCallee(nullptr)
+        , m_cachedEntry(nullptr)
+        , m_missCount(0)
+        , m_hitCount(0)
+        , m_cachedStructure(nullptr)
+        , m_cachedIndex(0)
+    {
+    }
+
+    static constexpr size_t MaxCacheMissCount = 16;
+    static constexpr size_t InlineCallThreshold = 8;
+    static constexpr size_t CachedIndexMax = std::numeric_limits<uint16_t>::max();
+
+    void clear()
+    {
+        m_cachedCallee = nullptr;
+        m_cachedEntry = nullptr;
+        m_hitCount = 0;
+        m_inlinedBody = InlineableFunctionBody();
+        m_cachedStructure = nullptr;
+    }
+
+    ScriptFunctionObject* m_cachedCallee;
+    CallEntry m_cachedEntry;
+    size_t m_missCount;
+    size_t m_hitCount;
+    InlineableFunctionBody m_inlinedBody;
+    // receiver structure of ReturnThisProperty
+    ObjectStructure* m_cachedStructure;
+    uint16_t m_cachedIndex;
+};
+
 class Call : public ByteCode {
 public:
     Call(const ByteCodeLOC& loc, const size_t calleeIndex, const size_t argumentsStartIndex, const size_t resultIndex, const size_t argumentCount)
@@ -2066,12 +2153,14 @@ public:
         , m_argumentsStartIndex(argumentsStartIndex)
         , m_resultIndex(resultIndex)
         , m_argumentCount(argumentCount)
+        , m_inlineCache(nullptr)
     {
     }
     ByteCodeRegisterIndex m_calleeIndex;
     ByteCodeRegisterIndex m_argumentsStartIndex;
     ByteCodeRegisterIndex m_resultIndex;
     uint16_t m_argumentCount;
+    CallInlineCacheData* m_inlineCache;
 
 #ifndef NDEBUG
     void dump()
@@ -2094,6 +2183,7 @@ public:
         , m_argumentsStartIndex(argumentsStartIndex)
         , m_resultIndex(resultIndex)
         , m_argumentCount(argumentCount)
+        , m_inlineCache(nullptr)
     {
     }
 
@@ -2102,6 +2192,7 @@ public:
     ByteCodeRegisterIndex m_argumentsStartIndex;
     ByteCodeRegisterIndex m_resultIndex;
     uint16_t m_argumentCount;
+    CallInlineCacheData* m_inlineCache;
 
 #ifndef NDEBUG
     void dump()
@@ -3187,6 +3278,7 @@ typedef Vector<JumpFlowRecord, std::allocator<JumpFlowRecord>> ByteCodeJumpFlowR
 
 typedef Vector<String*, GCUtil::gc_malloc_allocator<String*>> ByteCodeStringLiteralData;
 typedef Vector<void*, GCUtil::gc_malloc_allocator<void*>> ByteCodeOtherLiteralData;
+typedef Vector<CallInlineCacheData*, GCUtil::gc_malloc_allocator<CallInlineCacheData*>> ByteCodeCallInlineCacheData;
 
 typedef std::vector<std::pair<size_t, size_t>, std::allocator<std::pair<size_t, size_t>>> ByteCodeLOCData;
 typedef HashMap<ByteCodeBlock*, ByteCodeLOCData*, std::hash<void*>, std::equal_to<void*>, std::allocator<std::pair<ByteCodeBlock* const, ByteCodeLOCData*>>> ByteCodeLOCDataMap;
@@ -3289,10 +3381,18 @@ public:
         siz += m_jumpFlowRecordData.size() * sizeof(JumpFlowRecord);
         siz += m_stringLiteralData.size() * sizeof(intptr_t);
         siz += m_otherLiteralData.size() * sizeof(intptr_t);
+        siz += m_callInlineCacheData.size() * sizeof(intptr_t);
         siz += m_inlineCacheDataSize;
         return siz;
     }
 
+    void clearCallInlineCaches()
+    {
+        for (size_t i = 0; i < m_callInlineCacheData.size(); i++) {
+            m_callInlineCacheData[i]->clear();
+        }
+    }
+
     bool needsExtendedExecutionState() const
     {
         return m_needsExtendedExecutionState;
@@ -3310,6 +3410,11 @@ public:
     // precomputed value of total register number which is "m_requiredTotalRegisterNumber + stack allocated variables size"
     ByteCodeRegisterIndex m_requiredTotalRegisterNumber : REGISTER_INDEX_IN_BIT;
     size_t m_inlineCacheDataSize;
+    // hit/miss counts of call-site inline caches (see CallInlineCacheData)
+    size_t m_callInlineCacheHitCount;
+    size_t m_callInlineCacheMissCount;
+    size_t m_inlinedCallCount;
+    InlineableFunctionBody m_inlineableBody;
 
     ByteCodeBlockData m_code;
     ByteCodeNumeralLiteralData m_numeralLiteralData;
@@ -3319,6 +3424,8 @@ public:
     ByteCodeStringLiteralData m_stringLiteralData;
     // m_otherLiteralData only holds various typed addesses not to be deallocated by GC
     ByteCodeOtherLiteralData m_otherLiteralData;
+    // m_callInlineCacheData holds call-site caches of Call/CallWithReceiver
+    ByteCodeCallInlineCacheData m_callInlineCacheData;
 
     InterpretedCodeBlock* m_codeBlock;
 };
@@ -241,6 +241,94 @@ const uint8_t byteCodeLengths[] = {
 #undef ITER_BYTE_CODE
 };
 
+static bool findInlineableParameterIndex(InterpretedCodeBlock* codeBlock, Node* node, uint16_t& index)
+{
+    if (!node->isIdentifier()) {
+        return false;
+    }
+
+    AtomicString name = node->asIdentifier()->name();
+    const AtomicStringTightVector& parameterNames = codeBlock->parameterNames();
+    size_t found = SIZE_MAX;
+    for (size_t i = 0; i < parameterNames.size(); i++) {
+        if (parameterNames[i] == name) {
+            if (found != SIZE_MAX) {
+                // duplicated parameter name
+                return false;
+            }
+            found = i;
+        }
+    }
+
+    if (found == SIZE_MAX) {
+        return false;
+    }
+    index = found;
+    return true;
+}
+
+// find a small function body like `return this.name` or `return a + b`
+// which can be evaluated at call-site without entering the interpreter (see CallInlineCacheData)
+static void computeInlineableFunctionBody(ByteCodeBlock* block, InterpretedCodeBlock* codeBlock, FunctionNode* ast)
+{
+    if (codeBlock->isArrowFunctionExpression() || codeBlock->isClassConstructor() || codeBlock->isAsyncOrGenerator()
+        || codeBlock->hasEval() || codeBlock->hasWith() || codeBlock->inWith() || codeBlock->usesArgumentsObject()
+        || codeBlock->hasParameterOtherThanIdentifier() || codeBlock->parameterNamesCount() != codeBlock->parameterCount()
+        || codeBlock->needsVirtualIDOperation()) {
+        return;
+    }
+
+#ifdef ESCARGOT_DEBUGGER
+    if (codeBlock->markDebugging()) {
+        return;
+    }
+#endif /* ESCARGOT_DEBUGGER */
+
+    StatementNode* statement = ast->body()->firstChild();
+    if (!statement || statement->nextSibling() || statement->type() != ASTNodeType::ReturnStatement) {
+        return;
+    }
+
+    Node* argument = ((ReturnStatementNode*)statement)->argument();
+    if (!argument) {
+        return;
+    }
+
+    InlineableFunctionBody& body = block->m_inlineableBody;
+    switch (argument->type()) {
+    case ASTNodeType::Identifier: {
+        if (findInlineableParameterIndex(codeBlock, argument, body.m_parameterIndex0)) {
+            body.m_kind = InlineableFunctionBody::ReturnParameter;
+        }
+        break;
+    }
+    case ASTNodeType::MemberExpression: {
+        MemberExpressionNode* member = argument->asMemberExpression();
+        if (member->isPreComputedCase() && !member->isOptional() && !member->isReferencePrivateField()
+            && member->object()->type() == ASTNodeType::ThisExpression) {
+            body.m_propertyName = member->propertyName();
+            body.m_kind = InlineableFunctionBody::ReturnThisProperty;
+        }
+        break;
+    }
+#define CHECK_PARAMETER_BINARY_OPERATION(Name)                                                               \
+    case ASTNodeType::BinaryExpression##Name: {                                                             \
+        BinaryExpression##Name##Node* binary = (BinaryExpression##Name##Node*)argument;                     \
+        if (findInlineableParameterIndex(codeBlock, binary->left(), body.m_parameterIndex0)                 \
+            && findInlineableParameterIndex(codeBlock, binary->right(), body.m_parameterIndex1)) {          \
+            body.m_kind = InlineableFunctionBody::ReturnParameter##Name;                                    \
+        }                                                                                                   \
+        break;                                                                                              \
+    }
+        CHECK_PARAMETER_BINARY_OPERATION(Plus)
+        CHECK_PARAMETER_BINARY_OPERATION(Minus)
+        CHECK_PARAMETER_BINARY_OPERATION(Multiply)
+#undef CHECK_PARAMETER_BINARY_OPERATION
+    default:
+        break;
+    }
+}
+
 ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* context, InterpretedCodeBlock* codeBlock, Node* ast, bool inWithFromRuntime, bool cacheByteCode)
 {
     ASSERT(!codeBlock->byteCodeBlock());
@@ -278,6 +366,10 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* context, Interpreted
     block->m_requiredTotalRegisterNumber = block->m_requiredOperandRegisterNumber + codeBlock->totalStackAllocatedVariableSize() + block->m_numeralLiteralData.size();
     block->m_needsExtendedExecutionState = ctx.m_needsExtendedExecutionState;
 
+    if (ast->type() == ASTNodeType::Function) {
+        computeInlineableFunctionBody(block, codeBlock, (FunctionNode*)ast);
+    }
+
 #if defined(ENABLE_CODE_CACHE)
     // cache bytecode right before relocation
     if (UNLIKELY(cacheByteCode)) {
@@ -453,6 +545,9 @@ void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
             } else if (cd->m_stage == CreateObjectPrepare::FillKeyValue || cd->m_stage == CreateObjectPrepare::DefineGetterSetter) {
                 ASSIGN_STACKINDEX_IF_NEEDED(cd->m_keyIndex, stackBase, stackBaseWillBe, stackVariableSize);
                 ASSIGN_STACKINDEX_IF_NEEDED(cd->m_valueIndex, stackBase, stackBaseWillBe, stackVariableSize);
+            } else {
+                ASSERT(cd->m_stage == CreateObjectPrepare::FillSpreadElement);
+                ASSIGN_STACKINDEX_IF_NEEDED(cd->m_valueIndex, stackBase, stackBaseWillBe, stackVariableSize);
             }
             break;
         }
@@ -35,6 +35,7 @@
 #include "runtime/ErrorObject.h"
 #include "runtime/ArrayObject.h"
 #include "runtime/VMInstance.h"
+#include "runtime/MegamorphicPropertyCache.h"
 #include "runtime/IteratorObject.h"
 #include "runtime/GeneratorObject.h"
 #include "runtime/ModuleNamespaceObject.h"
@@ -156,6 +157,7 @@ public:
 
     static void createObjectOperation(ExecutionState& state, CreateObject* createObject, ByteCodeBlock* byteCodeBlock, Value* registerFile);
     static void createObjectPrepareOperation(ExecutionState& state, CreateObjectPrepare* createObject, ByteCodeBlock* byteCodeBlock, Value* registerFile);
+    static void fillCreateObjectSpreadElement(ExecutionState& state, CreateObjectPrepare::CreateObjectData* data, const Value& source);
     static void createArrayOperation(ExecutionState& state, CreateArray* createArray, ByteCodeBlock* byteCodeBlock, Value* registerFile);
     static void createFunctionOperation(ExecutionState& state, CreateFunction* createFunction, ByteCodeBlock* byteCodeBlock, Value* registerFile);
     static ArrayObject* createRestElementOperation(ExecutionState& state, ByteCodeBlock* byteCodeBlock);
@@ -168,6 +170,9 @@ public:
     static void replaceBlockLexicalEnvironmentOperation(ExecutionState& state, size_t programCounter, ByteCodeBlock* byteCodeBlock);
     static void binaryInOperation(ExecutionState& state, BinaryInOperation* code, Value* registerFile);
     static Value constructOperation(ExecutionState& state, const Value& constructor, const size_t argc, Value* argv);
+    static void updateCallInlineCache(ExecutionState& state, CallInlineCacheData*& inlineCache, PointerValue* callee, ByteCodeBlock* block);
+    static void inlineCachedCallee(CallInlineCacheData* inlineCache);
+    static bool inlinedCallOperation(CallInlineCacheData* inlineCache, const Value& receiver, const size_t argc, Value* argv, Value& result);
     static void callFunctionComplexCase(ExecutionState& state, CallComplexCase* code, Value* registerFile, ByteCodeBlock* byteCodeBlock);
     static void spreadFunctionArguments(ExecutionState& state, const Value* argv, const size_t argc, ValueVector& argVector);
 
@@ -591,6 +596,16 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                             ADD_PROGRAM_COUNTER(GetObject);
                             NEXT_INSTRUCTION();
                         }
+                    } else if (arr->isDoubleModeArray()) {
+                        uint32_t idx = property.tryToUseAsIndexProperty(*state);
+                        if (LIKELY(idx < arr->arrayLength(*state))) {
+                            double d = arr->doubleModeData()[idx];
+                            if (LIKELY(!ArrayObject::isDoubleModeHole(d))) {
+                                registerFile[code->m_storeRegisterIndex] = Value(Value::DoubleToIntConvertibleTestNeeds, d);
+                                ADD_PROGRAM_COUNTER(GetObject);
+                                NEXT_INSTRUCTION();
+                            }
+                        }
                     }
                 } else {
                     registerFile[code->m_storeRegisterIndex] = obj->getIndexedPropertyValue(*state, property, willBeObject);
@@ -609,10 +624,19 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             const Value& property = registerFile[code->m_propertyRegisterIndex];
             if (LIKELY(willBeObject.isObject() && (willBeObject.asPointerValue())->hasArrayObjectTag())) {
                 ArrayObject* arr = willBeObject.asObject()->asArrayObject();
+                const Value& value = registerFile[code->m_loadRegisterIndex];
                 if (LIKELY(arr->isFastModeArray())) {
+                    uint32_t idx = property.tryToUseAsIndexProperty(*state);
+                    // the first double stored into an array of numbers takes the slow case to move elements into double mode storage
+                    if (LIKELY(idx < arr->arrayLength(*state)) && LIKELY(!value.isDouble() || !arr->mayConvertIntoDoubleMode())) {
+                        arr->m_fastModeData[idx] = value;
+                        ADD_PROGRAM_COUNTER(SetObjectOperation);
+                        NEXT_INSTRUCTION();
+                    }
+                } else if (arr->isDoubleModeArray() && value.isNumber()) {
                     uint32_t idx = property.tryToUseAsIndexProperty(*state);
                     if (LIKELY(idx < arr->arrayLength(*state))) {
-                        arr->m_fastModeData[idx] = registerFile[code->m_loadRegisterIndex];
+                        arr->doubleModeData()[idx] = ArrayObject::toDoubleModeElement(value);
                         ADD_PROGRAM_COUNTER(SetObjectOperation);
                         NEXT_INSTRUCTION();
                     }
@@ -759,6 +783,25 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             Call* code = (Call*)programCounter;
             const Value& callee = registerFile[code->m_calleeIndex];
 
+            // cached callee is a script function, so callee-kind checks are not needed on cache hit
+            CallInlineCacheData* inlineCache = code->m_inlineCache;
+            if (LIKELY(inlineCache && callee.isPointerValue() && inlineCache->m_cachedCallee == callee.asPointerValue())) {
+                byteCodeBlock->m_callInlineCacheHitCount++;
+                if (inlineCache->m_inlinedBody.m_kind != InlineableFunctionBody::None) {
+                    if (LIKELY(InterpreterSlowPath::inlinedCallOperation(inlineCache, Value(), code->m_argumentCount, &registerFile[code->m_argumentsStartIndex], registerFile[code->m_resultIndex]))) {
+                        byteCodeBlock->m_inlinedCallCount++;
+                        ADD_PROGRAM_COUNTER(Call);
+                        NEXT_INSTRUCTION();
+                    }
+                } else if (UNLIKELY(++inlineCache->m_hitCount == CallInlineCacheData::InlineCallThreshold)) {
+                    InterpreterSlowPath::inlineCachedCallee(inlineCache);
+                }
+
+                registerFile[code->m_resultIndex] = inlineCache->m_cachedEntry(inlineCache->m_cachedCallee, *state, Value(), code->m_argumentCount, &registerFile[code->m_argumentsStartIndex]);
+                ADD_PROGRAM_COUNTER(Call);
+                NEXT_INSTRUCTION();
+            }
+
             // if PointerValue is not callable, PointerValue::call function throws builtin error
             // https://www.ecma-international.org/ecma-262/6.0/#sec-call
             // If IsCallable(F) is false, throw a TypeError exception.
@@ -766,8 +809,11 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                 ErrorObject::throwBuiltinError(*state, ErrorCode::TypeError, ErrorObject::Messages::NOT_Callable);
             }
 
+            PointerValue* fn = callee.asPointerValue();
+            InterpreterSlowPath::updateCallInlineCache(*state, code->m_inlineCache, fn, byteCodeBlock);
+
             // Return F.[[Call]](V, argumentsList).
-            registerFile[code->m_resultIndex] = callee.asPointerValue()->call(*state, Value(), code->m_argumentCount, &registerFile[code->m_argumentsStartIndex]);
+            registerFile[code->m_resultIndex] = fn->call(*state, Value(), code->m_argumentCount, &registerFile[code->m_argumentsStartIndex]);
 
             ADD_PROGRAM_COUNTER(Call);
             NEXT_INSTRUCTION();
@@ -780,6 +826,25 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             const Value& callee = registerFile[code->m_calleeIndex];
             const Value& receiver = registerFile[code->m_receiverIndex];
 
+            // cached callee is a script function, so callee-kind checks are not needed on cache hit
+            CallInlineCacheData* inlineCache = code->m_inlineCache;
+            if (LIKELY(inlineCache && callee.isPointerValue() && inlineCache->m_cachedCallee == callee.asPointerValue())) {
+                byteCodeBlock->m_callInlineCacheHitCount++;
+                if (inlineCache->m_inlinedBody.m_kind != InlineableFunctionBody::None) {
+                    if (LIKELY(InterpreterSlowPath::inlinedCallOperation(inlineCache, receiver, code->m_argumentCount, &registerFile[code->m_argumentsStartIndex], registerFile[code->m_resultIndex]))) {
+                        byteCodeBlock->m_inlinedCallCount++;
+                        ADD_PROGRAM_COUNTER(CallWithReceiver);
+                        NEXT_INSTRUCTION();
+                    }
+                } else if (UNLIKELY(++inlineCache->m_hitCount == CallInlineCacheData::InlineCallThreshold)) {
+                    InterpreterSlowPath::inlineCachedCallee(inlineCache);
+                }
+
+                registerFile[code->m_resultIndex] = inlineCache->m_cachedEntry(inlineCache->m_cachedCallee, *state, receiver, code->m_argumentCount, &registerFile[code->m_argumentsStartIndex]);
+                ADD_PROGRAM_COUNTER(CallWithReceiver);
+                NEXT_INSTRUCTION();
+            }
+
             // if PointerValue is not callable, PointerValue::call function throws builtin error
             // https://www.ecma-international.org/ecma-262/6.0/#sec-call
             // If IsCallable(F) is false, throw a TypeError exception.
@@ -787,8 +852,11 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                 ErrorObject::throwBuiltinError(*state, ErrorCode::TypeError, ErrorObject::Messages::NOT_Callable);
             }
 
+            PointerValue* fn = callee.asPointerValue();
+            InterpreterSlowPath::updateCallInlineCache(*state, code->m_inlineCache, fn, byteCodeBlock);
+
             // Return F.[[Call]](V, argumentsList).
-            registerFile[code->m_resultIndex] = callee.asPointerValue()->call(*state, receiver, code->m_argumentCount, &registerFile[code->m_argumentsStartIndex]);
+            registerFile[code->m_resultIndex] = fn->call(*state, receiver, code->m_argumentCount, &registerFile[code->m_argumentsStartIndex]);
 
             ADD_PROGRAM_COUNTER(CallWithReceiver);
             NEXT_INSTRUCTION();
@@ -1273,6 +1341,12 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             :
         {
             ThrowOperation* code = (ThrowOperation*)programCounter;
+            if (state->hasRareData() && state->rareData()->m_canHavePendingException) {
+                // return to tryOperation without unwinding the C++ stack
+                state->context()->setPendingException(*state, registerFile[code->m_registerIndex]);
+                state->rareData()->m_hasPendingException = true;
+                return Value(Value::EmptyValue);
+            }
             state->context()->throwException(*state, registerFile[code->m_registerIndex]);
         }
 
@@ -2446,7 +2520,8 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
 
     // cache miss.
     if (code->m_cacheMissCount > GetObjectInlineCacheData::MaxCacheMissCount) {
-        registerFile[code->m_storeRegisterIndex] = obj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
+        // megamorphic site
+        registerFile[code->m_storeRegisterIndex] = state.context()->megamorphicPropertyCache()->get(state, obj, propertyName, receiver);
         return;
     }
 
@@ -2456,6 +2531,12 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
         return;
     }
 
+    if (UNLIKELY(obj->isInDictionaryMode()) && !obj->leaveDictionaryModeIfStable()) {
+        // try again later when the object stops changing
+        registerFile[code->m_storeRegisterIndex] = obj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
+        return;
+    }
+
     if (UNLIKELY(!obj->isInlineCacheable())) {
         code->m_cacheMissCount = GetObjectInlineCacheData::MaxCacheMissCount + 1;
         registerFile[code->m_storeRegisterIndex] = obj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
@@ -2613,7 +2694,7 @@ GiveUp:
     code->m_inlineCacheMode = GetObjectPreComputedCase::None;
     code->m_propertyName = propertyName;
     code->m_cacheMissCount = GetObjectInlineCacheData::MaxCacheMissCount + 1;
-    registerFile[code->m_storeRegisterIndex] = orgObj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
+    registerFile[code->m_storeRegisterIndex] = state.context()->megamorphicPropertyCache()->get(state, orgObj, propertyName, receiver);
 #endif
     // clang-format on
 }
@@ -2697,7 +2778,7 @@ NEVER_INLINE bool InterpreterSlowPath::setObjectPreComputedCaseOperationSlowCase
                 ASSERT(item.m_cachedHiddenClassChainData[cSiz]->findProperty(code->m_propertyName).first == (item.m_cachedHiddenClassChainData[cSiz]->propertyCount() - 1));
                 // next object structure save in `item.m_cachedHiddenClassChainData[cSiz]`
                 originalObject->m_structure = item.m_cachedHiddenClassChainData[cSiz];
-                originalObject->m_values.push_back(value, originalObject->m_structure->propertyCount());
+                originalObject->pushBackPropertyValue(value, originalObject->m_structure->propertyCount());
             }
             return true;
         }
@@ -2736,6 +2817,12 @@ NEVER_INLINE void InterpreterSlowPath::setObjectPreComputedCaseOperationCacheMis
         return;
     }
 
+    if (UNLIKELY(originalObject->isInDictionaryMode()) && !originalObject->leaveDictionaryModeIfStable()) {
+        // try again later when the object stops changing
+        originalObject->setThrowsExceptionWhenStrictMode(state, ObjectPropertyName(state, code->m_propertyName), value, willBeObject);
+        return;
+    }
+
     if (UNLIKELY(!originalObject->isInlineCacheable())) {
         code->m_missCount = SetObjectInlineCacheData::MaxCacheMissCount + 1;
         originalObject->setThrowsExceptionWhenStrictMode(state, ObjectPropertyName(state, code->m_propertyName), value, willBeObject);
@@ -3049,6 +3136,9 @@ NEVER_INLINE void InterpreterSlowPath::createObjectOperation(ExecutionState& sta
             }
             if (cache) {
                 obj->m_structure = cache.value();
+            } else if (data->m_spreadSourceStructure && data->m_spreadSourceStructure->hasSamePropertiesTo(data->m_properties.data(), propertyCount)) {
+                // properties are not changed after spread element
+                obj->m_structure = data->m_spreadSourceStructure;
             } else {
                 obj->m_structure = ObjectStructure::create(state.context(),
                                                            ObjectStructureItemTightVector(data->m_properties.data(), data->m_properties.data() + propertyCount),
@@ -3060,7 +3150,26 @@ NEVER_INLINE void InterpreterSlowPath::createObjectOperation(ExecutionState& sta
                 }
             }
         }
+#if defined(ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+        if (obj->hasVTag(PointerValue::g_inlinePropertyStorageObjectTag)) {
+            InlinePropertyStorageObject* inlineObject = static_cast<InlinePropertyStorageObject*>(obj);
+            size_t valueCount = data->m_values.size();
+            if (LIKELY(valueCount <= inlineObject->inlinePropertyValueCapacity())) {
+                ObjectPropertyValue* inlineStorage = inlineObject->inlinePropertyValueStorage();
+                for (size_t i = 0; i < valueCount; i++) {
+                    inlineStorage[i] = data->m_values[i];
+                }
+                data->m_values.clear();
+            } else {
+                // spread elements added more values than expected
+                inlineObject->movePropertyValuesOut(data->m_values.takeBuffer(), 0);
+            }
+        } else {
+            obj->m_values.reset(data->m_values.takeBuffer());
+        }
+#else
         obj->m_values.reset(data->m_values.takeBuffer());
+#endif
         // reset creation area prevent leak from stack
         memset(data, 0, sizeof(CreateObjectPrepare::CreateObjectData));
     } else {
@@ -3089,6 +3198,61 @@ static Value createObjectPropertyFunctionName(ExecutionState& state, const Value
     return builder.finalize(&state);
 }
 
+// https://tc39.es/ecma262/#sec-copydataproperties
+NEVER_INLINE void InterpreterSlowPath::fillCreateObjectSpreadElement(ExecutionState& state, CreateObjectPrepare::CreateObjectData* data, const Value& source)
+{
+    if (source.isUndefinedOrNull()) {
+        return;
+    }
+
+    ASSERT(!data->m_wasStructureComputed && !data->m_canStoreStructureOnCode);
+    Object* from = source.toObject(state);
+
+    // own keys of source are unique
+    // so duplication check is needed only for properties defined before spread element
+    size_t lastPropertyCount = data->m_properties.size();
+    auto defineDataProperty = [&](const ObjectStructurePropertyName& propertyName, const Value& value) {
+        auto desc = ObjectStructurePropertyDescriptor::createDataDescriptor(ObjectStructurePropertyDescriptor::AllPresent);
+        for (size_t i = 0; i < lastPropertyCount; i++) {
+            if (data->m_properties[i].m_propertyName == propertyName) {
+                data->m_properties[i] = ObjectStructureItem(propertyName, desc);
+                data->m_values[i] = value;
+                return;
+            }
+        }
+        data->m_properties.pushBack(ObjectStructureItem(propertyName, desc));
+        data->m_values.pushBack(value);
+    };
+
+    if (from->canCopyOwnPropertiesByStructure()) {
+        // FAST PATH
+        // read properties by structure iteration without [[OwnPropertyKeys]] and [[Get]]
+        ObjectStructure* structure = from->structure();
+        if (!lastPropertyCount && from->canShareStructureWithCopy()) {
+            data->m_spreadSourceStructure = structure;
+        }
+        size_t propertyCount = structure->propertyCount();
+        const ObjectStructureItem* properties = structure->properties();
+        data->m_properties.reserve(lastPropertyCount + propertyCount);
+        data->m_values.reserve(lastPropertyCount + propertyCount);
+        for (size_t i = 0; i < propertyCount; i++) {
+            if (properties[i].m_descriptor.isEnumerable()) {
+                defineDataProperty(properties[i].m_propertyName, Value(from->m_values[i]));
+            }
+        }
+        return;
+    }
+
+    EnumerateObject* enumObj = new EnumerateObjectWithDestruction(state, from);
+    while (!enumObj->checkLastEnumerateKey(state)) {
+        Value key(enumObj->m_keys[enumObj->m_index++]);
+        ObjectPropertyName propertyName(state, key);
+        Value value = from->get(state, propertyName).value(state, from);
+        defineDataProperty(ObjectStructurePropertyName(state, key), value);
+    }
+    delete enumObj;
+}
+
 NEVER_INLINE void InterpreterSlowPath::createObjectPrepareOperation(ExecutionState& state, CreateObjectPrepare* code, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
     if (code->m_stage == CreateObjectPrepare::Init) {
@@ -3101,15 +3265,18 @@ NEVER_INLINE void InterpreterSlowPath::createObjectPrepareOperation(ExecutionSta
         } else {
             ptr = &registerFile[code->m_dataRegisterIndex];
         }
+        Object* target = Object::tryCreateWithInlinePropertyStorage(state, state.context()->globalObject()->objectPrototype(), code->m_propertyReserveSize);
+        if (!target) {
+            target = new Object(state);
+        }
         CreateObjectPrepare::CreateObjectData* data = new (ptr) CreateObjectPrepare::CreateObjectData(
             code->m_allPrecomputed, code->m_cachedObjectStructure.hasValue(), code->m_allPrecomputed,
-            code->m_propertyReserveSize, new Object(state), code);
+            code->m_propertyReserveSize, target, code);
         registerFile[code->m_objectIndex] = data->m_target;
         if (data->m_wasStructureComputed) {
             data->m_target->m_structure = code->m_cachedObjectStructure.value();
         }
     } else {
-        ASSERT(code->m_stage == CreateObjectPrepare::FillKeyValue || code->m_stage == CreateObjectPrepare::DefineGetterSetter);
         CreateObjectPrepare::CreateObjectData* data;
         if (byteCodeBlock->codeBlock()->isAsyncOrGenerator()) {
             data = reinterpret_cast<CreateObjectPrepare::CreateObjectData*>(registerFile[code->m_dataRegisterIndex].payload());
@@ -3117,6 +3284,13 @@ NEVER_INLINE void InterpreterSlowPath::createObjectPrepareOperation(ExecutionSta
             data = reinterpret_cast<CreateObjectPrepare::CreateObjectData*>(&registerFile[code->m_dataRegisterIndex]);
         }
 
+        if (code->m_stage == CreateObjectPrepare::FillSpreadElement) {
+            fillCreateObjectSpreadElement(state, data, registerFile[code->m_valueIndex]);
+            return;
+        }
+
+        ASSERT(code->m_stage == CreateObjectPrepare::FillKeyValue || code->m_stage == CreateObjectPrepare::DefineGetterSetter);
+
         ObjectStructurePropertyName propertyName;
         if (code->m_hasPrecomputedKey) {
             propertyName = ObjectStructurePropertyName(AtomicString::fromPayload(registerFile[code->m_keyIndex].asString()));
@@ -3304,6 +3478,10 @@ NEVER_INLINE Value InterpreterSlowPath::tryOperation(ExecutionState*& state, siz
     StackTraceDataOnStackVector stackTraceDataVector;
 
     if (LIKELY(!code->m_isCatchResumeProcess && !code->m_isFinallyResumeProcess)) {
+        Optional<Value> thrownValue;
+        // `throw` statements placed directly in the try block leave their exception pending in newState
+        // a try block in generator or async function can be resumed in another tryOperation, so it always uses C++ exception
+        newState->rareData()->m_canHavePendingException = !inPauserScope;
         try {
 #if defined(ENABLE_EXTENDED_API)
             ExecutionStateVariableChanger<void (*)(ExecutionState&, bool)> changer(*state, [](ExecutionState& state, bool in) {
@@ -3313,22 +3491,28 @@ NEVER_INLINE Value InterpreterSlowPath::tryOperation(ExecutionState*& state, siz
 
             size_t newPc = programCounter + sizeof(TryOperation);
             Interpreter::interpret(newState, byteCodeBlock, newPc, registerFile);
-            if (newState->inExecutionStopState()) {
-                return Value();
-            }
-            if (UNLIKELY(isTryResumeProcess && newState->parent()->inExecutionStopState())) {
-                return Value();
-            }
-            clearStack<512>();
-            if (UNLIKELY(isTryResumeProcess)) {
+            if (newState->rareData()->m_hasPendingException) {
+                ASSERT(!inPauserScope);
+                newState->rareData()->m_hasPendingException = false;
+                thrownValue = newState->context()->vmInstance()->currentSandBox()->exception();
+            } else {
+                if (newState->inExecutionStopState()) {
+                    return Value();
+                }
+                if (UNLIKELY(isTryResumeProcess && newState->parent()->inExecutionStopState())) {
+                    return Value();
+                }
+                clearStack<512>();
+                if (UNLIKELY(isTryResumeProcess)) {
 #ifdef ESCARGOT_DEBUGGER
-                Debugger::updateStopState(state->context()->debugger(), newState, ESCARGOT_DEBUGGER_ALWAYS_STOP);
+                    Debugger::updateStopState(state->context()->debugger(), newState, ESCARGOT_DEBUGGER_ALWAYS_STOP);
 #endif /* ESCARGOT_DEBUGGER */
-                state = newState->parent();
-                state->m_programCounter = &programCounter;
-                code = (TryOperation*)(byteCodeBlock->m_code.data() + newState->rareData()->m_programCounterWhenItStoppedByYield);
-                newState = new ExtendedExecutionState(state, state->lexicalEnvironment(), state->inStrictMode()); //
-                newState->rareData()->setControlFlowRecordVector(state->rareData()->controlFlowRecordVector());
+                    state = newState->parent();
+                    state->m_programCounter = &programCounter;
+                    code = (TryOperation*)(byteCodeBlock->m_code.data() + newState->rareData()->m_programCounterWhenItStoppedByYield);
+                    newState = new ExtendedExecutionState(state, state->lexicalEnvironment(), state->inStrictMode()); //
+                    newState->rareData()->setControlFlowRecordVector(state->rareData()->controlFlowRecordVector());
+                }
             }
         } catch (const Value& val) {
             if (UNLIKELY(code->m_isTryResumeProcess)) {
@@ -3341,7 +3525,12 @@ NEVER_INLINE Value InterpreterSlowPath::tryOperation(ExecutionState*& state, siz
                 newState = new ExtendedExecutionState(state, state->lexicalEnvironment(), state->inStrictMode());
                 newState->rareData()->setControlFlowRecordVector(state->rareData()->controlFlowRecordVector());
             }
+            thrownValue = val;
+        }
+        newState->rareData()->m_canHavePendingException = false;
 
+        if (thrownValue) {
+            Value val = thrownValue.value();
             newState->context()->vmInstance()->currentSandBox()->fillStackDataIntoErrorObject(val);
 
 #ifndef NDEBUG
@@ -3962,6 +4151,113 @@ NEVER_INLINE Value InterpreterSlowPath::constructOperation(ExecutionState& state
     return constructor.asPointerValue()->construct(state, argc, argv, constructor.asObject());
 }
 
+NEVER_INLINE void InterpreterSlowPath::updateCallInlineCache(ExecutionState& state, CallInlineCacheData*& inlineCache, PointerValue* callee, ByteCodeBlock* block)
+{
+    block->m_callInlineCacheMissCount++;
+
+    if (UNLIKELY(!inlineCache)) {
+        // create a new cache data
+        inlineCache = new CallInlineCacheData();
+        block->m_inlineCacheDataSize += sizeof(CallInlineCacheData);
+        state.context()->vmInstance()->compiledByteCodeSize() += sizeof(CallInlineCacheData);
+        block->m_callInlineCacheData.push_back(inlineCache);
+    }
+
+    // give up caching for megamorphic call-site
+    if (inlineCache->m_missCount > CallInlineCacheData::MaxCacheMissCount) {
+        return;
+    }
+    // refilling a cache emptied by GC is not counted as miss
+    bool isScriptCallee = callee->isScriptFunctionObject();
+    if (inlineCache->m_cachedCallee || !isScriptCallee) {
+        inlineCache->m_missCount++;
+    }
+
+    inlineCache->clear();
+    // only script functions are cached
+    // native functions have no specialized entry to select
+    if (isScriptCallee) {
+        ScriptFunctionObject* fn = callee->asScriptFunctionObject();
+        inlineCache->m_cachedCallee = fn;
+        inlineCache->m_cachedEntry = fn->callEntry();
+    }
+}
+
+NEVER_INLINE void InterpreterSlowPath::inlineCachedCallee(CallInlineCacheData* inlineCache)
+{
+    ScriptFunctionObject* fn = inlineCache->m_cachedCallee;
+    // callee may have been specialized by its first call after the cache was filled
+    inlineCache->m_cachedEntry = fn->callEntry();
+
+    ByteCodeBlock* calleeBlock = fn->interpretedCodeBlock()->byteCodeBlock();
+    if (calleeBlock) {
+        inlineCache->m_inlinedBody = calleeBlock->m_inlineableBody;
+    }
+}
+
+static ALWAYS_INLINE Value inlinedCallParameter(const size_t argc, Value* argv, const size_t index)
+{
+    return index < argc ? argv[index] : Value();
+}
+
+NEVER_INLINE bool InterpreterSlowPath::inlinedCallOperation(CallInlineCacheData* inlineCache, const Value& receiver, const size_t argc, Value* argv, Value& result)
+{
+    const InlineableFunctionBody& body = inlineCache->m_inlinedBody;
+    switch (body.m_kind) {
+    case InlineableFunctionBody::ReturnParameter: {
+        result = inlinedCallParameter(argc, argv, body.m_parameterIndex0);
+        return true;
+    }
+    case InlineableFunctionBody::ReturnThisProperty: {
+        // primitive or undefined receiver needs this-binding of callee
+        if (!receiver.isObject()) {
+            return false;
+        }
+        Object* obj = receiver.asObject();
+        if (!obj->isInlineCacheable()) {
+            return false;
+        }
+        ObjectStructure* structure = obj->structure();
+        if (inlineCache->m_cachedStructure != structure) {
+            // only own data property is read here. accessor or prototype lookup may throw
+            auto findResult = structure->findProperty(body.m_propertyName);
+            if (findResult.first == SIZE_MAX || findResult.first > CallInlineCacheData::CachedIndexMax
+                || !findResult.second->m_descriptor.isPlainDataProperty()) {
+                return false;
+            }
+            // structures referenced by cache are never modified in place
+            structure->markReferencedByInlineCache();
+            inlineCache->m_cachedStructure = structure;
+            inlineCache->m_cachedIndex = findResult.first;
+        }
+        result = obj->m_values[inlineCache->m_cachedIndex];
+        return true;
+    }
+    case InlineableFunctionBody::ReturnParameterPlus:
+    case InlineableFunctionBody::ReturnParameterMinus:
+    case InlineableFunctionBody::ReturnParameterMultiply: {
+        // non-number operand may call user code through ToPrimitive
+        const Value left = inlinedCallParameter(argc, argv, body.m_parameterIndex0);
+        const Value right = inlinedCallParameter(argc, argv, body.m_parameterIndex1);
+        if (!left.isNumber() || !right.isNumber()) {
+            return false;
+        }
+        double n;
+        if (body.m_kind == InlineableFunctionBody::ReturnParameterPlus) {
+            n = left.asNumber() + right.asNumber();
+        } else if (body.m_kind == InlineableFunctionBody::ReturnParameterMinus) {
+            n = left.asNumber() - right.asNumber();
+        } else {
+            n = left.asNumber() * right.asNumber();
+        }
+        result = Value(Value::DoubleToIntConvertibleTestNeeds, n);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
 static Value callDynamicImportResolved(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
 {
     ExtendedNativeFunctionObject* self = state.resolveCallee()->asExtendedNativeFunctionObject();
@@ -4454,7 +4750,7 @@ NEVER_INLINE void InterpreterSlowPath::objectDefineOwnPropertyWithNameOperation(
     } else {
         const size_t minCacheFillCount = 2;
         if (object->structure() == code->m_inlineCachedStructureBefore) {
-            object->m_values.push_back(v, code->m_inlineCachedStructureAfter->propertyCount());
+            object->pushBackPropertyValue(v, code->m_inlineCachedStructureAfter->propertyCount());
             object->m_structure = code->m_inlineCachedStructureAfter;
         } else if (code->m_missCount > minCacheFillCount) {
             // cache miss
@@ -4586,12 +4882,11 @@ NEVER_INLINE void InterpreterSlowPath::createSpreadArrayObject(ExecutionState& s
     IteratorRecord* iteratorRecord = IteratorObject::getIterator(state, registerFile[code->m_argumentIndex]);
     size_t i = 0;
     while (true) {
-        auto next = IteratorObject::iteratorStep(state, iteratorRecord);
+        auto next = IteratorObject::iteratorStepValue(state, iteratorRecord);
         if (!next.hasValue()) {
             break;
         }
-        Value value = IteratorObject::iteratorValue(state, next.value());
-        spreadArray->setIndexedProperty(state, Value(i++), value, spreadArray);
+        spreadArray->setIndexedProperty(state, Value(i++), next.value(), spreadArray);
     }
     registerFile[code->m_registerIndex] = spreadArray;
 }
@@ -4636,7 +4931,7 @@ NEVER_INLINE void InterpreterSlowPath::defineObjectGetterSetter(ExecutionState&
         } else {
             gs = new JSGetterSetter(Value(Value::EmptyValue), fn);
         }
-        object->m_values.push_back(Value(gs), code->m_inlineCachedStructureAfter->propertyCount());
+        object->pushBackPropertyValue(Value(gs), code->m_inlineCachedStructureAfter->propertyCount());
         object->m_structure = code->m_inlineCachedStructureAfter;
     } else if (code->m_missCount > minCacheFillCount) {
         // cache miss
@@ -4813,29 +5108,23 @@ NEVER_INLINE void InterpreterSlowPath::iteratorOperation(ExecutionState& state,
     } else if (code->m_operation == IteratorOperation::Operation::IteratorBind) {
         auto strings = &state.context()->staticStrings();
 
-        Optional<Object*> nextResult;
+        Optional<Value> nextValue;
         Value value;
         IteratorRecord* iteratorRecord = registerFile[code->m_iteratorBindData.m_iterRegisterIndex].asPointerValue()->asIteratorRecord();
 
         if (!iteratorRecord->m_done) {
             try {
-                nextResult = IteratorObject::iteratorStep(state, iteratorRecord);
+                nextValue = IteratorObject::iteratorStepValue(state, iteratorRecord);
             } catch (const Value& e) {
                 Value exceptionValue = e;
                 iteratorRecord->m_done = true;
                 state.throwException(exceptionValue);
             }
 
-            if (!nextResult.hasValue()) {
+            if (!nextValue.hasValue()) {
                 iteratorRecord->m_done = true;
             } else {
-                try {
-                    value = IteratorObject::iteratorValue(state, nextResult.value());
-                } catch (const Value& e) {
-                    Value exceptionValue = e;
-                    iteratorRecord->m_done = true;
-                    state.throwException(exceptionValue);
-                }
+                value = nextValue.value();
             }
         }
 
@@ -4888,21 +5177,20 @@ NEVER_INLINE Object* InterpreterSlowPath::restBindOperation(ExecutionState& stat
     auto strings = &state.context()->staticStrings();
 
     Object* result = new ArrayObject(state);
-    Optional<Object*> nextResult;
-    Value value;
+    Optional<Value> nextValue;
     size_t index = 0;
 
     while (true) {
         if (!iteratorRecord->m_done) {
             try {
-                nextResult = IteratorObject::iteratorStep(state, iteratorRecord);
+                nextValue = IteratorObject::iteratorStepValue(state, iteratorRecord);
             } catch (const Value& e) {
                 Value exceptionValue = e;
                 iteratorRecord->m_done = true;
                 state.throwException(exceptionValue);
             }
 
-            if (!nextResult.hasValue()) {
+            if (!nextValue.hasValue()) {
                 iteratorRecord->m_done = true;
             }
         }
@@ -4911,15 +5199,7 @@ NEVER_INLINE Object* InterpreterSlowPath::restBindOperation(ExecutionState& stat
             break;
         }
 
-        try {
-            value = IteratorObject::iteratorValue(state, nextResult.value());
-        } catch (const Value& e) {
-            Value exceptionValue = e;
-            iteratorRecord->m_done = true;
-            state.throwException(exceptionValue);
-        }
-
-        result->setIndexedProperty(state, Value(index++), value);
+        result->setIndexedProperty(state, Value(index++), nextValue.value());
     }
 
     return result;
@@ -256,6 +256,7 @@ InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script)
     , m_lexicalBlockStackAllocatedIdentifierMaximumDepth(0)
     , m_functionBodyBlockIndex(0)
     , m_lexicalBlockIndexFunctionLocatedIn(0)
+    , m_constructedObjectPropertyCount(0)
     , m_isFunctionNameUsedBySelf(false)
     , m_isFunctionNameSaveOnHeap(false)
     , m_isFunctionNameExplicitlyDeclared(false)
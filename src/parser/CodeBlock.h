@@ -706,6 +706,19 @@ public:
         return m_isClassConstructor;
     }
 
+    // allocation site feedback of constructor
+    // the number of properties which `this` had when the last construction ended
+    size_t constructedObjectPropertyCount() const
+    {
+        return m_constructedObjectPropertyCount;
+    }
+
+    void setConstructedObjectPropertyCount(size_t count)
+    {
+        ASSERT(count <= std::numeric_limits<uint16_t>::max());
+        m_constructedObjectPropertyCount = count;
+    }
+
     bool isDerivedClassConstructor() const
     {
         return m_isDerivedClassConstructor;
@@ -975,6 +988,7 @@ protected:
 
     LexicalBlockIndex m_functionBodyBlockIndex : 16;
     LexicalBlockIndex m_lexicalBlockIndexFunctionLocatedIn : 16;
+    uint16_t m_constructedObjectPropertyCount : 16;
 
     bool m_isFunctionNameUsedBySelf : 1;
     bool m_isFunctionNameSaveOnHeap : 1;
@@ -33,6 +33,16 @@ public:
     {
     }
 
+    Node* left()
+    {
+        return m_left;
+    }
+
+    Node* right()
+    {
+        return m_right;
+    }
+
     virtual ASTNodeType type() override { return ASTNodeType::BinaryExpressionMinus; }
     virtual void generateExpressionByteCode(ByteCodeBlock* codeBlock, ByteCodeGenerateContext* context, ByteCodeRegisterIndex dstRegister) override
     {
@@ -269,17 +269,18 @@ public:
             ASSERT(newContext.m_registerStack->size() == baseCountBefore);
             continuePosition = codeBlock->currentCodeSize();
 
-            // Let nextResult be ? Call(iteratorRecord.[[NextMethod]], iteratorRecord.[[Iterator]], « »).
-            IteratorOperation::IteratorNextData iteratorNextData;
-            iteratorNextData.m_iteratorRecordRegisterIndex = REGISTER_LIMIT;
-            iteratorNextData.m_valueRegisterIndex = REGISTER_LIMIT;
-            iteratorNextData.m_returnRegisterIndex = newContext.getRegister();
-
             size_t iteratorNextOperationPos = codeBlock->currentCodeSize();
-            codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorNextData), &newContext, this->m_loc.index);
-
-            // If iteratorKind is async, then set nextResult to ? Await(nextResult).
+            size_t iteratorTestDoneOperationPos = SIZE_MAX;
             if (m_isForAwaitOf) {
+                // Let nextResult be ? Call(iteratorRecord.[[NextMethod]], iteratorRecord.[[Iterator]], « »).
+                IteratorOperation::IteratorNextData iteratorNextData;
+                iteratorNextData.m_iteratorRecordRegisterIndex = REGISTER_LIMIT;
+                iteratorNextData.m_valueRegisterIndex = REGISTER_LIMIT;
+                iteratorNextData.m_returnRegisterIndex = newContext.getRegister();
+
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorNextData), &newContext, this->m_loc.index);
+
+                // If iteratorKind is async, then set nextResult to ? Await(nextResult).
                 size_t tailDataLength = newContext.m_recursiveStatementStack.size() * (sizeof(ByteCodeGenerateContext::RecursiveStatementKind) + sizeof(size_t));
                 ExecutionPause::ExecutionPauseAwaitData data;
                 data.m_awaitIndex = iteratorNextData.m_returnRegisterIndex;
@@ -287,30 +288,54 @@ public:
                 data.m_dstStateIndex = REGISTER_LIMIT;
                 data.m_tailDataLength = tailDataLength;
                 codeBlock->pushCode(ExecutionPause(ByteCodeLOC(m_loc.index), data), &newContext, this->m_loc.index);
+
+                // If Type(nextResult) is not Object, throw a TypeError exception.
+                IteratorOperation::IteratorTestResultIsObjectData iteratorTestResultIsObjectData;
+                iteratorTestResultIsObjectData.m_valueRegisterIndex = iteratorNextData.m_returnRegisterIndex;
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorTestResultIsObjectData), &newContext, this->m_loc.index);
+
+                // Let done be ? IteratorComplete(nextResult).
+                size_t doneRegister = newContext.getRegister();
+                IteratorOperation::IteratorTestDoneData iteratorTestDoneData;
+                iteratorTestDoneData.m_iteratorRecordOrObjectRegisterIndex = iteratorNextData.m_returnRegisterIndex;
+                iteratorTestDoneData.m_dstRegisterIndex = doneRegister;
+                iteratorTestDoneData.m_isIteratorRecord = false;
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorTestDoneData), &newContext, this->m_loc.index);
+
+                // If done is true, return NormalCompletion(V).
+                codeBlock->pushCode(JumpIfTrue(ByteCodeLOC(m_loc.index), doneRegister), &newContext, this->m_loc.index);
+                exit2Pos = codeBlock->lastCodePosition<JumpIfTrue>();
+                newContext.giveUpRegister(); // drop doneRegister
+
+                // Let nextValue be ? IteratorValue(nextResult).
+                IteratorOperation::IteratorValueData iteratorValueData;
+                iteratorValueData.m_srcRegisterIndex = iteratorNextData.m_returnRegisterIndex;
+                iteratorValueData.m_dstRegisterIndex = iteratorNextData.m_returnRegisterIndex;
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorValueData), &newContext, this->m_loc.index);
+            } else {
+                // Let nextResult be ? Call(iteratorRecord.[[NextMethod]], iteratorRecord.[[Iterator]], « »).
+                // If Type(nextResult) is not Object, throw a TypeError exception.
+                // Let done be ? IteratorComplete(nextResult).
+                // Let nextValue be ? IteratorValue(nextResult).
+                // IteratorBind performs these steps on the iterator record, so built-in iterators skip creating result objects
+                IteratorOperation::IteratorBindData iteratorBindData;
+                iteratorBindData.m_registerIndex = newContext.getRegister();
+                iteratorBindData.m_iterRegisterIndex = REGISTER_LIMIT;
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorBindData), &newContext, this->m_loc.index);
+
+                size_t doneRegister = newContext.getRegister();
+                IteratorOperation::IteratorTestDoneData iteratorTestDoneData;
+                iteratorTestDoneData.m_iteratorRecordOrObjectRegisterIndex = REGISTER_LIMIT;
+                iteratorTestDoneData.m_dstRegisterIndex = doneRegister;
+                iteratorTestDoneData.m_isIteratorRecord = true;
+                iteratorTestDoneOperationPos = codeBlock->currentCodeSize();
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorTestDoneData), &newContext, this->m_loc.index);
+
+                // If done is true, return NormalCompletion(V).
+                codeBlock->pushCode(JumpIfTrue(ByteCodeLOC(m_loc.index), doneRegister), &newContext, this->m_loc.index);
+                exit2Pos = codeBlock->lastCodePosition<JumpIfTrue>();
+                newContext.giveUpRegister(); // drop doneRegister
             }
-            // If Type(nextResult) is not Object, throw a TypeError exception.
-            IteratorOperation::IteratorTestResultIsObjectData iteratorTestResultIsObjectData;
-            iteratorTestResultIsObjectData.m_valueRegisterIndex = iteratorNextData.m_returnRegisterIndex;
-            codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorTestResultIsObjectData), &newContext, this->m_loc.index);
-
-            // Let done be ? IteratorComplete(nextResult).
-            size_t doneRegister = newContext.getRegister();
-            IteratorOperation::IteratorTestDoneData iteratorTestDoneData;
-            iteratorTestDoneData.m_iteratorRecordOrObjectRegisterIndex = iteratorNextData.m_returnRegisterIndex;
-            iteratorTestDoneData.m_dstRegisterIndex = doneRegister;
-            iteratorTestDoneData.m_isIteratorRecord = false;
-            codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorTestDoneData), &newContext, this->m_loc.index);
-
-            // If done is true, return NormalCompletion(V).
-            codeBlock->pushCode(JumpIfTrue(ByteCodeLOC(m_loc.index), doneRegister), &newContext, this->m_loc.index);
-            exit2Pos = codeBlock->lastCodePosition<JumpIfTrue>();
-            newContext.giveUpRegister(); // drop doneRegister
-
-            // Let nextValue be ? IteratorValue(nextResult).
-            IteratorOperation::IteratorValueData iteratorValueData;
-            iteratorValueData.m_srcRegisterIndex = iteratorNextData.m_returnRegisterIndex;
-            iteratorValueData.m_dstRegisterIndex = iteratorNextData.m_returnRegisterIndex;
-            codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorValueData), &newContext, this->m_loc.index);
 
             forOfEndCheckRegisterHeadEndPosition = codeBlock->currentCodeSize();
             codeBlock->pushCode(LoadLiteral(ByteCodeLOC(m_loc.index), SIZE_MAX, Value(false)), &newContext, this->m_loc.index);
@@ -344,7 +369,12 @@ public:
 
             codeBlock->peekCode<IteratorOperation>(getIteratorOperationPosition)->m_getIteratorData.m_dstIteratorRecordIndex = iteratorRecordRegisterIndex;
             codeBlock->peekCode<IteratorOperation>(getIteratorOperationPosition)->m_getIteratorData.m_dstIteratorObjectIndex = iteratorObjectRegisterIndex;
-            codeBlock->peekCode<IteratorOperation>(iteratorNextOperationPos)->m_iteratorNextData.m_iteratorRecordRegisterIndex = iteratorRecordRegisterIndex;
+            if (m_isForAwaitOf) {
+                codeBlock->peekCode<IteratorOperation>(iteratorNextOperationPos)->m_iteratorNextData.m_iteratorRecordRegisterIndex = iteratorRecordRegisterIndex;
+            } else {
+                codeBlock->peekCode<IteratorOperation>(iteratorNextOperationPos)->m_iteratorBindData.m_iterRegisterIndex = iteratorRecordRegisterIndex;
+                codeBlock->peekCode<IteratorOperation>(iteratorTestDoneOperationPos)->m_iteratorTestDoneData.m_iteratorRecordOrObjectRegisterIndex = iteratorRecordRegisterIndex;
+            }
         }
 
         size_t blockExitPos = codeBlock->currentCodeSize();
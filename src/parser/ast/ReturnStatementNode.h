@@ -32,6 +32,11 @@ public:
     {
     }
 
+    Node* argument()
+    {
+        return m_argument;
+    }
+
     virtual ASTNodeType type() override { return ASTNodeType::ReturnStatement; }
     virtual void generateStatementByteCode(ByteCodeBlock* codeBlock, ByteCodeGenerateContext* context) override
     {
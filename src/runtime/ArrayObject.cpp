@@ -39,7 +39,8 @@ ArrayObject::ArrayObject(ExecutionState& state, ForSpreadArray)
 {
     // SpreadArray should be fast mode
     // it does not affect or be affected by indexed property in other prototype objects
-    ensureRareData();
+    // its elements are read directly from m_fastModeData, so it never uses double mode storage
+    ensureRareData()->m_arrayObjectHasGenericElements = true;
 }
 
 ArrayObject::ArrayObject(ExecutionState& state)
@@ -193,6 +194,17 @@ bool ArrayObject::defineOwnProperty(ExecutionState& state, const ObjectPropertyN
     }
 
     uint32_t idx = P.tryToUseAsIndexProperty();
+    if (UNLIKELY(isDoubleModeArray()) && idx != Value::InvalidIndexPropertyValue) {
+        // elements of double mode array always have {writable:true, enumerable:true, configurable:true}
+        if (desc.isValuePresent() && desc.value().isNumber()) {
+            bool isExistingElement = idx < arrayLength(state) && !isDoubleModeHole(doubleModeData()[idx]);
+            if ((desc.isDataWritableEnumerableConfigurable() || (isExistingElement && desc.isValuePresentAlone())) && setDoubleModeElement(state, idx, desc.value())) {
+                return true;
+            }
+        }
+        convertDoubleModeIntoFastMode(state);
+    }
+
     if (LIKELY(isFastModeArray())) {
         if (LIKELY(idx != Value::InvalidIndexPropertyValue)) {
             uint32_t len = arrayLength(state);
@@ -264,6 +276,12 @@ bool ArrayObject::deleteOwnProperty(ExecutionState& state, const ObjectPropertyN
                 return true;
             }
         }
+    } else if (isDoubleModeArray()) {
+        uint32_t idx = P.tryToUseAsIndexProperty();
+        if (LIKELY(idx != Value::InvalidIndexPropertyValue) && idx < arrayLength(state)) {
+            doubleModeData()[idx] = doubleModeHole();
+            return true;
+        }
     }
 
     return Object::deleteOwnProperty(state, P);
@@ -281,6 +299,16 @@ void ArrayObject::enumeration(ExecutionState& state, bool (*callback)(ExecutionS
                 return;
             }
         }
+    } else if (isDoubleModeArray()) {
+        size_t len = arrayLength(state);
+        for (size_t i = 0; i < len; i++) {
+            ASSERT(isDoubleModeArray());
+            if (isDoubleModeHole(doubleModeData()[i]))
+                continue;
+            if (!callback(state, this, ObjectPropertyName(state, Value(i)), ObjectStructurePropertyDescriptor::createDataDescriptor(ObjectStructurePropertyDescriptor::AllPresent), data)) {
+                return;
+            }
+        }
     }
 
     int attr = isLengthPropertyWritable() ? (int)ObjectStructurePropertyDescriptor::WritablePresent : 0;
@@ -294,13 +322,14 @@ void ArrayObject::enumeration(ExecutionState& state, bool (*callback)(ExecutionS
 void ArrayObject::sort(ExecutionState& state, uint64_t length, const std::function<bool(const Value& a, const Value& b)>& comp)
 {
     if (length) {
-        if (isFastModeArray()) {
+        bool isDoubleMode = isDoubleModeArray();
+        if (isFastModeArray() || isDoubleMode) {
             size_t byteLength = sizeof(Value) * length;
             bool canUseStack = byteLength <= 1024;
             Value* tempBuffer = canUseStack ? (Value*)alloca(byteLength) : CustomAllocator<Value>().allocate(length);
 
             for (uint64_t i = 0; i < length; i++) {
-                tempBuffer[i] = m_fastModeData[i];
+                tempBuffer[i] = isDoubleMode ? doubleModeElement(i) : Value(m_fastModeData[i]);
             }
 
             Value* tempSpace = canUseStack ? (Value*)alloca(byteLength) : CustomAllocator<Value>().allocate(length);
@@ -319,6 +348,12 @@ void ArrayObject::sort(ExecutionState& state, uint64_t length, const std::functi
                 for (uint64_t i = 0; i < length; i++) {
                     m_fastModeData[i] = tempBuffer[i];
                 }
+            } else if (isDoubleMode && isDoubleModeArray()) {
+                // sorting only reorders the numbers and holes read from double mode storage
+                double* data = doubleModeData();
+                for (uint64_t i = 0; i < length; i++) {
+                    data[i] = tempBuffer[i].isEmpty() ? doubleModeHole() : toDoubleModeElement(tempBuffer[i]);
+                }
             } else {
                 // fast-mode could be changed due to the compare function executed in the previous merge sort
                 for (uint64_t i = 0; i < length; i++) {
@@ -342,14 +377,15 @@ void ArrayObject::toSorted(ExecutionState& state, Object* target, uint64_t lengt
     ArrayObject* arr = target->asArrayObject();
 
     if (length) {
-        if (isFastModeArray()) {
+        bool isDoubleMode = isDoubleModeArray();
+        if (isFastModeArray() || isDoubleMode) {
             size_t byteLength = sizeof(Value) * length;
             bool canUseStack = byteLength <= 1024;
             Value* tempBuffer = canUseStack ? (Value*)alloca(byteLength) : CustomAllocator<Value>().allocate(length);
 
             for (uint64_t i = 0; i < length; i++) {
                 // toSorted handles all hole elements as undefined values
-                Value v = m_fastModeData[i];
+                Value v = isDoubleMode ? doubleModeElement(i) : Value(m_fastModeData[i]);
                 tempBuffer[i] = v.isEmpty() ? Value() : v;
             }
 
@@ -394,6 +430,10 @@ void ArrayObject::iterateArrays(ExecutionState& state, HeapObjectIteratorCallbac
 
 void ArrayObject::convertIntoNonFastMode(ExecutionState& state)
 {
+    if (UNLIKELY(isDoubleModeArray())) {
+        convertDoubleModeIntoFastMode(state);
+    }
+
     if (!isFastModeArray())
         return;
 
@@ -424,6 +464,119 @@ void ArrayObject::convertIntoNonFastMode(ExecutionState& state)
 #endif
 }
 
+// ObjectPropertyValue updates its NumberInEncodedValue in place on assignment.
+// Slots filled by memmove or copied from another array may still point to a box used by another slot,
+// so they are initialized instead of assigned.
+static ALWAYS_INLINE void initializeFastModeSlot(ObjectPropertyValue& slot, const Value& value)
+{
+    new (&slot) ObjectPropertyValue(value);
+}
+
+bool ArrayObject::tryConvertIntoDoubleMode(ExecutionState& state)
+{
+    ASSERT(isFastModeArray() && mayConvertIntoDoubleMode());
+
+    uint32_t length = arrayLength(state);
+    if (UNLIKELY(!isLengthPropertyWritable() || length > ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE)) {
+        ensureRareData()->m_arrayObjectHasGenericElements = true;
+        return false;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        Value v = m_fastModeData[i];
+        if (!v.isEmpty() && !v.isNumber()) {
+            // scan elements only once
+            ensureRareData()->m_arrayObjectHasGenericElements = true;
+            return false;
+        }
+    }
+
+    auto rd = ensureRareData();
+    size_t capacity = std::max(length, (uint32_t)4);
+    double* doubleData = (double*)GC_MALLOC_ATOMIC(sizeof(double) * capacity);
+    for (uint32_t i = 0; i < length; i++) {
+        Value v = m_fastModeData[i];
+        doubleData[i] = v.isEmpty() ? doubleModeHole() : toDoubleModeElement(v);
+    }
+
+#if defined(ESCARGOT_64) && defined(ESCARGOT_USE_32BIT_IN_64BIT)
+    m_fastModeData.resizeWithUninitializedValues(length, 0);
+    m_fastModeData.reset(&ArrayObject::DummyArrayElement);
+#else
+    GC_FREE(m_fastModeData);
+    m_fastModeData = &ArrayObject::DummyArrayElement;
+#endif
+    rd->m_arrayObjectFastModeDoubleData = doubleData;
+    ASSERT(isDoubleModeArray());
+    return true;
+}
+
+void ArrayObject::convertDoubleModeIntoFastMode(ExecutionState& state)
+{
+    ASSERT(isDoubleModeArray());
+
+    auto rd = rareData();
+    double* doubleData = rd->m_arrayObjectFastModeDoubleData;
+    uint32_t length = arrayLength(state);
+    // this also clears m_arrayObjectFastModeDoubleData
+    rd->m_arrayObjectFastModeBufferCapacity = 0;
+    rd->m_arrayObjectHasGenericElements = true;
+
+#if defined(ESCARGOT_64) && defined(ESCARGOT_USE_32BIT_IN_64BIT)
+    m_fastModeData.reset();
+    m_fastModeData.resizeWithUninitializedValues(0, length);
+#else
+    m_fastModeData = length ? (ObjectPropertyValue*)GC_MALLOC(sizeof(ObjectPropertyValue) * length) : nullptr;
+#endif
+    ASSERT(isFastModeArray());
+
+    ObjectPropertyValue* data = fastModeDataPointer();
+    for (uint32_t i = 0; i < length; i++) {
+        double d = doubleData[i];
+        initializeFastModeSlot(data[i], isDoubleModeHole(d) ? Value(Value::EmptyValue) : Value(Value::DoubleToIntConvertibleTestNeeds, d));
+    }
+    GC_FREE(doubleData);
+}
+
+void ArrayObject::setDoubleModeArrayLength(ExecutionState& state, uint32_t newLength)
+{
+    ASSERT(isDoubleModeArray());
+    ASSERT(newLength <= ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE);
+
+    auto rd = rareData();
+    uint32_t oldLength = arrayLength(state);
+    size_t capacity = GC_size(rd->m_arrayObjectFastModeDoubleData) / sizeof(double);
+    if (newLength > capacity) {
+        ComputeReservedCapacityFunctionWithLog2<> f;
+        size_t newCapacity = f(newLength);
+        double* newData = (double*)GC_MALLOC_ATOMIC(sizeof(double) * newCapacity);
+        memcpy(newData, rd->m_arrayObjectFastModeDoubleData, sizeof(double) * oldLength);
+        GC_FREE(rd->m_arrayObjectFastModeDoubleData);
+        rd->m_arrayObjectFastModeDoubleData = newData;
+    }
+
+    double* data = rd->m_arrayObjectFastModeDoubleData;
+    for (uint32_t i = oldLength; i < newLength; i++) {
+        data[i] = doubleModeHole();
+    }
+    m_arrayLength = newLength;
+}
+
+bool ArrayObject::setDoubleModeElement(ExecutionState& state, uint32_t idx, const Value& value)
+{
+    ASSERT(isDoubleModeArray());
+    ASSERT(value.isNumber());
+
+    if (UNLIKELY(idx >= arrayLength(state))) {
+        // double mode array is always extensible (see preventExtensions)
+        if (UNLIKELY(!isLengthPropertyWritable() || idx >= ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE)) {
+            return false;
+        }
+        setDoubleModeArrayLength(state, idx + 1);
+    }
+    doubleModeData()[idx] = toDoubleModeElement(value);
+    return true;
+}
+
 bool ArrayObject::setArrayLength(ExecutionState& state, const Value& newLength)
 {
     bool isPrimitiveValue;
@@ -450,6 +603,14 @@ bool ArrayObject::setArrayLength(ExecutionState& state, const Value& newLength)
 
 bool ArrayObject::setArrayLength(ExecutionState& state, const uint32_t newLength, bool useFitStorage, bool considerHole)
 {
+    if (UNLIKELY(isDoubleModeArray())) {
+        if (LIKELY(isLengthPropertyWritable() && newLength <= ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE)) {
+            setDoubleModeArrayLength(state, newLength);
+            return true;
+        }
+        convertDoubleModeIntoFastMode(state);
+    }
+
     bool isFastMode = isFastModeArray();
     if (UNLIKELY(isFastMode && (newLength > ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE) && considerHole)) {
         uint32_t orgLength = arrayLength(state);
@@ -615,6 +776,15 @@ ObjectGetResult ArrayObject::getVirtualValue(ExecutionState& state, const Object
             }
             return ObjectGetResult();
         }
+    } else if (isDoubleModeArray()) {
+        uint32_t idx = P.tryToUseAsIndexProperty();
+        if (LIKELY(idx != Value::InvalidIndexPropertyValue) && LIKELY(idx < arrayLength(state))) {
+            Value v = doubleModeElement(idx);
+            if (LIKELY(!v.isEmpty())) {
+                return ObjectGetResult(v, true, true, true);
+            }
+            return ObjectGetResult();
+        }
     }
     return ObjectGetResult();
 }
@@ -629,6 +799,14 @@ ObjectHasPropertyResult ArrayObject::hasIndexedProperty(ExecutionState& state, c
                 return ObjectHasPropertyResult(ObjectGetResult(v, true, true, true));
             }
         }
+    } else if (isDoubleModeArray()) {
+        uint32_t idx = propertyName.tryToUseAsIndexProperty(state);
+        if (LIKELY(idx != Value::InvalidIndexPropertyValue) && LIKELY(idx < arrayLength(state))) {
+            Value v = doubleModeElement(idx);
+            if (LIKELY(!v.isEmpty())) {
+                return ObjectHasPropertyResult(ObjectGetResult(v, true, true, true));
+            }
+        }
     }
     return hasProperty(state, ObjectPropertyName(state, propertyName));
 }
@@ -643,12 +821,36 @@ ObjectGetResult ArrayObject::getIndexedProperty(ExecutionState& state, const Val
                 return ObjectGetResult(v, true, true, true);
             }
         }
+    } else if (isDoubleModeArray()) {
+        uint32_t idx = property.tryToUseAsIndexProperty(state);
+        if (LIKELY(idx != Value::InvalidIndexPropertyValue) && LIKELY(idx < arrayLength(state))) {
+            Value v = doubleModeElement(idx);
+            if (LIKELY(!v.isEmpty())) {
+                return ObjectGetResult(v, true, true, true);
+            }
+        }
     }
     return get(state, ObjectPropertyName(state, property), receiver);
 }
 
 bool ArrayObject::setIndexedProperty(ExecutionState& state, const Value& property, const Value& value, const Value& receiver)
 {
+    if (UNLIKELY(isDoubleModeArray())) {
+        if (LIKELY(value.isNumber() && property.isUInt32() && receiver.isObject() && receiver.asObject() == this)) {
+            uint32_t idx = property.tryToUseAsIndexProperty(state);
+            if (LIKELY(idx != Value::InvalidIndexPropertyValue) && LIKELY(setDoubleModeElement(state, idx, value))) {
+                return true;
+            }
+        }
+        // defineOwnProperty converts the storage when needed
+        return set(state, ObjectPropertyName(state, property), value, receiver);
+    } else if (UNLIKELY(value.isDouble()) && isFastModeArray() && mayConvertIntoDoubleMode() && property.isUInt32()) {
+        // the first double stored into an array of numbers moves the elements into double mode storage
+        if (tryConvertIntoDoubleMode(state)) {
+            return setIndexedProperty(state, property, value, receiver);
+        }
+    }
+
     // checking isUint32 to prevent invoke toString on property more than once while calling setIndexedProperty
     if (LIKELY(isFastModeArray() && property.isUInt32())) {
         uint32_t idx = property.tryToUseAsIndexProperty(state);
@@ -675,6 +877,237 @@ bool ArrayObject::setIndexedProperty(ExecutionState& state, const Value& propert
     return set(state, ObjectPropertyName(state, property), value, receiver);
 }
 
+bool ArrayObject::isFastModeRangePacked(ExecutionState& state, uint64_t start, uint64_t end)
+{
+    if (UNLIKELY(!isFastModeArray() || end > arrayLength(state))) {
+        return false;
+    }
+    for (uint64_t i = start; i < end; i++) {
+        if (UNLIKELY(m_fastModeData[i].isEmpty())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool isNumberList(const Value* values, size_t count, bool& hasDouble)
+{
+    hasDouble = false;
+    for (size_t i = 0; i < count; i++) {
+        if (!values[i].isNumber()) {
+            return false;
+        }
+        hasDouble |= values[i].isDouble();
+    }
+    return true;
+}
+
+bool ArrayObject::isDoubleModeRangePacked(ExecutionState& state, uint64_t start, uint64_t end)
+{
+    ASSERT(isDoubleModeArray() && end <= arrayLength(state));
+    double* data = doubleModeData();
+    for (uint64_t i = start; i < end; i++) {
+        if (UNLIKELY(isDoubleModeHole(data[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ArrayObject::fastModePush(ExecutionState& state, const Value* values, size_t count)
+{
+    uint32_t oldLength = arrayLength(state);
+    uint64_t newLength = (uint64_t)oldLength + count;
+    if (UNLIKELY(!isLengthPropertyWritable() || newLength > ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE)) {
+        return false;
+    }
+
+    bool hasDouble;
+    bool onlyNumbers = isNumberList(values, count, hasDouble);
+    if (UNLIKELY(hasDouble && onlyNumbers && isFastModeArray() && mayConvertIntoDoubleMode())) {
+        tryConvertIntoDoubleMode(state);
+    }
+    if (UNLIKELY(isDoubleModeArray())) {
+        if (LIKELY(onlyNumbers)) {
+            setDoubleModeArrayLength(state, (uint32_t)newLength);
+            double* data = doubleModeData();
+            for (size_t i = 0; i < count; i++) {
+                data[oldLength + i] = toDoubleModeElement(values[i]);
+            }
+            return true;
+        }
+        convertDoubleModeIntoFastMode(state);
+    }
+
+    if (UNLIKELY(!isFastModeArray())) {
+        return false;
+    }
+    ASSERT(isExtensible(state));
+
+    // setArrayLength reserves extra capacity, so repeated pushes do not reallocate each time
+    setArrayLength(state, (uint32_t)newLength);
+    ASSERT(isFastModeArray());
+    ObjectPropertyValue* data = fastModeDataPointer();
+    for (size_t i = 0; i < count; i++) {
+        initializeFastModeSlot(data[oldLength + i], values[i]);
+    }
+    return true;
+}
+
+bool ArrayObject::fastModePop(ExecutionState& state, Value& result)
+{
+    uint32_t length = arrayLength(state);
+    if (UNLIKELY(!isLengthPropertyWritable() || length == 0)) {
+        return false;
+    }
+
+    if (UNLIKELY(isDoubleModeArray())) {
+        Value last = doubleModeElement(length - 1);
+        if (UNLIKELY(last.isEmpty())) {
+            return false;
+        }
+        setDoubleModeArrayLength(state, length - 1);
+        result = last;
+        return true;
+    }
+
+    if (UNLIKELY(!isFastModeArray())) {
+        return false;
+    }
+    Value last = m_fastModeData[length - 1];
+    if (UNLIKELY(last.isEmpty())) {
+        return false;
+    }
+
+    setArrayLength(state, length - 1);
+    ASSERT(isFastModeArray());
+    result = last;
+    return true;
+}
+
+bool ArrayObject::fastModeShift(ExecutionState& state, Value& result)
+{
+    uint32_t length = arrayLength(state);
+    if (UNLIKELY(length == 0 || !isLengthPropertyWritable())) {
+        return false;
+    }
+
+    if (UNLIKELY(isDoubleModeArray())) {
+        if (UNLIKELY(!isDoubleModeRangePacked(state, 0, length))) {
+            return false;
+        }
+        double* data = doubleModeData();
+        result = Value(Value::DoubleToIntConvertibleTestNeeds, data[0]);
+        memmove(data, data + 1, sizeof(double) * (length - 1));
+        setDoubleModeArrayLength(state, length - 1);
+        return true;
+    }
+
+    if (UNLIKELY(!isFastModeRangePacked(state, 0, length))) {
+        return false;
+    }
+
+    ObjectPropertyValue* data = fastModeDataPointer();
+    result = data[0];
+    memmove(static_cast<void*>(data), data + 1, sizeof(ObjectPropertyValue) * (length - 1));
+    setArrayLength(state, length - 1);
+    ASSERT(isFastModeArray());
+    return true;
+}
+
+bool ArrayObject::fastModeUnshift(ExecutionState& state, const Value* values, size_t count)
+{
+    uint32_t oldLength = arrayLength(state);
+    uint64_t newLength = (uint64_t)oldLength + count;
+    if (UNLIKELY(newLength > ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE || !isLengthPropertyWritable())) {
+        return false;
+    }
+
+    if (UNLIKELY(isDoubleModeArray())) {
+        bool hasDouble;
+        if (UNLIKELY(!isNumberList(values, count, hasDouble) || !isDoubleModeRangePacked(state, 0, oldLength))) {
+            return false;
+        }
+        setDoubleModeArrayLength(state, (uint32_t)newLength);
+        double* data = doubleModeData();
+        memmove(data + count, data, sizeof(double) * oldLength);
+        for (size_t i = 0; i < count; i++) {
+            data[i] = toDoubleModeElement(values[i]);
+        }
+        return true;
+    }
+
+    if (UNLIKELY(!isFastModeRangePacked(state, 0, oldLength))) {
+        return false;
+    }
+
+    setArrayLength(state, (uint32_t)newLength);
+    ASSERT(isFastModeArray());
+    ObjectPropertyValue* data = fastModeDataPointer();
+    memmove(static_cast<void*>(data + count), data, sizeof(ObjectPropertyValue) * oldLength);
+    for (size_t i = 0; i < count; i++) {
+        initializeFastModeSlot(data[i], values[i]);
+    }
+    return true;
+}
+
+bool ArrayObject::fastModeSplice(ExecutionState& state, uint64_t start, uint64_t deleteCount, const Value* items, size_t itemCount)
+{
+    uint32_t oldLength = arrayLength(state);
+    ASSERT(start + deleteCount <= oldLength);
+    uint64_t newLength = (uint64_t)oldLength - deleteCount + itemCount;
+    if (UNLIKELY(newLength > ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE || !isLengthPropertyWritable() || !isFastModeRangePacked(state, start + deleteCount, oldLength))) {
+        return false;
+    }
+
+    uint64_t tailCount = oldLength - start - deleteCount;
+    if (itemCount > deleteCount) {
+        // grow first, the buffer may be reallocated
+        setArrayLength(state, (uint32_t)newLength);
+        ASSERT(isFastModeArray());
+        ObjectPropertyValue* data = fastModeDataPointer();
+        memmove(static_cast<void*>(data + start + itemCount), data + start + deleteCount, sizeof(ObjectPropertyValue) * tailCount);
+        for (size_t i = 0; i < itemCount; i++) {
+            initializeFastModeSlot(data[start + i], items[i]);
+        }
+    } else {
+        // fill the buffer before shrinking, the buffer may be reallocated
+        ObjectPropertyValue* data = fastModeDataPointer();
+        if (itemCount != deleteCount) {
+            memmove(static_cast<void*>(data + start + itemCount), data + start + deleteCount, sizeof(ObjectPropertyValue) * tailCount);
+        }
+        for (size_t i = 0; i < itemCount; i++) {
+            initializeFastModeSlot(data[start + i], items[i]);
+        }
+        setArrayLength(state, (uint32_t)newLength);
+        ASSERT(isFastModeArray());
+    }
+    return true;
+}
+
+bool ArrayObject::fastModeCopyElements(ExecutionState& state, ArrayObject* source, uint64_t sourceStart, uint64_t count, uint64_t targetStart)
+{
+    if (UNLIKELY(source == this || !isFastModeArray() || !source->isFastModeRangePacked(state, sourceStart, sourceStart + count))) {
+        return false;
+    }
+
+    uint64_t targetEnd = targetStart + count;
+    if (targetEnd > arrayLength(state)) {
+        if (UNLIKELY(!isLengthPropertyWritable() || targetEnd > ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE)) {
+            return false;
+        }
+        setArrayLength(state, (uint32_t)targetEnd);
+        ASSERT(isFastModeArray());
+    }
+
+    ObjectPropertyValue* targetData = fastModeDataPointer();
+    ObjectPropertyValue* sourceData = source->fastModeDataPointer();
+    for (uint64_t i = 0; i < count; i++) {
+        initializeFastModeSlot(targetData[targetStart + i], sourceData[sourceStart + i]);
+    }
+    return true;
+}
+
 bool ArrayObject::preventExtensions(ExecutionState& state)
 {
     // first, convert to non-fast-mode.
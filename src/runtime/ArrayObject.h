@@ -28,6 +28,9 @@ namespace Escargot {
 
 #define ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE 65536 * 16
 #define ESCARGOT_ARRAY_NON_FASTMODE_START_MIN_GAP 1024
+// NaN bit pattern which represents a hole in double mode storage
+// every NaN stored into double mode storage is canonicalized, so it never collides with this pattern
+#define ESCARGOT_ARRAY_DOUBLE_MODE_HOLE_BITS 0x7FF4000000000001ULL
 
 class ArrayIteratorObject;
 
@@ -39,6 +42,7 @@ class ArrayObject : public DerivedObject {
     friend class EnumerateObject;
     friend class EnumerateObjectWithDestruction;
     friend class EnumerateObjectWithIteration;
+    friend class Serializer;
     friend Value builtinArrayConstructor(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget);
     friend void initializeCustomAllocators();
     friend int getValidValueInArrayObject(void* ptr, GC_mark_custom_result* arr);
@@ -86,6 +90,9 @@ public:
     void defineOwnIndexedPropertyWithoutExpanding(ExecutionState& state, const size_t& index, const Value& value)
     {
         ASSERT(index < arrayLength(state));
+        if (UNLIKELY(isDoubleModeArray())) {
+            convertDoubleModeIntoFastMode(state);
+        }
         if (LIKELY(isFastModeArray())) {
             setFastModeArrayValueWithoutExpanding(state, index, value);
         } else {
@@ -93,6 +100,42 @@ public:
         }
     }
 
+    // Fast paths used by Array.prototype builtins.
+    // Every function returns false without side effects when the fast-mode storage cannot be used directly
+    // (non fast-mode array, holes in the touched range, non-writable length or too large result).
+    // Holes are never read here because their value may come from the prototype chain.
+    // Builtins re-check on each use, since user code invoked in between may change the array.
+    ALWAYS_INLINE bool tryGetFastModeElement(ExecutionState& state, int64_t idx, Value& result)
+    {
+        if (LIKELY(idx < arrayLength(state))) {
+            if (LIKELY(isFastModeArray())) {
+                Value v = m_fastModeData[idx];
+                if (LIKELY(!v.isEmpty())) {
+                    result = v;
+                    return true;
+                }
+            } else if (isDoubleModeArray()) {
+                double d = doubleModeData()[idx];
+                if (LIKELY(!isDoubleModeHole(d))) {
+                    result = Value(Value::DoubleToIntConvertibleTestNeeds, d);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool isFastModeRangePacked(ExecutionState& state, uint64_t start, uint64_t end);
+    bool fastModePush(ExecutionState& state, const Value* values, size_t count);
+    bool fastModePop(ExecutionState& state, Value& result);
+    bool fastModeShift(ExecutionState& state, Value& result);
+    bool fastModeUnshift(ExecutionState& state, const Value* values, size_t count);
+    // replaces [start, start + deleteCount) with items, moving the tail with one memmove
+    bool fastModeSplice(ExecutionState& state, uint64_t start, uint64_t deleteCount, const Value* items, size_t itemCount);
+    // copies packed [sourceStart, sourceStart + count) of source into [targetStart, ...) of this array, growing it if needed
+    // number boxes are not shared between the arrays
+    bool fastModeCopyElements(ExecutionState& state, ArrayObject* source, uint64_t sourceStart, uint64_t count, uint64_t targetStart);
+
 protected:
     ArrayObject()
         : DerivedObject()
@@ -122,6 +165,79 @@ private:
 #endif
     }
 
+    ALWAYS_INLINE ObjectPropertyValue* fastModeDataPointer()
+    {
+        ASSERT(isFastModeArray());
+#if defined(ESCARGOT_64) && defined(ESCARGOT_USE_32BIT_IN_64BIT)
+        return m_fastModeData.data();
+#else
+        return m_fastModeData;
+#endif
+    }
+
+    // Element kinds of an array
+    // - initial: elements live in m_fastModeData and no double has been stored yet (Smis are stored inline by EncodedValue)
+    // - double: every element is a number and lives unboxed in rareData()->m_arrayObjectFastModeDoubleData.
+    //   m_fastModeData is DummyArrayElement, so code which only knows m_fastModeData treats the array as non-fast mode
+    //   and goes through the virtual functions
+    // - generic: elements live in m_fastModeData (or in the structure in non-fast mode)
+    //   and rareData()->m_arrayObjectHasGenericElements prevents scanning the elements again
+    ALWAYS_INLINE bool isDoubleModeArray()
+    {
+        // double data shares its slot with m_arrayObjectFastModeBufferCapacity which is always odd
+        return !isFastModeArray() && hasRareData() && rareData()->m_arrayObjectFastModeDoubleData
+            && !(reinterpret_cast<size_t>(rareData()->m_arrayObjectFastModeDoubleData) & 1);
+    }
+
+    ALWAYS_INLINE double* doubleModeData()
+    {
+        ASSERT(isDoubleModeArray());
+        return rareData()->m_arrayObjectFastModeDoubleData;
+    }
+
+    ALWAYS_INLINE bool mayConvertIntoDoubleMode()
+    {
+        ASSERT(isFastModeArray());
+        return !hasRareData() || !rareData()->m_arrayObjectHasGenericElements;
+    }
+
+    static ALWAYS_INLINE bool isDoubleModeHole(double d)
+    {
+        return bitwise_cast<uint64_t>(d) == ESCARGOT_ARRAY_DOUBLE_MODE_HOLE_BITS;
+    }
+
+    static ALWAYS_INLINE double doubleModeHole()
+    {
+        return bitwise_cast<double>(ESCARGOT_ARRAY_DOUBLE_MODE_HOLE_BITS);
+    }
+
+    static ALWAYS_INLINE double toDoubleModeElement(const Value& v)
+    {
+        ASSERT(v.isNumber());
+        double d = v.asNumber();
+        if (UNLIKELY(std::isnan(d))) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return d;
+    }
+
+    // returns EmptyValue for a hole
+    ALWAYS_INLINE Value doubleModeElement(size_t idx)
+    {
+        double d = doubleModeData()[idx];
+        if (UNLIKELY(isDoubleModeHole(d))) {
+            return Value(Value::EmptyValue);
+        }
+        return Value(Value::DoubleToIntConvertibleTestNeeds, d);
+    }
+
+    bool tryConvertIntoDoubleMode(ExecutionState& state);
+    void convertDoubleModeIntoFastMode(ExecutionState& state);
+    void setDoubleModeArrayLength(ExecutionState& state, uint32_t newLength);
+    // returns false when the value cannot be stored into double mode storage
+    bool setDoubleModeElement(ExecutionState& state, uint32_t idx, const Value& value);
+    bool isDoubleModeRangePacked(ExecutionState& state, uint64_t start, uint64_t end);
+
     bool isLengthPropertyWritable()
     {
         return hasRareData() ? rareData()->m_isArrayObjectLengthWritable : true;
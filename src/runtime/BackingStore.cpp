@@ -51,6 +51,17 @@ BackingStore* BackingStore::createNonSharedBackingStore(void* data, size_t byteL
     return new NonSharedBackingStore(data, byteLength, callback, callbackData, false);
 }
 
+BackingStore* BackingStore::createDefaultNonSharedBackingStore(void* data, size_t byteLength)
+{
+    return new NonSharedBackingStore(data, byteLength, backingStorePlatformDeleter, nullptr, true);
+}
+
+BackingStore* BackingStore::createDefaultResizableNonSharedBackingStore(void* data, size_t byteLength, size_t maxByteLength)
+{
+    ASSERT(byteLength <= maxByteLength);
+    return new NonSharedBackingStore(data, byteLength, backingStorePlatformDeleter, maxByteLength, true);
+}
+
 NonSharedBackingStore::NonSharedBackingStore(void* data, size_t byteLength, BackingStoreDeleterCallback callback, void* callbackData, bool isAllocatedByPlatform)
     : m_data(data)
     , m_byteLength(byteLength)
@@ -133,6 +144,20 @@ void NonSharedBackingStore::reallocate(size_t newByteLength)
     bufferUpdated(m_data, newByteLength);
 }
 
+void* NonSharedBackingStore::releasePlatformAllocatedData()
+{
+    if (!m_isAllocatedByPlatform) {
+        return nullptr;
+    }
+
+    // deleter is still called on finalization, but backingStorePlatformDeleter ignores null data
+    void* data = m_data;
+    m_data = nullptr;
+    m_byteLength = 0;
+    bufferUpdated(m_data, m_byteLength);
+    return data;
+}
+
 #if defined(ENABLE_THREADING)
 BackingStore* BackingStore::createDefaultSharedBackingStore(size_t byteLength)
 {
@@ -137,6 +137,9 @@ public:
     static BackingStore* createDefaultNonSharedBackingStore(size_t byteLength);
     static BackingStore* createDefaultResizableNonSharedBackingStore(size_t byteLength, size_t maxByteLength);
     static BackingStore* createNonSharedBackingStore(void* data, size_t byteLength, BackingStoreDeleterCallback callback, void* callbackData);
+    // create BackingStore which adopts data block allocated by Platform (e.g. released from another BackingStore)
+    static BackingStore* createDefaultNonSharedBackingStore(void* data, size_t byteLength);
+    static BackingStore* createDefaultResizableNonSharedBackingStore(void* data, size_t byteLength, size_t maxByteLength);
 
 #if defined(ENABLE_THREADING)
     static BackingStore* createDefaultSharedBackingStore(size_t byteLength);
@@ -169,6 +172,14 @@ public:
         ASSERT_NOT_REACHED();
     }
 
+    // hand over the data block to the caller without copying (used for transferring ArrayBuffer)
+    // returns nullptr if the data block is not allocated by Platform
+    // this BackingStore becomes empty after release
+    virtual void* releasePlatformAllocatedData()
+    {
+        return nullptr;
+    }
+
     void* operator new(size_t size) = delete;
     void* operator new[](size_t size) = delete;
 
@@ -216,6 +227,7 @@ public:
 
     virtual void resize(size_t newByteLength) override;
     virtual void reallocate(size_t newByteLength) override;
+    virtual void* releasePlatformAllocatedData() override;
 
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
@@ -31,6 +31,8 @@
 #include "parser/CodeBlock.h"
 #include "SandBox.h"
 #include "ArrayObject.h"
+#include "MegamorphicPropertyCache.h"
+#include "ObjectKeysCache.h"
 #include "debugger/Debugger.h"
 #if defined(ENABLE_WASM)
 #include "wasm/WASMObject.h"
@@ -51,6 +53,56 @@ void* GlobalVariableAccessCacheItem::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+void Context::RegExpLegacyFeatures::recordMatch(String* subject, const unsigned* offsets, unsigned subPatternNum)
+{
+    unsigned maxMatchedIndex = subPatternNum;
+    for (; maxMatchedIndex > 0; maxMatchedIndex--) {
+        if (offsets[maxMatchedIndex * 2] != std::numeric_limits<unsigned>::max()) {
+            break;
+        }
+    }
+
+    // RegExp.lastParen is empty unless the last capture group took part in the match
+    if (subPatternNum && maxMatchedIndex == subPatternNum) {
+        pendingLastParen[0] = offsets[subPatternNum * 2];
+        pendingLastParen[1] = offsets[subPatternNum * 2 + 1];
+    } else {
+        pendingLastParen[0] = pendingLastParen[1] = std::numeric_limits<unsigned>::max();
+    }
+
+    dollarCount = maxMatchedIndex;
+    size_t copySize = 2 * (std::min(maxMatchedIndex, 9u) + 1);
+    memcpy(pendingOffsets, offsets, sizeof(unsigned) * copySize);
+    pendingSubject = subject;
+}
+
+void Context::RegExpLegacyFeatures::materialize()
+{
+    String* subject = pendingSubject;
+    pendingSubject = nullptr;
+
+    unsigned matchStart = pendingOffsets[0];
+    unsigned matchEnd = pendingOffsets[1];
+    lastMatch = StringView(subject, matchStart, matchEnd);
+    leftContext = StringView(subject, 0, matchStart);
+    rightContext = StringView(subject, matchEnd, subject->length());
+
+    if (pendingLastParen[0] == std::numeric_limits<unsigned>::max()) {
+        lastParen = StringView();
+    } else {
+        lastParen = StringView(subject, pendingLastParen[0], pendingLastParen[1]);
+    }
+
+    size_t dollarEnd = std::min(dollarCount, (size_t)9);
+    for (size_t i = 1; i <= dollarEnd; i++) {
+        if (pendingOffsets[i * 2] == std::numeric_limits<unsigned>::max()) {
+            dollars[i - 1] = StringView();
+        } else {
+            dollars[i - 1] = StringView(subject, pendingOffsets[i * 2], pendingOffsets[i * 2 + 1]);
+        }
+    }
+}
+
 Context::Context(VMInstance* instance)
     : m_instance(instance)
     , m_atomicStringMap(&instance->m_atomicStringMap)
@@ -59,6 +111,8 @@ Context::Context(VMInstance* instance)
     , m_globalDeclarativeRecord(new IdentifierRecordVector())
     , m_globalDeclarativeStorage(new EncodedValueVector())
     , m_globalVariableAccessCache(new (GC) GlobalVariableAccessCache)
+    , m_megamorphicPropertyCache(nullptr)
+    , m_objectKeysCache(nullptr)
     , m_loadedModules(new LoadedModuleVector())
     , m_regexpCache(instance->m_regexpCache)
 #if defined(ENABLE_WASM)
@@ -135,6 +189,18 @@ void Context::throwException(ExecutionState& state, const Value& exception)
     }
 }
 
+void Context::setPendingException(ExecutionState& state, const Value& exception)
+{
+    ASSERT(vmInstance()->currentSandBox() != nullptr);
+#if defined(ENABLE_EXTENDED_API)
+    if (UNLIKELY(m_instance->isErrorThrowCallbackRegistered() && exception.isObject() && exception.asObject()->isErrorObject())) {
+        // trigger ErrorThrowCallback when an ErrorObject is thrown
+        m_instance->triggerErrorThrowCallback(state, exception.asObject()->asErrorObject());
+    }
+#endif
+    vmInstance()->currentSandBox()->setPendingException(state, exception);
+}
+
 void Context::setGlobalObjectProxy(Object* newGlobalObjectProxy)
 {
     m_globalObjectProxy = newGlobalObjectProxy;
@@ -250,4 +316,16 @@ GlobalVariableAccessCacheItem* Context::ensureGlobalVariableAccessCacheSlot(Atom
 
     return iter->second;
 }
+
+void Context::createMegamorphicPropertyCache()
+{
+    ASSERT(!m_megamorphicPropertyCache);
+    m_megamorphicPropertyCache = new MegamorphicPropertyCache();
+}
+
+void Context::createObjectKeysCache()
+{
+    ASSERT(!m_objectKeysCache);
+    m_objectKeysCache = new ObjectKeysCache();
+}
 } // namespace Escargot
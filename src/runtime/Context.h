@@ -37,6 +37,8 @@ class ToStringRecursionPreventer;
 class FunctionTemplate;
 class ASTAllocator;
 class Debugger;
+class MegamorphicPropertyCache;
+class ObjectKeysCache;
 
 #if defined(ENABLE_WASM)
 class WASMCacheMap;
@@ -93,6 +95,9 @@ class Context : public gc {
 public:
     // Legacy RegExp Features (non-standard)
     struct RegExpLegacyFeatures {
+        // The last successful match only records its offsets (pendingSubject, pendingOffsets).
+        // The StringView fields below are built from them when RegExp.$1 and friends are read
+        static constexpr size_t pendingOffsetsSize = 2 * 10; // lastMatch, $1-$9
         String* input; // RegExp.input ($_)
         StringView lastMatch;
         StringView lastParen;
@@ -101,6 +106,9 @@ public:
         StringView dollars[9]; // RegExp.$1-$9
         size_t dollarCount;
         bool valid;
+        String* pendingSubject;
+        unsigned pendingOffsets[pendingOffsetsSize];
+        unsigned pendingLastParen[2];
 
         RegExpLegacyFeatures()
             : input(String::emptyString)
@@ -110,6 +118,7 @@ public:
             , rightContext()
             , dollarCount(0)
             , valid(true)
+            , pendingSubject(nullptr)
         {
             for (size_t i = 0; i < 9; i++) {
                 dollars[i] = StringView();
@@ -130,7 +139,21 @@ public:
             }
             dollarCount = 0;
             valid = false;
+            pendingSubject = nullptr;
         }
+
+        // offsets is the Yarr output buffer of a successful match on subject
+        void recordMatch(String* subject, const unsigned* offsets, unsigned subPatternNum);
+
+        void materializeIfNeeded()
+        {
+            if (UNLIKELY(pendingSubject != nullptr)) {
+                materialize();
+            }
+        }
+
+    private:
+        void materialize();
     };
 
     explicit Context(VMInstance* instance);
@@ -155,7 +178,7 @@ public:
         return *m_scriptParser;
     }
 
-    RegExpCacheMap* regexpCache()
+    RegExpCache* regexpCache()
     {
         return m_regexpCache;
     }
@@ -237,6 +260,12 @@ public:
         return m_defaultPrivateMemberStructure;
     }
 
+    // updated whenever adding a property to an object of this context creates a new structure
+    ObjectStructureStatistics& objectStructureStatistics()
+    {
+        return m_objectStructureStatistics;
+    }
+
     GlobalObject* globalObject()
     {
         return m_globalObject;
@@ -257,6 +286,9 @@ public:
 
     bool canThrowException();
     void throwException(ExecutionState& state, const Value& exception);
+    // records `exception` like throwException without unwinding the C++ stack
+    // the caller should return the exception to its nearest handler by itself
+    void setPendingException(ExecutionState& state, const Value& exception);
 
     // this is not compatible with ECMAScript
     // but this callback is needed for browser-implementation
@@ -295,6 +327,22 @@ public:
 
     GlobalVariableAccessCacheItem* ensureGlobalVariableAccessCacheSlot(AtomicString as);
 
+    MegamorphicPropertyCache* megamorphicPropertyCache()
+    {
+        if (UNLIKELY(!m_megamorphicPropertyCache)) {
+            createMegamorphicPropertyCache();
+        }
+        return m_megamorphicPropertyCache;
+    }
+
+    ObjectKeysCache* objectKeysCache()
+    {
+        if (UNLIKELY(!m_objectKeysCache)) {
+            createObjectKeysCache();
+        }
+        return m_objectKeysCache;
+    }
+
     LoadedModuleVector* loadedModules()
     {
         return m_loadedModules;
@@ -330,6 +378,9 @@ public:
 #endif /* ESCARGOT_DEBUGGER */
 
 private:
+    void createMegamorphicPropertyCache();
+    void createObjectKeysCache();
+
     VMInstance* m_instance;
 
     // these data actually store in VMInstance
@@ -344,8 +395,13 @@ private:
     IdentifierRecordVector* m_globalDeclarativeRecord;
     EncodedValueVector* m_globalDeclarativeStorage;
     GlobalVariableAccessCache* m_globalVariableAccessCache;
+    // allocated when the first property access site becomes megamorphic
+    MegamorphicPropertyCache* m_megamorphicPropertyCache;
+    // allocated when Object.keys is called with a plain object first
+    ObjectKeysCache* m_objectKeysCache;
+    ObjectStructureStatistics m_objectStructureStatistics;
     LoadedModuleVector* m_loadedModules;
-    RegExpCacheMap* m_regexpCache;
+    RegExpCache* m_regexpCache;
 #if defined(ENABLE_WASM)
     WASMCacheMap* m_wasmCache;
     WASMHostFunctionEnvironmentVector* m_wasmEnvCache;
@@ -350,6 +350,13 @@ public:
 
         int32_t i32;
         if (from.isInt32() && EncodedValueImpl::PlatformSmiTagging::IsValidSmi(i32 = from.asInt32())) {
+            // a slot which already owns a number box keeps it,
+            // so a field alternating between integer and double values does not allocate on every store
+            intptr_t payload = m_data.payload;
+            if (UNLIKELY(!HAS_SMI_TAG(payload) && ((size_t)payload > (size_t)ValueLast) && readPointerIsNumberEncodedValue((void*)payload))) {
+                ((NumberInEncodedValue*)payload)->setValue(from);
+                return *this;
+            }
             m_data.payload = EncodedValueImpl::PlatformSmiTagging::IntToSmi(i32);
             return *this;
         }
@@ -547,6 +554,11 @@ public:
 
         int32_t i32;
         if (from.isInt32() && EncodedValueImpl::PlatformSmiTagging::IsValidSmi(i32 = from.asInt32())) {
+            // keep the number box of the slot, see EncodedValue::operator=
+            if (UNLIKELY(!isSMI() && ((size_t)payload() > (size_t)ValueLast) && EncodedValue::readPointerIsNumberEncodedValue(reinterpret_cast<void*>(payload())))) {
+                reinterpret_cast<NumberInEncodedValue*>(payload())->setValue(from);
+                return *this;
+            }
             setPayload(EncodedValueImpl::PlatformSmiTagging::IntToSmi(i32));
             return *this;
         }
@@ -76,6 +76,14 @@ bool EnumerateObject::checkIfModified(ExecutionState& state)
                     return true;
                 }
             }
+        } else if (obj->isDoubleModeArray() && m_index < m_keys.size()) {
+            Value currentKey = m_keys[m_index];
+            auto idx = currentKey.tryToUseAsIndex(state);
+            if (idx < m_arrayLength) {
+                if (ArrayObject::isDoubleModeHole(obj->doubleModeData()[idx])) {
+                    return true;
+                }
+            }
         }
     }
     return false;
@@ -139,6 +147,7 @@ void EnumerateObjectWithDestruction::executeEnumeration(ExecutionState& state, E
     }
 
     m_hiddenClass = m_object->structure();
+    m_hiddenClass->markReferencedByEnumeration();
 
     struct Properties {
         std::multiset<Value::ValueIndex, std::less<Value::ValueIndex>> indexes;
@@ -199,6 +208,7 @@ void EnumerateObjectWithIteration::executeEnumeration(ExecutionState& state, Enc
 
     bool shouldSearchProto = false;
     m_hiddenClassChain.push_back(m_object->structure());
+    m_object->structure()->markReferencedByEnumeration();
 
     std::unordered_set<String*, std::hash<String*>, std::equal_to<String*>, GCUtil::gc_malloc_allocator<String*>> keyStringSet;
 
@@ -221,6 +231,7 @@ void EnumerateObjectWithIteration::executeEnumeration(ExecutionState& state, Enc
             }
         }
         m_hiddenClassChain.push_back(proto->structure());
+        proto->structure()->markReferencedByEnumeration();
         proto = proto->getPrototypeObject(state);
 
         // v8 throw exception when there is too many things on prototype chain
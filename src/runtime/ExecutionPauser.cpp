@@ -143,10 +143,30 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
     try {
         ExecutionState* es;
         size_t startPos = self->m_byteCodePosition;
+        bool needsInterpret = true;
         if (startPos == SIZE_MAX) {
             // need to fresh start
             startPos = programStart;
             es = self->m_executionState;
+        } else if (self->m_resumeByteCodePosition == SIZE_MAX) {
+            // paused on top level of function body
+            // we don't need to rebuild ExecutionState tree. do what ExecutionResume does
+            es = self->m_executionState;
+            ASSERT(es == originalState);
+            es->m_inExecutionStopState = false;
+            startPos += programStart;
+
+            if (self->m_registerFile == nullptr) { // released generator. return now.
+                result = Value();
+                needsInterpret = false;
+            } else if (self->m_resumeStateIndex == REGISTER_LIMIT) {
+                if (isAbruptReturn) {
+                    result = resumeValue;
+                    needsInterpret = false;
+                } else if (isAbruptThrow) {
+                    es->throwException(resumeValue);
+                }
+            }
         } else {
             // resume
             startPos = reinterpret_cast<size_t>(self->m_pausedCode.data());
@@ -183,7 +203,9 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
         }
 #endif /* ESCARGOT_DEBUGGER */
 
-        result = Interpreter::interpret(es, self->m_byteCodeBlock, startPos, self->m_registerFile);
+        if (LIKELY(needsInterpret)) {
+            result = Interpreter::interpret(es, self->m_byteCodeBlock, startPos, self->m_registerFile);
+        }
 
 #ifdef ESCARGOT_DEBUGGER
         if (activeSavedStackTraceExecutionState != ESCARGOT_DEBUGGER_NO_STACK_TRACE_RESTORE) {
@@ -230,11 +252,11 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
                 Object::call(state, self->m_promiseCapability.m_resolveFunction, Value(), 1, &argv);
                 result = self->m_promiseCapability.m_promise;
             }
-            self->release();
+            self->releaseFinished(state);
         }
     } catch (const Value& thrownValue) {
         auto promiseCapability = self->m_promiseCapability;
-        self->release();
+        self->releaseFinished(state);
         if (from == StartFrom::Generator) {
             ASSERT(from == StartFrom::Generator);
             source->asGeneratorObject()->m_generatorState = GeneratorObject::GeneratorState::CompletedThrow;
@@ -263,6 +285,16 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
     return result;
 }
 
+void ExecutionPauser::releaseFinished(ExecutionState& state)
+{
+    // interpreter frames of this function are gone and nothing else refers its register file
+    if (m_registerFile) {
+        ASSERT(m_byteCodeBlock);
+        state.context()->vmInstance()->recycleGeneratorRegisterFile(m_registerFile, m_byteCodeBlock->m_requiredTotalRegisterNumber);
+    }
+    release();
+}
+
 void ExecutionPauser::pause(ExecutionState& state, Value returnValue, size_t tailDataPosition, size_t tailDataLength, size_t nextProgramCounter, ByteCodeRegisterIndex dstRegisterIndex, ByteCodeRegisterIndex dstStateRegisterIndex, PauseReason reason)
 {
     ExecutionState* originalState = &state;
@@ -300,76 +332,84 @@ void ExecutionPauser::pause(ExecutionState& state, Value returnValue, size_t tai
     originalState->m_parent = nullptr;
     originalState->m_programCounter = nullptr;
 
-    self->m_pausedCode.clear();
-
     // some case(async generator), the function execution ended before pause
     if (self->m_byteCodeBlock) {
-        // read & fill recursive statement self
-        char* start = (char*)(tailDataPosition);
-        char* end = (char*)(start + tailDataLength);
-
-        size_t startupDataPosition = self->m_pausedCode.size();
-        std::vector<size_t> codeStartPositions;
-        size_t codePos = startupDataPosition;
-        while (start != end) {
-            size_t e = *((size_t*)start);
-            start += sizeof(ByteCodeGenerateContext::RecursiveStatementKind);
-            size_t startPos = *((size_t*)start);
-            codeStartPositions.push_back(startPos);
-            if (e == ByteCodeGenerateContext::Block) {
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(BlockOperation));
-                BlockOperation* code = new (self->m_pausedCode.data() + codePos) BlockOperation(ByteCodeLOC(SIZE_MAX), nullptr);
-                code->assignOpcodeInAddress();
-
-                codePos += sizeof(BlockOperation);
-            } else if (e == ByteCodeGenerateContext::OpenEnv) {
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(OpenLexicalEnvironment));
-                OpenLexicalEnvironment* code = new (self->m_pausedCode.data() + codePos) OpenLexicalEnvironment(ByteCodeLOC(SIZE_MAX), OpenLexicalEnvironment::ResumeExecution, REGISTER_LIMIT);
-                code->assignOpcodeInAddress();
-
-                codePos += sizeof(OpenLexicalEnvironment);
-            } else if (e == ByteCodeGenerateContext::Try) {
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(TryOperation));
-                TryOperation* code = new (self->m_pausedCode.data() + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
-                code->assignOpcodeInAddress();
-                code->m_isTryResumeProcess = true;
-
-                codePos += sizeof(TryOperation);
-            } else if (e == ByteCodeGenerateContext::Catch) {
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(TryOperation));
-                TryOperation* code = new (self->m_pausedCode.data() + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
-                code->assignOpcodeInAddress();
-                code->m_isCatchResumeProcess = true;
-
-                codePos += sizeof(TryOperation);
-            } else {
-                ASSERT(e == ByteCodeGenerateContext::Finally);
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(TryOperation));
-                TryOperation* code = new (self->m_pausedCode.data() + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
-                code->assignOpcodeInAddress();
-                code->m_isFinallyResumeProcess = true;
-
-                codePos += sizeof(TryOperation);
+        if (tailDataLength == 0 && originalState == &state) {
+            // paused on top level of function body
+            // ExecutionPauser::start enters interpreter at m_byteCodePosition directly
+            self->m_resumeByteCodePosition = SIZE_MAX;
+        } else {
+            // read & fill recursive statement self
+            char* start = (char*)(tailDataPosition);
+            char* end = (char*)(start + tailDataLength);
+
+            // compute size of resume code first
+            // so we can reuse buffer of previous pause when it is paused on the same statement again
+            size_t codeStartPositionsSize = 0;
+            size_t resumeCodePos = 0;
+            for (char* p = start; p != end; p += sizeof(ByteCodeGenerateContext::RecursiveStatementKind) + sizeof(size_t)) {
+                size_t e = *((size_t*)p);
+                if (e == ByteCodeGenerateContext::Block) {
+                    resumeCodePos += sizeof(BlockOperation);
+                } else if (e == ByteCodeGenerateContext::OpenEnv) {
+                    resumeCodePos += sizeof(OpenLexicalEnvironment);
+                } else {
+                    resumeCodePos += sizeof(TryOperation);
+                }
+                codeStartPositionsSize++;
             }
-            start += sizeof(size_t); // start pos
-        }
+            self->m_pausedCode.resizeWithUninitializedValues(resumeCodePos + sizeof(ExecutionResume) + sizeof(size_t) * (codeStartPositionsSize + 1));
+
+            size_t codePos = 0;
+            size_t* codeStartPositions = (size_t*)(self->m_pausedCode.data() + resumeCodePos + sizeof(ExecutionResume) + sizeof(size_t));
+            while (start != end) {
+                size_t e = *((size_t*)start);
+                start += sizeof(ByteCodeGenerateContext::RecursiveStatementKind);
+                size_t startPos = *((size_t*)start);
+                *codeStartPositions++ = startPos;
+                if (e == ByteCodeGenerateContext::Block) {
+                    BlockOperation* code = new (self->m_pausedCode.data() + codePos) BlockOperation(ByteCodeLOC(SIZE_MAX), nullptr);
+                    code->assignOpcodeInAddress();
+
+                    codePos += sizeof(BlockOperation);
+                } else if (e == ByteCodeGenerateContext::OpenEnv) {
+                    OpenLexicalEnvironment* code = new (self->m_pausedCode.data() + codePos) OpenLexicalEnvironment(ByteCodeLOC(SIZE_MAX), OpenLexicalEnvironment::ResumeExecution, REGISTER_LIMIT);
+                    code->assignOpcodeInAddress();
+
+                    codePos += sizeof(OpenLexicalEnvironment);
+                } else if (e == ByteCodeGenerateContext::Try) {
+                    TryOperation* code = new (self->m_pausedCode.data() + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
+                    code->assignOpcodeInAddress();
+                    code->m_isTryResumeProcess = true;
+
+                    codePos += sizeof(TryOperation);
+                } else if (e == ByteCodeGenerateContext::Catch) {
+                    TryOperation* code = new (self->m_pausedCode.data() + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
+                    code->assignOpcodeInAddress();
+                    code->m_isCatchResumeProcess = true;
+
+                    codePos += sizeof(TryOperation);
+                } else {
+                    ASSERT(e == ByteCodeGenerateContext::Finally);
+                    TryOperation* code = new (self->m_pausedCode.data() + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
+                    code->assignOpcodeInAddress();
+                    code->m_isFinallyResumeProcess = true;
+
+                    codePos += sizeof(TryOperation);
+                }
+                start += sizeof(size_t); // start pos
+            }
+            ASSERT(codePos == resumeCodePos);
 
-        size_t resumeCodePos = self->m_pausedCode.size();
-        self->m_resumeByteCodePosition = resumeCodePos;
-        self->m_pausedCode.resizeWithUninitializedValues(resumeCodePos + sizeof(ExecutionResume));
-        auto resumeCode = new (self->m_pausedCode.data() + resumeCodePos) ExecutionResume(ByteCodeLOC(SIZE_MAX), self);
-        resumeCode->assignOpcodeInAddress();
-
-        size_t stackSizePos = self->m_pausedCode.size();
-        self->m_pausedCode.resizeWithUninitializedValues(stackSizePos + sizeof(size_t));
-        new (self->m_pausedCode.data() + stackSizePos) size_t(codeStartPositions.size());
-
-        // add ByteCodePositions
-        for (size_t i = 0; i < codeStartPositions.size(); i++) {
-            size_t pos = self->m_pausedCode.size();
-            self->m_pausedCode.resizeWithUninitializedValues(pos + sizeof(size_t));
-            new (self->m_pausedCode.data() + pos) size_t(codeStartPositions[i]);
+            self->m_resumeByteCodePosition = resumeCodePos;
+            auto resumeCode = new (self->m_pausedCode.data() + resumeCodePos) ExecutionResume(ByteCodeLOC(SIZE_MAX), self);
+            resumeCode->assignOpcodeInAddress();
+
+            // add ByteCodePositions
+            new (self->m_pausedCode.data() + resumeCodePos + sizeof(ExecutionResume)) size_t(codeStartPositionsSize);
         }
+    } else {
+        self->m_pausedCode.clear();
     }
 
     PauseValue* exitValue = new PauseValue();
@@ -68,6 +68,9 @@ public:
         m_promiseCapability.m_rejectFunction = nullptr;
     }
 
+    // release after the function finished. its register file is not used anymore and can be reused
+    void releaseFinished(ExecutionState& state);
+
     enum StartFrom {
         Generator,
         Async,
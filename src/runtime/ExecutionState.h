@@ -44,12 +44,18 @@ struct ExecutionStateRareData : public gc {
     ExecutionPauser* m_pauseSource;
     ControlFlowRecordVector* m_controlFlowRecordVector;
     size_t m_programCounterWhenItStoppedByYield;
+    // ThrowOperation can leave an exception pending in SandBox::exception() and return to the tryOperation
+    // which owns this state, instead of throwing a C++ exception
+    bool m_canHavePendingException : 1;
+    bool m_hasPendingException : 1;
 
     ExecutionStateRareData()
         : m_codeBlock(nullptr)
         , m_pauseSource(nullptr)
         , m_controlFlowRecordVector(nullptr)
         , m_programCounterWhenItStoppedByYield(SIZE_MAX)
+        , m_canHavePendingException(false)
+        , m_hasPendingException(false)
     {
     }
 
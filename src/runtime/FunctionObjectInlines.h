@@ -128,7 +128,7 @@ public:
         Value* registerFile;
 
         if (std::is_same<FunctionObjectType, ScriptGeneratorFunctionObject>::value || std::is_same<FunctionObjectType, ScriptAsyncFunctionObject>::value || std::is_same<FunctionObjectType, ScriptAsyncGeneratorFunctionObject>::value) {
-            registerFile = (Value*)CustomAllocator<Value>().allocate(registerFileSize);
+            registerFile = ctx->vmInstance()->allocateGeneratorRegisterFile(registerFileSize);
         } else {
             // keep ByteCodeBlock pointer in registerFileBuffer
             registerFile = (Value*)alloca((registerFileSize) * sizeof(Value) + sizeof(size_t));
@@ -49,6 +49,9 @@ void Global::initialize(Platform* platform)
     // tag values should be initialized once and not changed
     PointerValue::g_objectTag = Object().getVTag();
     PointerValue::g_prototypeObjectTag = PrototypeObject().getVTag();
+#if defined(ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+    PointerValue::g_inlinePropertyStorageObjectTag = InlinePropertyStorageObject().getVTag();
+#endif
     PointerValue::g_arrayObjectTag = ArrayObject().getVTag();
     PointerValue::g_arrayPrototypeObjectTag = ArrayPrototypeObject().getVTag();
     PointerValue::g_scriptFunctionObjectTag = ScriptFunctionObject().getVTag();
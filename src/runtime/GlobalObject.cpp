@@ -112,6 +112,19 @@ static Value builtinIsBlockAllocatedOnStack(ExecutionState& state, Value thisVal
 
     return Value(result);
 }
+
+static Value builtinCompareRegExpBackends(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
+{
+    if (!argv[0].isObject() || !argv[0].asObject()->isRegExpObject()) {
+        ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "first argument should be a RegExp");
+    }
+    String* str = argv[1].toString(state);
+    size_t startIndex = argc > 2 ? argv[2].toLength(state) : 0;
+    if (startIndex > str->length()) {
+        startIndex = str->length();
+    }
+    return argv[0].asObject()->asRegExpObject()->compareMatchBackends(state, str, startIndex);
+}
 #endif
 
 static Value builtinEval(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
@@ -918,6 +931,12 @@ void GlobalObject::installOthers(ExecutionState& state)
                       ObjectPropertyDescriptor(new NativeFunctionObject(state,
                                                                         NativeFunctionInfo(strings->run, builtinIsBlockAllocatedOnStack, 2, NativeFunctionInfo::Strict)),
                                                (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::AllPresent)));
+
+    AtomicString compareRegExpBackendsFunctionName(state, "compareRegExpBackends");
+    defineOwnProperty(state, ObjectPropertyName(compareRegExpBackendsFunctionName),
+                      ObjectPropertyDescriptor(new NativeFunctionObject(state,
+                                                                        NativeFunctionInfo(compareRegExpBackendsFunctionName, builtinCompareRegExpBackends, 2, NativeFunctionInfo::Strict)),
+                                               (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::AllPresent)));
 #endif
 
 #ifdef PROFILE_BDWGC
@@ -31,10 +31,11 @@ class FunctionObject;
 #define GLOBALOBJECT_BUILTIN_ARRAYBUFFER(F, objName) \
     F(arrayBuffer, FunctionObject, objName)          \
     F(arrayBufferPrototype, Object, objName)
-#define GLOBALOBJECT_BUILTIN_ARRAY(F, objName) \
-    F(array, FunctionObject, objName)          \
-    F(arrayPrototype, Object, objName)         \
-    F(arrayIteratorPrototype, Object, objName) \
+#define GLOBALOBJECT_BUILTIN_ARRAY(F, objName)             \
+    F(array, FunctionObject, objName)                      \
+    F(arrayPrototype, Object, objName)                     \
+    F(arrayIteratorPrototype, Object, objName)             \
+    F(arrayIteratorPrototypeNext, FunctionObject, objName) \
     F(arrayPrototypeValues, FunctionObject, objName)
 #define GLOBALOBJECT_BUILTIN_ASYNCFROMSYNCITERATOR(F, objName) \
     F(asyncFromSyncIteratorPrototype, Object, objName)
@@ -140,10 +141,11 @@ class FunctionObject;
     F(json, Object, objName)                  \
     F(jsonStringify, FunctionObject, objName) \
     F(jsonParse, FunctionObject, objName)
-#define GLOBALOBJECT_BUILTIN_MAP(F, objName) \
-    F(map, FunctionObject, objName)          \
-    F(mapPrototype, Object, objName)         \
-    F(mapIteratorPrototype, Object, objName)
+#define GLOBALOBJECT_BUILTIN_MAP(F, objName)             \
+    F(map, FunctionObject, objName)                      \
+    F(mapPrototype, Object, objName)                     \
+    F(mapIteratorPrototype, Object, objName)             \
+    F(mapIteratorPrototypeNext, FunctionObject, objName)
 #define GLOBALOBJECT_BUILTIN_MATH(F, objName) \
     F(math, Object, objName)
 #define GLOBALOBJECT_BUILTIN_NUMBER(F, objName) \
@@ -186,14 +188,16 @@ class FunctionObject;
     F(regexpReplaceMethod, FunctionObject, objName)   \
     F(regexpStringIteratorPrototype, Object, objName) \
     F(regexpSplitMethod, FunctionObject, objName)
-#define GLOBALOBJECT_BUILTIN_SET(F, objName) \
-    F(set, FunctionObject, objName)          \
-    F(setPrototypeObject, Object, objName)   \
-    F(setIteratorPrototype, Object, objName)
-#define GLOBALOBJECT_BUILTIN_STRING(F, objName) \
-    F(string, FunctionObject, objName)          \
-    F(stringPrototype, Object, objName)         \
-    F(stringIteratorPrototype, Object, objName) \
+#define GLOBALOBJECT_BUILTIN_SET(F, objName)             \
+    F(set, FunctionObject, objName)                      \
+    F(setPrototypeObject, Object, objName)               \
+    F(setIteratorPrototype, Object, objName)             \
+    F(setIteratorPrototypeNext, FunctionObject, objName)
+#define GLOBALOBJECT_BUILTIN_STRING(F, objName)             \
+    F(string, FunctionObject, objName)                      \
+    F(stringPrototype, Object, objName)                     \
+    F(stringIteratorPrototype, Object, objName)             \
+    F(stringIteratorPrototypeNext, FunctionObject, objName) \
     F(stringProxyObject, StringObject, objName)
 #define GLOBALOBJECT_BUILTIN_SYMBOL(F, objName) \
     F(symbol, FunctionObject, objName)          \
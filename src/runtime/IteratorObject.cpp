@@ -48,6 +48,28 @@ Value IteratorObject::next(ExecutionState& state)
     return r;
 }
 
+// the original `next` functions of Array, TypedArray, Map, Set and String iterators return fresh ordinary result objects
+// so reading `done` and `value` from them is not observable and the iterator can be advanced directly
+static bool hasBuiltinNextMethod(ExecutionState& state, Object* iterator, const Value& nextMethod)
+{
+    if (!iterator->isIteratorObject() || !nextMethod.isObject()) {
+        return false;
+    }
+
+    GlobalObject* globalObject = state.context()->globalObject();
+    Object* next = nextMethod.asObject();
+    if (iterator->isArrayIteratorObject()) {
+        return next == globalObject->arrayIteratorPrototypeNext();
+    } else if (iterator->isMapIteratorObject()) {
+        return next == globalObject->mapIteratorPrototypeNext();
+    } else if (iterator->isSetIteratorObject()) {
+        return next == globalObject->setIteratorPrototypeNext();
+    } else if (iterator->isStringIteratorObject()) {
+        return next == globalObject->stringIteratorPrototypeNext();
+    }
+    return false;
+}
+
 // https://www.ecma-international.org/ecma-262/10.0/#sec-getiterator
 IteratorRecord* IteratorObject::getIterator(ExecutionState& state, const Value& obj, const bool sync, const Value& func)
 {
@@ -87,7 +109,7 @@ IteratorRecord* IteratorObject::getIterator(ExecutionState& state, const Value&
 
     // Let iteratorRecord be Record { [[Iterator]]: iterator, [[NextMethod]]: nextMethod, [[Done]]: false }.
     // Return iteratorRecord
-    return new IteratorRecord(iterator.asObject(), nextMethod, false);
+    return new IteratorRecord(iterator.asObject(), nextMethod, false, hasBuiltinNextMethod(state, iterator.asObject(), nextMethod));
 }
 
 // https://www.ecma-international.org/ecma-262/10.0/#sec-iteratornext
@@ -138,6 +160,15 @@ Optional<Object*> IteratorObject::iteratorStep(ExecutionState& state, IteratorRe
 // https://tc39.es/ecma262/#sec-iteratorstepvalue
 Optional<Value> IteratorObject::iteratorStepValue(ExecutionState& state, IteratorRecord* iteratorRecord)
 {
+    if (iteratorRecord->m_hasBuiltinNextMethod) {
+        ASSERT(iteratorRecord->m_iterator->isIteratorObject());
+        auto result = iteratorRecord->m_iterator->asIteratorObject()->advance(state);
+        if (result.second) {
+            return nullptr;
+        }
+        return result.first;
+    }
+
     // Let result be ? IteratorStep(iteratorRecord).
     auto result = iteratorStep(state, iteratorRecord);
     // If result is done, then
@@ -219,13 +250,12 @@ ValueVectorWithInlineStorage IteratorObject::iterableToList(ExecutionState& stat
         iteratorRecord = IteratorObject::getIterator(state, items, true);
     }
     ValueVectorWithInlineStorage values;
-    Optional<Object*> next;
+    Optional<Value> next;
 
     while (true) {
-        next = IteratorObject::iteratorStep(state, iteratorRecord);
+        next = IteratorObject::iteratorStepValue(state, iteratorRecord);
         if (next.hasValue()) {
-            Value nextValue = IteratorObject::iteratorValue(state, next.value());
-            values.pushBack(nextValue);
+            values.pushBack(next.value());
         } else {
             break;
         }
@@ -37,16 +37,20 @@ public:
     Object* m_iterator;
     EncodedValue m_nextMethod;
     bool m_done;
+    // m_iterator is a built-in iterator and m_nextMethod is its original `next` function
+    // so IteratorObject::iteratorStepValue can advance it without creating result objects
+    bool m_hasBuiltinNextMethod;
 
     virtual bool isIteratorRecord() const override
     {
         return true;
     }
 
-    IteratorRecord(Object* iterator, EncodedValue nextMethod, bool done)
+    IteratorRecord(Object* iterator, EncodedValue nextMethod, bool done, bool hasBuiltinNextMethod = false)
         : m_iterator(iterator)
         , m_nextMethod(nextMethod)
         , m_done(done)
+        , m_hasBuiltinNextMethod(hasBuiltinNextMethod)
     {
     }
 };
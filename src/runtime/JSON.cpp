@@ -546,54 +546,14 @@ static void builtinJSONStringifyJO(ExecutionState& state, Object* value,
 // https://www.ecma-international.org/ecma-262/6.0/#sec-quotejsonstring
 static void builtinJSONStringifyQuote(ExecutionState& state, String* value, LargeStringBuilder& product)
 {
-    bool allNormalChar = true;
     auto bad = value->bufferAccessData();
-    for (size_t i = 0; i < bad.length; ++i) {
-        char16_t c = bad.charAt(i);
-        switch (c) {
-        case u'\"':
-        case u'\\':
-        case u'\b':
-        case u'\f':
-        case u'\n':
-        case u'\r':
-        case u'\t':
-        case 0:
-        case 1:
-        case 2:
-        case 3:
-        case 4:
-        case 5:
-        case 6:
-        case 7:
-        case 11:
-        case 14:
-        case 15:
-        case 16:
-        case 17:
-        case 18:
-        case 19:
-        case 20:
-        case 21:
-        case 22:
-        case 23:
-        case 24:
-        case 25:
-        case 26:
-        case 27:
-        case 28:
-        case 29:
-        case 30:
-        case 31:
-            allNormalChar = false;
-            break;
-        default:
-            break;
-        }
-        if (UNLIKELY(!allNormalChar)) {
-            break;
-        }
+    size_t firstEscape;
+    if (bad.has8BitContent) {
+        firstEscape = StringKernels::findJSONEscapeCharacter((const LChar*)bad.bufferAs8Bit, bad.length);
+    } else {
+        firstEscape = StringKernels::findJSONEscapeCharacter(bad.bufferAs16Bit, bad.length);
     }
+    bool allNormalChar = firstEscape == bad.length;
 
     if (allNormalChar) {
         product.appendChar('"');
@@ -602,11 +562,20 @@ static void builtinJSONStringifyQuote(ExecutionState& state, String* value, Larg
         return;
     }
 
-    bool allLatin1 = true;
+    // characters before the first escape are copied as they are
+    bool allLatin1;
     std::basic_string<char16_t> buffer;
-    buffer.reserve(bad.length);
+    buffer.reserve(bad.length + 2);
     buffer.push_back(u'"');
-    for (size_t i = 0; i < bad.length; ++i) {
+    buffer.resize(firstEscape + 1);
+    if (bad.has8BitContent) {
+        allLatin1 = true;
+        StringKernels::copyCharacters(&buffer[1], (const LChar*)bad.bufferAs8Bit, firstEscape);
+    } else {
+        allLatin1 = StringKernels::isAllLatin1(bad.bufferAs16Bit, firstEscape);
+        StringKernels::copyCharacters(&buffer[1], bad.bufferAs16Bit, firstEscape);
+    }
+    for (size_t i = firstEscape; i < bad.length; ++i) {
         char16_t c = bad.charAt(i);
         switch (c) {
         case u'\"':
@@ -145,4 +145,23 @@ SandBox::SandBoxResult CleanupSomeJob::run()
     result.result = Value();
     return result;
 }
+#if defined(ENABLE_THREADING)
+void JobFromAnotherThreadTicket::markReady()
+{
+    std::unique_lock<std::mutex> ul(m_channel->m_mutex);
+    if (m_isCanceled) {
+        return;
+    }
+    m_isReady = true;
+    m_channel->m_pendingEventCount++;
+    m_channel->m_conditionVariable.notify_all();
+}
+
+bool JobFromAnotherThreadTicket::isCanceled()
+{
+    std::unique_lock<std::mutex> ul(m_channel->m_mutex);
+    return m_isCanceled;
+}
+#endif
+
 } // namespace Escargot
@@ -100,5 +100,56 @@ private:
     Optional<Object*> m_callback;
 };
 
+#if defined(ENABLE_THREADING)
+struct EventFromAnotherThreadChannel;
+
+// plain data shared between a JobFromAnotherThread and the work running on another thread
+// the work should touch only this, never GC objects nor the platform
+class JobFromAnotherThreadTicket {
+    friend class VMInstance;
+
+public:
+    explicit JobFromAnotherThreadTicket(const std::shared_ptr<EventFromAnotherThreadChannel>& channel)
+        : m_isReady(false)
+        , m_isCanceled(false)
+        , m_channel(channel)
+    {
+    }
+
+    // called from another thread when the work is done
+    // wakes up the thread of VMInstance, the job itself runs on that thread later
+    void markReady();
+    bool isCanceled();
+
+private:
+    // guarded by the mutex of m_channel
+    bool m_isReady;
+    bool m_isCanceled;
+    std::shared_ptr<EventFromAnotherThreadChannel> m_channel;
+};
+
+// job waiting for a work running on another thread
+// VMInstance keeps this job until the work is done, then runs it on the thread of VMInstance
+// see VMInstance::enqueueJobFromAnotherThread
+class JobFromAnotherThread : public Job {
+    friend class VMInstance;
+
+public:
+    // called on the thread of VMInstance when the related context or VMInstance is torn down before the job runs
+    // the ticket is already marked as canceled, this should wait the work running on another thread
+    virtual void cancel() = 0;
+
+protected:
+    JobFromAnotherThread(Context* relatedContext)
+        : Job(relatedContext)
+    {
+    }
+
+private:
+    // released by VMInstance when the job leaves the queue because destructor of GC object is not called
+    std::shared_ptr<JobFromAnotherThreadTicket> m_ticket;
+};
+#endif
+
 } // namespace Escargot
 #endif // __EscargotJob__
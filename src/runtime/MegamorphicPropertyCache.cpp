@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#include "Escargot.h"
+#include "MegamorphicPropertyCache.h"
+
+namespace Escargot {
+
+NEVER_INLINE Value MegamorphicPropertyCache::getSlowCase(ExecutionState& state, Object* obj, const ObjectStructurePropertyName& propertyName, const Value& receiver)
+{
+    if (propertyName.hasAtomicString()) {
+        ObjectStructure* structures[MaxPrototypeDepth + 1];
+        Object* holder = obj;
+        size_t depth = 0;
+        while (holder->isInlineCacheable()) {
+            structures[depth] = holder->structure();
+            auto result = structures[depth]->findProperty(propertyName);
+            if (result.first != SIZE_MAX) {
+                if (result.first > CachedIndexMax) {
+                    break;
+                }
+
+                Entry& entry = m_entries[entryIndex(structures[0], propertyName)];
+                for (size_t i = 0; i <= depth; i++) {
+                    // structures referenced by cache are never modified in place
+                    structures[i]->markReferencedByInlineCache();
+                    entry.m_structures[i] = structures[i];
+                }
+                entry.m_propertyName = propertyName;
+                entry.m_cachedIndex = result.first;
+                entry.m_depth = depth;
+                entry.m_isPlainDataProperty = result.second->m_descriptor.isPlainDataProperty();
+
+                if (entry.m_isPlainDataProperty) {
+                    return holder->m_values[result.first];
+                }
+                return holder->getOwnNonPlainDataPropertyUtilForObject(state, result.first, receiver);
+            }
+
+            holder = holder->Object::getPrototypeObject(state);
+            if (!holder || depth == MaxPrototypeDepth) {
+                // missing property and deep prototype chain are not cached
+                break;
+            }
+            depth++;
+        }
+    }
+
+    return obj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
+}
+
+} // namespace Escargot
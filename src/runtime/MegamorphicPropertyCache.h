@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotMegamorphicPropertyCache__
+#define __EscargotMegamorphicPropertyCache__
+
+#include "runtime/Object.h"
+#include "runtime/ObjectStructure.h"
+
+namespace Escargot {
+
+// fixed size stub cache shared by every megamorphic property access site of a Context
+// entry is keyed by (receiver structure, property name) and holds the holder depth and slot index
+// structures of the whole lookup chain are kept in entry and compared on every hit
+// so structure transitions and prototype mutations are detected without explicit invalidation
+class MegamorphicPropertyCache : public gc {
+public:
+    static constexpr size_t CacheSize = 256;
+    static constexpr size_t MaxPrototypeDepth = 4;
+    static constexpr size_t CachedIndexMax = std::numeric_limits<uint16_t>::max();
+
+    MegamorphicPropertyCache()
+        : m_entries()
+    {
+    }
+
+    ALWAYS_INLINE Value get(ExecutionState& state, Object* obj, const ObjectStructurePropertyName& propertyName, const Value& receiver)
+    {
+        if (LIKELY(propertyName.hasAtomicString())) {
+            ObjectStructure* structure = obj->structure();
+            const Entry& entry = m_entries[entryIndex(structure, propertyName)];
+            // exotic objects like Proxy can share structure with ordinary objects
+            // so cacheability of every object in the chain is checked too
+            if (entry.m_structures[0] == structure && entry.m_propertyName == propertyName && obj->isInlineCacheable()) {
+                Object* holder = obj;
+                size_t depth = 1;
+                for (; depth <= entry.m_depth; depth++) {
+                    holder = holder->Object::getPrototypeObject(state);
+                    if (!holder || holder->structure() != entry.m_structures[depth] || !holder->isInlineCacheable()) {
+                        break;
+                    }
+                }
+                if (LIKELY(depth > entry.m_depth)) {
+                    ASSERT(holder->structure()->findProperty(propertyName).first == entry.m_cachedIndex);
+                    if (LIKELY(entry.m_isPlainDataProperty)) {
+                        return holder->m_values[entry.m_cachedIndex];
+                    }
+                    return holder->getOwnNonPlainDataPropertyUtilForObject(state, entry.m_cachedIndex, receiver);
+                }
+            }
+        }
+        return getSlowCase(state, obj, propertyName, receiver);
+    }
+
+private:
+    struct Entry {
+        Entry()
+            : m_structures()
+            , m_propertyName()
+            , m_cachedIndex(0)
+            , m_depth(0)
+            , m_isPlainDataProperty(false)
+        {
+        }
+
+        // m_structures[0] is structure of receiver, m_structures[m_depth] is structure of holder
+        ObjectStructure* m_structures[MaxPrototypeDepth + 1];
+        ObjectStructurePropertyName m_propertyName;
+        uint16_t m_cachedIndex;
+        uint8_t m_depth;
+        bool m_isPlainDataProperty;
+    };
+
+    static ALWAYS_INLINE size_t entryIndex(ObjectStructure* structure, const ObjectStructurePropertyName& propertyName)
+    {
+        return ((reinterpret_cast<size_t>(structure) >> 4) ^ propertyName.hashValue()) & (CacheSize - 1);
+    }
+
+    Value getSlowCase(ExecutionState& state, Object* obj, const ObjectStructurePropertyName& propertyName, const Value& receiver);
+
+    Entry m_entries[CacheSize];
+};
+
+} // namespace Escargot
+
+#endif
@@ -115,6 +115,7 @@ ObjectRareData::ObjectRareData(Object* obj)
     , m_isFinalizerRegistered(false)
     , m_isInlineCacheable(true)
     , m_hasExtendedExtraData(false)
+    , m_arrayObjectHasGenericElements(false)
 #if defined(ESCARGOT_ENABLE_TEST)
     , m_isHTMLDDA(false)
 #endif
@@ -511,6 +512,73 @@ Object::Object(ObjectStructure* structure, ObjectPropertyValueVector&& values, O
     ASSERT(!!proto);
 }
 
+Object* Object::tryCreateWithInlinePropertyStorage(ExecutionState& state, Object* proto, size_t inlineStorageSize)
+{
+#if defined(ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+    if (inlineStorageSize && inlineStorageSize <= ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE_MAX_SIZE) {
+        return InlinePropertyStorageObject::create(state, proto, inlineStorageSize);
+    }
+#endif
+    UNUSED_PARAMETER(state);
+    UNUSED_PARAMETER(proto);
+    UNUSED_PARAMETER(inlineStorageSize);
+    return nullptr;
+}
+
+#if defined(ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+InlinePropertyStorageObject* InlinePropertyStorageObject::create(ExecutionState& state, Object* proto, size_t capacity)
+{
+    ASSERT(capacity);
+    void* buffer = GC_MALLOC(sizeof(InlinePropertyStorageObject) + sizeof(ObjectPropertyValue) * capacity);
+    InlinePropertyStorageObject* obj = new (buffer) InlinePropertyStorageObject(state, proto, capacity);
+    obj->m_values.reset(obj->inlinePropertyValueStorage());
+    return obj;
+}
+
+void InlinePropertyStorageObject::movePropertyValuesOut(ObjectPropertyValue* buffer, size_t size)
+{
+    ASSERT(hasVTag(g_inlinePropertyStorageObjectTag));
+    ASSERT(size <= m_inlinePropertyValueCapacity);
+    // inline slots are cleared not to keep dead values alive
+    ObjectPropertyValue* inlineStorage = inlinePropertyValueStorage();
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = inlineStorage[i];
+        inlineStorage[i] = ObjectPropertyValue();
+    }
+    m_values.resetWithoutRelease(buffer);
+    writeVTag(g_objectTag);
+}
+
+void Object::pushBackPropertyValueSlowCase(const ObjectPropertyValue& value, size_t newSize)
+{
+    ASSERT(hasVTag(g_inlinePropertyStorageObjectTag));
+    InlinePropertyStorageObject* self = static_cast<InlinePropertyStorageObject*>(this);
+    if (newSize > self->inlinePropertyValueCapacity()) {
+        ObjectPropertyValue* buffer = GCUtil::gc_malloc_allocator<ObjectPropertyValue>().allocate(newSize);
+        self->movePropertyValuesOut(buffer, newSize - 1);
+    }
+    m_values[newSize - 1] = value;
+}
+#endif
+
+void Object::erasePropertyValue(size_t idx, size_t currentSize)
+{
+    // dictionary mode object keeps its buffer for following additions
+    bool shouldEraseInPlace = m_structure->isDictionaryStructure();
+#if defined(ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+    shouldEraseInPlace = shouldEraseInPlace || hasVTag(g_inlinePropertyStorageObjectTag);
+#endif
+    if (UNLIKELY(shouldEraseInPlace)) {
+        ObjectPropertyValue* buffer = m_values.data();
+        for (size_t i = idx + 1; i < currentSize; i++) {
+            buffer[i - 1] = buffer[i];
+        }
+        buffer[currentSize - 1] = ObjectPropertyValue();
+        return;
+    }
+    m_values.erase(idx, currentSize);
+}
+
 Object::Object(ExecutionState& state, size_t propertyCount,
                std::pair<Value, Value> (*keyAndValueCallback)(ExecutionState& state, void* data), void* callbackData,
                bool isWritable, bool isEnumerable, bool isConfigurable)
@@ -738,6 +806,19 @@ bool Object::setPrototype(ExecutionState& state, const Value& proto)
 
 void Object::markAsPrototypeObject(ExecutionState& state)
 {
+    if (UNLIKELY(isInDictionaryMode())) {
+        // prototype chain with this object should be inline cacheable
+        leaveDictionaryMode();
+    }
+
+#if defined(ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+    if (hasVTag(g_inlinePropertyStorageObjectTag)) {
+        // prototype object is tagged by its vtag too, so values leave the body first
+        size_t propertyCount = m_structure->propertyCount();
+        ObjectPropertyValue* buffer = propertyCount ? GCUtil::gc_malloc_allocator<ObjectPropertyValue>().allocate(propertyCount) : nullptr;
+        static_cast<InlinePropertyStorageObject*>(this)->movePropertyValuesOut(buffer, propertyCount);
+    }
+#endif
     if (hasVTag(g_objectTag)) {
         writeVTag(g_prototypeObjectTag);
     } else {
@@ -790,13 +871,13 @@ bool Object::defineOwnPropertyMethod(ExecutionState& state, const ObjectProperty
         }
 
         auto structureBefore = m_structure;
-        m_structure = m_structure->addProperty(propertyName, desc.toObjectStructurePropertyDescriptor());
-        ASSERT(structureBefore != m_structure);
+        m_structure = m_structure->addProperty(state.context()->objectStructureStatistics(), propertyName, desc.toObjectStructurePropertyDescriptor());
+        ASSERT(structureBefore != m_structure || m_structure->isDictionaryStructure());
         if (LIKELY(desc.isDataProperty())) {
             const Value& val = desc.isValuePresent() ? desc.value() : Value();
-            m_values.pushBack(val, m_structure->propertyCount());
+            pushBackPropertyValue(val, m_structure->propertyCount());
         } else {
-            m_values.pushBack(Value(new JSGetterSetter(desc.getterSetter())), m_structure->propertyCount());
+            pushBackPropertyValue(Value(new JSGetterSetter(desc.getterSetter())), m_structure->propertyCount());
         }
 
         // ASSERT(m_values.size() == m_structure->propertyCount());
@@ -956,7 +1037,7 @@ bool Object::defineOwnProperty(ExecutionState& state, const ObjectPropertyName&
 {
     // this method should be called for pure Object,
     // not for derived Objects like PrototypeObject
-    ASSERT(hasVTag(g_objectTag));
+    ASSERT(isNonPrototypePlainObject());
     ASSERT(!isEverSetAsPrototypeObject());
 
     return defineOwnPropertyMethod(state, P, desc);
@@ -970,12 +1051,12 @@ void Object::directDefineOwnProperty(ExecutionState& state, const ObjectProperty
     ASSERT(isExtensible(state));
 
     ObjectStructurePropertyName propertyName = P.toObjectStructurePropertyName(state);
-    m_structure = m_structure->addProperty(propertyName, desc.toObjectStructurePropertyDescriptor());
+    m_structure = m_structure->addProperty(state.context()->objectStructureStatistics(), propertyName, desc.toObjectStructurePropertyDescriptor());
     if (LIKELY(desc.isDataProperty())) {
         const Value& val = desc.isValuePresent() ? desc.value() : Value();
-        m_values.pushBack(val, m_structure->propertyCount());
+        pushBackPropertyValue(val, m_structure->propertyCount());
     } else {
-        m_values.pushBack(Value(new JSGetterSetter(desc.getterSetter())), m_structure->propertyCount());
+        pushBackPropertyValue(Value(new JSGetterSetter(desc.getterSetter())), m_structure->propertyCount());
     }
 }
 
@@ -1121,6 +1202,125 @@ Object::OwnPropertyKeyAndDescVector Object::ownPropertyKeysFastPath(ExecutionSta
     return objectOwnPropertyKeys<Object::OwnPropertyKeyAndDescVector, OwnPropertyKeyAndDescResultResultBinder>(state, this);
 }
 
+bool Object::canCopyOwnPropertiesByStructure()
+{
+    // index names would be reordered and symbols come after strings in [[OwnPropertyKeys]]
+    if (!isPlainObject() || m_structure->hasIndexPropertyName() || m_structure->hasSymbolPropertyName()) {
+        return false;
+    }
+
+    size_t propertyCount = m_structure->propertyCount();
+    const ObjectStructureItem* properties = m_structure->properties();
+    for (size_t i = 0; i < propertyCount; i++) {
+        if (!properties[i].m_descriptor.isPlainDataProperty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Object::canShareStructureWithCopy()
+{
+    ASSERT(canCopyOwnPropertiesByStructure());
+    // structure in transition mode is never modified
+    if (!m_structure->inTransitionMode()) {
+        return false;
+    }
+
+    size_t propertyCount = m_structure->propertyCount();
+    const ObjectStructureItem* properties = m_structure->properties();
+    auto defaultDescriptor = ObjectStructurePropertyDescriptor::createDataDescriptor();
+    for (size_t i = 0; i < propertyCount; i++) {
+        if (properties[i].m_descriptor != defaultDescriptor) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Object::copyOwnPropertiesBySharingStructure(Object* source)
+{
+    ASSERT(isPlainObject() && !isInDictionaryMode() && !m_structure->propertyCount());
+    ASSERT(source->canCopyOwnPropertiesByStructure() && source->canShareStructureWithCopy());
+
+    size_t propertyCount = source->m_structure->propertyCount();
+    m_structure = source->m_structure;
+    if (!propertyCount) {
+        return;
+    }
+
+    // values are copied one by one instead of memcpy
+    // because number box in a slot is updated in place (see EncodedValue::operator=)
+    pushBackPropertyValue(Value(source->m_values[propertyCount - 1]), propertyCount);
+    for (size_t i = 0; i < propertyCount - 1; i++) {
+        m_values[i] = Value(source->m_values[i]);
+    }
+}
+
+void Object::assignOwnPropertiesByStructure(ExecutionState& state, Object* source)
+{
+    ASSERT(source->canCopyOwnPropertiesByStructure());
+    ObjectStructure* structure = source->m_structure;
+    size_t propertyCount = structure->propertyCount();
+
+    if (isNonPrototypePlainObject() && !m_structure->propertyCount() && isInlineCacheable() && isExtensible(state) && source->canShareStructureWithCopy()) {
+        // Set creates own data property of same order and attributes
+        // if there is no setter or read-only property on prototype chain
+        bool canShareStructure = true;
+        const ObjectStructureItem* properties = structure->properties();
+        for (size_t i = 0; i < propertyCount && canShareStructure; i++) {
+            Object* holder = Object::getPrototypeObject(state);
+            while (holder) {
+                if (!holder->isInlineCacheable()) {
+                    canShareStructure = false;
+                    break;
+                }
+                auto result = holder->m_structure->findProperty(properties[i].m_propertyName);
+                if (result.first != SIZE_MAX) {
+                    const auto& desc = result.second.value()->m_descriptor;
+                    canShareStructure = desc.isPlainDataProperty() && desc.isWritable();
+                    break;
+                }
+                holder = holder->Object::getPrototypeObject(state);
+            }
+        }
+
+        if (canShareStructure) {
+            copyOwnPropertiesBySharingStructure(source);
+            return;
+        }
+    }
+
+    // Set can call setter which modifies source
+    // structure in transition mode is never modified, but other structures can be modified in place
+    // so names are copied before calling Set
+    bool isStructureImmutable = structure->inTransitionMode();
+    VectorWithInlineStorage<32, ObjectStructurePropertyName, GCUtil::gc_malloc_allocator<ObjectStructurePropertyName>> names;
+    names.reserve(propertyCount);
+    for (size_t i = 0; i < propertyCount; i++) {
+        names.pushBack(structure->readProperty(i).m_propertyName);
+    }
+
+    for (size_t i = 0; i < propertyCount; i++) {
+        ObjectPropertyName propertyName(names[i]);
+        Value value;
+        if (LIKELY(isStructureImmutable && source->m_structure == structure)) {
+            // source is not changed yet
+            if (!structure->readProperty(i).m_descriptor.isEnumerable()) {
+                continue;
+            }
+            value = source->m_values[i];
+        } else {
+            auto desc = source->getOwnProperty(state, propertyName);
+            if (!desc.hasValue() || !desc.isEnumerable()) {
+                continue;
+            }
+            value = desc.value(state, source);
+        }
+        setThrowsException(state, propertyName, value, this);
+    }
+}
+
 Object::OwnPropertyKeyVector Object::ownPropertyKeys(ExecutionState& state)
 {
     return objectOwnPropertyKeys<Object::OwnPropertyKeyVector, OwnPropertyKeyResultResultBinder>(state, this);
@@ -1661,12 +1861,43 @@ ValueVector Object::createListFromArrayLike(ExecutionState& state, Value obj, ui
 
 void Object::deleteOwnProperty(ExecutionState& state, size_t idx)
 {
+    // removing a property from a large plain object means the object is used like a hash map
+    // prototype object is excluded because it should stay inline cacheable
+    if (UNLIKELY(!m_structure->isDictionaryStructure() && m_structure->propertyCount() >= ESCARGOT_OBJECT_STRUCTURE_DICTIONARY_MODE_MIN_SIZE
+                 && isNonPrototypePlainObject() && isInlineCacheable())) {
+        enterDictionaryMode();
+    }
+
     m_structure = m_structure->removeProperty(idx);
-    m_values.erase(idx, m_structure->propertyCount() + 1);
+    erasePropertyValue(idx, m_structure->propertyCount() + 1);
 
     // ASSERT(m_values.size() == m_structure->propertyCount());
 }
 
+void Object::enterDictionaryMode()
+{
+    ASSERT(!isInDictionaryMode());
+    // isInlineCacheable() returns false for this object from now on
+    // so the new structure is never referenced by inline caches
+    m_structure = ObjectStructureWithDictionary::create(m_structure);
+}
+
+void Object::leaveDictionaryMode()
+{
+    ASSERT(isInDictionaryMode());
+    m_structure = static_cast<ObjectStructureWithDictionary*>(m_structure)->convertToFastModeStructure();
+}
+
+bool Object::leaveDictionaryModeIfStable()
+{
+    ASSERT(isInDictionaryMode());
+    if (static_cast<ObjectStructureWithDictionary*>(m_structure)->isStable()) {
+        leaveDictionaryMode();
+        return true;
+    }
+    return false;
+}
+
 void Object::markAsNonInlineCachable()
 {
     ensureRareData()->m_isInlineCacheable = false;
@@ -1901,8 +2132,8 @@ bool Object::defineNativeDataAccessorProperty(ExecutionState& state, const Objec
     ASSERT(!hasOwnProperty(state, P));
     ASSERT(isExtensible(state));
 
-    m_structure = m_structure->addProperty(P.toObjectStructurePropertyName(state), ObjectStructurePropertyDescriptor::createDataButHasNativeGetterSetterDescriptor(data));
-    m_values.pushBack(objectInternalData, m_structure->propertyCount());
+    m_structure = m_structure->addProperty(state.context()->objectStructureStatistics(), P.toObjectStructurePropertyName(state), ObjectStructurePropertyDescriptor::createDataButHasNativeGetterSetterDescriptor(data));
+    pushBackPropertyValue(objectInternalData, m_structure->propertyCount());
 
     if (UNLIKELY(data->m_actsLikeJSGetterSetter)) {
         markAsNonInlineCachable();
@@ -2122,6 +2353,32 @@ ALWAYS_INLINE static void enumerableOwnPropertiesPushResult(ExecutionState& stat
 ValueVectorWithInlineStorage Object::enumerableOwnProperties(ExecutionState& state, Object* object, EnumerableOwnPropertiesType kind)
 {
     // https://www.ecma-international.org/ecma-262/8.0/#sec-enumerableownproperties
+    if (object->canCopyOwnPropertiesByStructure()) {
+        // FASTER PATH
+        // no user code runs here, so keys and values are read by structure iteration
+        // without constructing ObjectPropertyName and calling [[Get]]
+        ObjectStructure* structure = object->m_structure;
+        size_t propertyCount = structure->propertyCount();
+        const ObjectStructureItem* items = structure->properties();
+        ValueVectorWithInlineStorage properties;
+        properties.reserve(propertyCount);
+        for (size_t i = 0; i < propertyCount; i++) {
+            if (!items[i].m_descriptor.isEnumerable()) {
+                continue;
+            }
+            if (kind == EnumerableOwnPropertiesType::Key) {
+                properties.pushBack(items[i].m_propertyName.toValue());
+            } else if (kind == EnumerableOwnPropertiesType::Value) {
+                properties.pushBack(object->m_values[i]);
+            } else {
+                ASSERT(kind == EnumerableOwnPropertiesType::KeyAndValue);
+                Value v[2] = { items[i].m_propertyName.toValue(), object->m_values[i] };
+                properties.pushBack(Object::createArrayFromList(state, 2, v));
+            }
+        }
+        return properties;
+    }
+
     if (object->canUseOwnPropertyKeysFastPath()) {
         // FAST PATH
         Object::OwnPropertyKeyAndDescVector ownKeysAndDesc = object->ownPropertyKeysFastPath(state);
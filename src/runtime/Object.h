@@ -77,6 +77,7 @@ struct ObjectRareData : public PointerValue {
     bool m_isFinalizerRegistered : 1;
     bool m_isInlineCacheable : 1;
     bool m_hasExtendedExtraData : 1;
+    bool m_arrayObjectHasGenericElements : 1;
 #if defined(ESCARGOT_ENABLE_TEST)
     bool m_isHTMLDDA : 1;
 #endif
@@ -89,6 +90,8 @@ struct ObjectRareData : public PointerValue {
     union {
         Object* m_internalSlot;
         StorePositiveNumberAsOddNumber m_arrayObjectFastModeBufferCapacity;
+        // unboxed elements of double mode array. capacity is computed from GC_size of the buffer
+        double* m_arrayObjectFastModeDoubleData;
     };
     explicit ObjectRareData(Object* obj);
 
@@ -747,6 +750,21 @@ private:
 
 #define ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER 0
 
+// plain objects whose property count is known when they are allocated
+// can keep their property values in the object body (see InlinePropertyStorageObject).
+// this saves an allocation per object, but property access still loads m_values first:
+// inline storage is chosen per object, so objects sharing an ObjectStructure may keep values
+// in different places and inline caches keyed by ObjectStructure cannot encode the slot location
+// EncodedSmallValue needs custom marking, so 32bit-in-64bit builds always use a separate buffer
+#if !(defined(ESCARGOT_64) && defined(ESCARGOT_USE_32BIT_IN_64BIT))
+#define ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE
+#if defined(ESCARGOT_SMALL_CONFIG)
+#define ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE_MAX_SIZE 4
+#else
+#define ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE_MAX_SIZE 8
+#endif
+#endif
+
 enum class EnumerableOwnPropertiesType {
     Key,
     Value,
@@ -771,11 +789,16 @@ class Object : public PointerValue {
     friend class GlobalObject;
     friend class Interpreter;
     friend class InterpreterSlowPath;
+    friend class MegamorphicPropertyCache;
+    friend class ObjectKeysCache;
     friend class EnumerateObjectWithDestruction;
     friend class EnumerateObjectWithIteration;
     friend struct ObjectRareData;
     friend class Template;
     friend class ObjectTemplate;
+    friend class ScriptFunctionObject;
+    friend class ScriptClassConstructorFunctionObject;
+    friend class InlinePropertyStorageObject;
 
 public:
     explicit Object(ExecutionState& state);
@@ -908,6 +931,16 @@ public:
     }
     OwnPropertyKeyAndDescVector ownPropertyKeysFastPath(ExecutionState& state);
 
+    // every own property is a plain data property and structure order is same as [[OwnPropertyKeys]] order
+    // so own properties can be copied by iterating structure and m_values without [[Get]]
+    bool canCopyOwnPropertiesByStructure();
+    // a copy made by CreateDataProperty or Set of every property would have the same structure
+    bool canShareStructureWithCopy();
+    // copy every property of source into this empty object by sharing structure of source
+    void copyOwnPropertiesBySharingStructure(Object* source);
+    // Object.assign(this, source) for source which canCopyOwnPropertiesByStructure
+    void assignOwnPropertiesByStructure(ExecutionState& state, Object* source);
+
     ObjectGetResult get(ExecutionState& state, const ObjectPropertyName& P)
     {
         return get(state, P, Value(this));
@@ -977,12 +1010,20 @@ public:
 
     virtual bool isInlineCacheable()
     {
+        if (UNLIKELY(m_structure->isDictionaryStructure())) {
+            return false;
+        }
         if (UNLIKELY(hasRareData())) {
             return rareData()->m_isInlineCacheable;
         }
         return true;
     }
 
+    bool isInDictionaryMode() const
+    {
+        return m_structure->isDictionaryStructure();
+    }
+
     ObjectRareData* ensureRareData()
     {
         if (!hasRareData()) {
@@ -1205,6 +1246,9 @@ protected:
     }
 
     explicit Object(ExecutionState& state, Object* proto, size_t defaultSpace);
+    // allocate plain object keeping `inlineStorageSize` property values in its body
+    // returns nullptr if inline storage is not available (see ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+    static Object* tryCreateWithInlinePropertyStorage(ExecutionState& state, Object* proto, size_t inlineStorageSize);
     // ctor for ObjectTemplate
     explicit Object(ObjectStructure* structure, ObjectPropertyValueVector&& values, Object* proto);
 
@@ -1237,6 +1281,24 @@ protected:
         return rd->m_extendedExtraData;
     }
 
+#if defined(ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+    void pushBackPropertyValueSlowCase(const ObjectPropertyValue& value, size_t newSize);
+#endif
+
+    // every property value addition or removal on an existing object should use these
+    // instead of touching m_values directly, so inline storage is never reallocated or freed
+    ALWAYS_INLINE void pushBackPropertyValue(const ObjectPropertyValue& value, size_t newSize)
+    {
+#if defined(ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+        if (UNLIKELY(hasVTag(g_inlinePropertyStorageObjectTag))) {
+            pushBackPropertyValueSlowCase(value, newSize);
+            return;
+        }
+#endif
+        m_values.pushBack(value, newSize);
+    }
+    void erasePropertyValue(size_t idx, size_t currentSize);
+
     ObjectStructure* m_structure;
     Object* m_prototype;
     ObjectPropertyValueVector m_values;
@@ -1339,6 +1401,12 @@ protected:
 
     void deleteOwnProperty(ExecutionState& state, size_t idx);
 
+    // plain object used like a hash map owns a mutable structure (see ObjectStructureWithDictionary)
+    void enterDictionaryMode();
+    void leaveDictionaryMode();
+    // returns true when the object went back to fast mode
+    bool leaveDictionaryModeIfStable();
+
     void markAsNonInlineCachable();
 
     void tryToShrinkFinalizers();
@@ -1379,6 +1447,49 @@ protected:
     {
     }
 };
+
+#if defined(ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE)
+// plain object keeping its property values in its body, right after m_inlinePropertyValueCapacity
+// its own tag tells that m_values points to the inline slots, so no address compare is needed.
+// once the values move out of the body, the tag is rewritten to the tag of Object
+// and the object behaves exactly like an Object (the unused slots stay as a dead tail)
+class InlinePropertyStorageObject : public Object {
+    friend class Global;
+
+public:
+    static InlinePropertyStorageObject* create(ExecutionState& state, Object* proto, size_t capacity);
+
+    size_t inlinePropertyValueCapacity() const
+    {
+        return m_inlinePropertyValueCapacity;
+    }
+
+    ObjectPropertyValue* inlinePropertyValueStorage()
+    {
+        return reinterpret_cast<ObjectPropertyValue*>(this + 1);
+    }
+
+    // move `size` values to `buffer` and turn this object into an Object
+    void movePropertyValuesOut(ObjectPropertyValue* buffer, size_t size);
+
+private:
+    InlinePropertyStorageObject()
+        : Object()
+        , m_inlinePropertyValueCapacity(0)
+    {
+        // dummy default constructor
+        // only called by Global::initialize to set tag value
+    }
+
+    InlinePropertyStorageObject(ExecutionState& state, Object* proto, size_t capacity)
+        : Object(state, proto, 0)
+        , m_inlinePropertyValueCapacity(capacity)
+    {
+    }
+
+    size_t m_inlinePropertyValueCapacity;
+};
+#endif
 } // namespace Escargot
 
 #endif
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#include "Escargot.h"
+#include "ObjectKeysCache.h"
+#include "runtime/ArrayObject.h"
+
+namespace Escargot {
+
+NEVER_INLINE void ObjectKeysCache::fillEntry(ExecutionState& state, Entry& entry, Object* obj)
+{
+    ObjectStructure* structure = obj->structure();
+    auto keys = Object::enumerableOwnProperties(state, obj, EnumerableOwnPropertiesType::Key);
+    // collecting keys of plain object never runs user code
+    ASSERT(obj->structure() == structure);
+
+    size_t keyCount = keys.size();
+    Value* buffer = nullptr;
+    if (keyCount) {
+        buffer = reinterpret_cast<Value*>(GC_MALLOC(sizeof(Value) * keyCount));
+        for (size_t i = 0; i < keyCount; i++) {
+            buffer[i] = keys[i];
+        }
+    }
+
+    structure->markReferencedByInlineCache();
+    entry.m_structure = structure;
+    entry.m_keys = buffer;
+    entry.m_keyCount = keyCount;
+}
+
+} // namespace Escargot
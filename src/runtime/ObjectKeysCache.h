@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotObjectKeysCache__
+#define __EscargotObjectKeysCache__
+
+#include "runtime/Object.h"
+#include "runtime/ObjectStructure.h"
+
+namespace Escargot {
+
+// fixed size cache of Object.keys result shared by a Context
+// own keys of plain object are decided by its structure only, so entry is keyed by structure
+// cached structure is marked as referenced by inline cache, so it is never modified in place
+class ObjectKeysCache : public gc {
+public:
+    static constexpr size_t CacheSize = 64;
+
+    ObjectKeysCache()
+        : m_entries()
+    {
+    }
+
+    ArrayObject* keys(ExecutionState& state, Object* obj)
+    {
+        ASSERT(obj->isPlainObject() && obj->isInlineCacheable());
+        ObjectStructure* structure = obj->structure();
+        Entry& entry = m_entries[entryIndex(structure)];
+        if (UNLIKELY(entry.m_structure != structure)) {
+            fillEntry(state, entry, obj);
+        }
+        // result array should be a new array every time
+        return Object::createArrayFromList(state, entry.m_keyCount, entry.m_keys);
+    }
+
+private:
+    struct Entry {
+        Entry()
+            : m_structure(nullptr)
+            , m_keys(nullptr)
+            , m_keyCount(0)
+        {
+        }
+
+        ObjectStructure* m_structure;
+        Value* m_keys;
+        size_t m_keyCount;
+    };
+
+    static ALWAYS_INLINE size_t entryIndex(ObjectStructure* structure)
+    {
+        return (reinterpret_cast<size_t>(structure) >> 4) & (CacheSize - 1);
+    }
+
+    void fillEntry(ExecutionState& state, Entry& entry, Object* obj);
+
+    Entry m_entries[CacheSize];
+};
+
+} // namespace Escargot
+
+#endif
@@ -288,19 +288,38 @@ size_t ObjectStructureWithTransition::propertyCount() const
     return m_properties.size();
 }
 
+ObjectStructure* ObjectStructure::addProperty(ObjectStructureStatistics& statistics, const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc)
+{
+    if (inTransitionMode()) {
+        return static_cast<ObjectStructureWithTransition*>(this)->addPropertyWithTransition(name, desc, &statistics);
+    }
+
+    ObjectStructure* newStructure = addProperty(name, desc);
+    if (newStructure != this) {
+        statistics.m_structureCount++;
+        statistics.m_byteSize += GC_size(newStructure);
+    }
+    return newStructure;
+}
+
 ObjectStructure* ObjectStructureWithTransition::addProperty(const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc)
+{
+    return addPropertyWithTransition(name, desc, nullptr);
+}
+
+ObjectStructure* ObjectStructureWithTransition::addPropertyWithTransition(const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc, ObjectStructureStatistics* statistics)
 {
     if (m_doesTransitionTableUseMap) {
         auto iter = m_transitionTableMap->find(ObjectStructureTransitionMapItem(name, desc));
-        if (iter != m_transitionTableMap->end()) {
-            return iter->second;
+        if (iter != m_transitionTableMap->end() && iter->second.get()) {
+            return iter->second.get();
         }
     } else {
         size_t len = m_transitionTableVectorBufferSize;
         for (size_t i = 0; i < len; i++) {
             const auto& item = m_transitionTableVectorBuffer[i];
-            if (item.m_descriptor == desc && item.m_propertyName == name) {
-                return item.m_structure;
+            if (item.m_descriptor == desc && item.m_propertyName == name && item.m_structure.get()) {
+                return item.m_structure.get();
             }
         }
     }
@@ -318,17 +337,60 @@ ObjectStructure* ObjectStructureWithTransition::addProperty(const ObjectStructur
     if (nextSize > ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE || nameIsIndexString) {
         ObjectStructureItemVector* newProperties = new ObjectStructureItemVector(m_properties, newItem);
         newObjectStructure = new ObjectStructureWithoutTransition(newProperties, nameIsIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
+        if (statistics) {
+            statistics->m_structureCount++;
+            statistics->m_byteSize += sizeof(ObjectStructureWithoutTransition) + nextSize * sizeof(ObjectStructureItem);
+        }
     } else {
-        ObjectStructureItemTightVector newProperties(m_properties, newItem);
+        // the first transition appends its item to our item buffer if there is room
+        // so a chain of transitions shares one buffer instead of copying every prefix
+        ObjectStructureItem* buffer = m_properties.data();
+        if (!buffer || m_isPropertyBufferExtendedByTransition || GC_size(buffer) < nextSize * sizeof(ObjectStructureItem)) {
+            size_t capacity = std::min(computeVectorAllocateSize(nextSize), (size_t)ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE);
+            ObjectStructureItem* newBuffer = GCUtil::gc_malloc_allocator<ObjectStructureItem>().allocate(capacity);
+            if (m_properties.size()) {
+                memcpy(newBuffer, buffer, m_properties.size() * sizeof(ObjectStructureItem));
+            }
+            buffer = newBuffer;
+            if (statistics) {
+                statistics->m_byteSize += capacity * sizeof(ObjectStructureItem);
+            }
+        } else {
+            m_isPropertyBufferExtendedByTransition = true;
+        }
+        buffer[nextSize - 1] = newItem;
+
+        ObjectStructureItemTightVector newProperties;
+        newProperties.reset(buffer, nextSize);
         newObjectStructure = new ObjectStructureWithTransition(std::move(newProperties), nameIsIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
+        // transition table does not keep newObjectStructure alive
+        // finalizer clears the transition when no object or cache uses newObjectStructure anymore
+        // this and the transition key are kept alive by the finalizer data until then
+        GC_REGISTER_FINALIZER_NO_ORDER(newObjectStructure, transitionTargetFinalizer, new ObjectStructureTransitionFinalizerData(this, name, desc), nullptr, nullptr);
         ObjectStructureTransitionVectorItem newTransitionItem(name, desc, newObjectStructure);
+        if (statistics) {
+            statistics->m_structureCount++;
+            statistics->m_transitionCount++;
+            statistics->m_byteSize += sizeof(ObjectStructureWithTransition);
+        }
 
+        // NOTE allocation can run finalizers which clear transitions of this structure
+        // so transition table should not be read across allocation
         if (m_doesTransitionTableUseMap) {
-            m_transitionTableMap->insert(std::make_pair(ObjectStructureTransitionMapItem(newTransitionItem.m_propertyName, newTransitionItem.m_descriptor),
-                                                        newTransitionItem.m_structure));
+            (*m_transitionTableMap)[ObjectStructureTransitionMapItem(newTransitionItem.m_propertyName, newTransitionItem.m_descriptor)] = newTransitionItem.m_structure;
         } else {
+            // reuse a cleared transition first
+            for (size_t i = 0; i < m_transitionTableVectorBufferSize; i++) {
+                if (!m_transitionTableVectorBuffer[i].m_structure.get()) {
+                    m_transitionTableVectorBuffer[i] = newTransitionItem;
+                    return newObjectStructure;
+                }
+            }
+
             if (m_transitionTableVectorBufferSize + 1 > ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MAP_MIN_SIZE) {
                 ObjectStructureTransitionTableMap* transitionTableMap = new (GC) ObjectStructureTransitionTableMap();
+                // reserve ahead so that moving items allocates nothing
+                transitionTableMap->reserve(m_transitionTableVectorBufferSize + 1);
                 for (size_t i = 0; i < m_transitionTableVectorBufferSize; i++) {
                     transitionTableMap->insert(std::make_pair(ObjectStructureTransitionMapItem(m_transitionTableVectorBuffer[i].m_propertyName, m_transitionTableVectorBuffer[i].m_descriptor),
                                                               m_transitionTableVectorBuffer[i].m_structure));
@@ -355,6 +417,31 @@ ObjectStructure* ObjectStructureWithTransition::addProperty(const ObjectStructur
     return newObjectStructure;
 }
 
+void ObjectStructureWithTransition::transitionTargetFinalizer(void* obj, void* data)
+{
+    ObjectStructureTransitionFinalizerData* finalizerData = reinterpret_cast<ObjectStructureTransitionFinalizerData*>(data);
+    finalizerData->m_from->clearTransition(reinterpret_cast<ObjectStructure*>(obj), finalizerData->m_propertyName, finalizerData->m_descriptor);
+}
+
+void ObjectStructureWithTransition::clearTransition(ObjectStructure* to, const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc)
+{
+    // this runs while allocating, so it only clears the target and never reshapes the table
+    // buffers only reachable from `to` may be reclaimed already, so `to` is compared but never read
+    if (m_doesTransitionTableUseMap) {
+        auto iter = m_transitionTableMap->find(ObjectStructureTransitionMapItem(name, desc));
+        if (iter != m_transitionTableMap->end() && iter->second.get() == to) {
+            iter.value() = ObjectStructureTransitionTarget();
+        }
+    } else {
+        for (size_t i = 0; i < m_transitionTableVectorBufferSize; i++) {
+            if (m_transitionTableVectorBuffer[i].m_structure.get() == to) {
+                m_transitionTableVectorBuffer[i].m_structure = ObjectStructureTransitionTarget();
+                break;
+            }
+        }
+    }
+}
+
 ObjectStructure* ObjectStructureWithTransition::removeProperty(size_t pIndex)
 {
     ObjectStructureItemVector* newProperties = new ObjectStructureItemVector();
@@ -514,4 +601,250 @@ ObjectStructure* ObjectStructureWithMap::replacePropertyDescriptor(size_t idx, c
     newProperties->at(idx).m_descriptor = newDesc;
     return new ObjectStructureWithMap(newProperties, newPropertyNameMap, m_hasIndexPropertyName, m_hasSymbolPropertyName, m_hasEnumerableProperty);
 }
+
+void* ObjectStructureWithDictionary::operator new(size_t size)
+{
+    static MAY_THREAD_LOCAL bool typeInited = false;
+    static MAY_THREAD_LOCAL GC_descr descr;
+    if (!typeInited) {
+        GC_word obj_bitmap[GC_BITMAP_SIZE(ObjectStructureWithDictionary)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithDictionary, m_properties));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithDictionary, m_buckets));
+        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectStructureWithDictionary));
+        typeInited = true;
+    }
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+
+ObjectStructureWithDictionary::ObjectStructureWithDictionary(ObjectStructureItemVector* properties, bool hasIndexPropertyName,
+                                                             bool hasSymbolPropertyName, bool hasNonAtomicPropertyName, bool hasEnumerableProperty)
+    : ObjectStructure(hasIndexPropertyName,
+                      hasSymbolPropertyName, hasNonAtomicPropertyName, hasEnumerableProperty)
+    , m_properties(properties)
+    , m_buckets(nullptr)
+    , m_bucketCapacity(0)
+    , m_usedBucketCount(0)
+    , m_lookupCountAfterLastModification(0)
+{
+    m_isDictionary = true;
+
+    size_t capacity = 8;
+    while (capacity < m_properties->size() * 2) {
+        capacity <<= 1;
+    }
+    rehash(capacity);
+}
+
+ObjectStructureWithDictionary* ObjectStructureWithDictionary::create(ObjectStructure* from)
+{
+    ASSERT(!from->isDictionaryStructure());
+    size_t propertyCount = from->propertyCount();
+    const ObjectStructureItem* properties = from->properties();
+
+    ObjectStructureItemVector* newProperties = new ObjectStructureItemVector();
+    bool hasIndexString = false;
+    bool hasSymbol = false;
+    bool hasNonAtomicName = false;
+    bool hasEnumerableProperty = false;
+    if (propertyCount) {
+        newProperties->resizeWithUninitializedValues(propertyCount);
+        memcpy(newProperties->data(), properties, propertyCount * sizeof(ObjectStructureItem));
+        for (size_t i = 0; i < propertyCount; i++) {
+            hasIndexString = hasIndexString | properties[i].m_propertyName.isIndexString();
+            hasSymbol = hasSymbol | properties[i].m_propertyName.isSymbol();
+            hasNonAtomicName = hasNonAtomicName | !properties[i].m_propertyName.hasAtomicString();
+            hasEnumerableProperty = hasEnumerableProperty | properties[i].m_descriptor.isEnumerable();
+        }
+    }
+
+    return new ObjectStructureWithDictionary(newProperties, hasIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
+}
+
+size_t ObjectStructureWithDictionary::findBucket(const ObjectStructurePropertyName& name) const
+{
+    size_t mask = m_bucketCapacity - 1;
+    size_t pos = bucketHash(name) & mask;
+    // there is always an empty bucket because the table is kept less than 3/4 full
+    while (true) {
+        const Bucket& bucket = m_buckets[pos];
+        if (bucket.m_index == EmptyBucketIndex) {
+            return SIZE_MAX;
+        }
+        if (bucket.m_index != DeletedBucketIndex && bucket.m_name == name) {
+            return pos;
+        }
+        pos = (pos + 1) & mask;
+    }
+}
+
+void ObjectStructureWithDictionary::insertBucket(const ObjectStructurePropertyName& name, size_t index)
+{
+    ASSERT(findBucket(name) == SIZE_MAX);
+    size_t mask = m_bucketCapacity - 1;
+    size_t pos = bucketHash(name) & mask;
+    // deleted bucket can be reused
+    while (m_buckets[pos].m_index < DeletedBucketIndex) {
+        pos = (pos + 1) & mask;
+    }
+    if (m_buckets[pos].m_index == EmptyBucketIndex) {
+        m_usedBucketCount++;
+    }
+    m_buckets[pos].m_name = name;
+    m_buckets[pos].m_index = index;
+}
+
+void ObjectStructureWithDictionary::rehash(size_t newCapacity)
+{
+    ASSERT(newCapacity && !(newCapacity & (newCapacity - 1)));
+    ASSERT(m_properties->size() * 4 < newCapacity * 3);
+
+    if (m_buckets) {
+        GCUtil::gc_malloc_allocator<Bucket>().deallocate(m_buckets, m_bucketCapacity);
+    }
+    m_buckets = GCUtil::gc_malloc_allocator<Bucket>().allocate(newCapacity);
+    m_bucketCapacity = newCapacity;
+    m_usedBucketCount = 0;
+    for (size_t i = 0; i < newCapacity; i++) {
+        m_buckets[i].m_name = ObjectStructurePropertyName();
+        m_buckets[i].m_index = EmptyBucketIndex;
+    }
+
+    // deleted buckets are dropped here
+    size_t propertyCount = m_properties->size();
+    for (size_t i = 0; i < propertyCount; i++) {
+        insertBucket((*m_properties)[i].m_propertyName, i);
+    }
+}
+
+ObjectStructureWithDictionary* ObjectStructureWithDictionary::structureForModification()
+{
+    m_lookupCountAfterLastModification = 0;
+    if (LIKELY(!m_isReferencedByInlineCache)) {
+        return this;
+    }
+
+    // an enumeration holds this structure to detect modification of the object
+    // and can still read it, so modification goes to a copy
+    ObjectStructureWithDictionary* newStructure = new ObjectStructureWithDictionary(*this);
+    newStructure->m_isReferencedByInlineCache = false;
+    newStructure->m_properties = new ObjectStructureItemVector(*m_properties);
+    newStructure->m_buckets = GCUtil::gc_malloc_allocator<Bucket>().allocate(m_bucketCapacity);
+    memcpy(static_cast<void*>(newStructure->m_buckets), m_buckets, m_bucketCapacity * sizeof(Bucket));
+    return newStructure;
+}
+
+std::pair<size_t, Optional<const ObjectStructureItem*>> ObjectStructureWithDictionary::findProperty(const ObjectStructurePropertyName& s)
+{
+    if (m_lookupCountAfterLastModification < ESCARGOT_OBJECT_STRUCTURE_DICTIONARY_MODE_STABLE_LOOKUP_COUNT) {
+        m_lookupCountAfterLastModification++;
+    }
+
+    size_t pos = findBucket(s);
+    if (pos == SIZE_MAX) {
+        return std::make_pair(SIZE_MAX, Optional<const ObjectStructureItem*>());
+    }
+    size_t idx = m_buckets[pos].m_index;
+    return std::make_pair(idx, &(*m_properties)[idx]);
+}
+
+const ObjectStructureItem& ObjectStructureWithDictionary::readProperty(size_t idx)
+{
+    return m_properties->at(idx);
+}
+
+const ObjectStructureItem* ObjectStructureWithDictionary::properties() const
+{
+    return m_properties->data();
+}
+
+size_t ObjectStructureWithDictionary::propertyCount() const
+{
+    return m_properties->size();
+}
+
+ObjectStructure* ObjectStructureWithDictionary::addProperty(const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc)
+{
+    ObjectStructureWithDictionary* self = structureForModification();
+    self->m_hasIndexPropertyName = self->m_hasIndexPropertyName || name.isIndexString();
+    self->m_hasSymbolPropertyName = self->m_hasSymbolPropertyName || name.isSymbol();
+    self->m_hasNonAtomicPropertyName = self->m_hasNonAtomicPropertyName || !name.hasAtomicString();
+    self->m_hasEnumerableProperty = self->m_hasEnumerableProperty || desc.isEnumerable();
+
+    size_t newIndex = self->m_properties->size();
+    self->m_properties->push_back(ObjectStructureItem(name, desc));
+
+    if ((self->m_usedBucketCount + 1) * 4 > self->m_bucketCapacity * 3) {
+        size_t capacity = 8;
+        while (capacity < self->m_properties->size() * 2) {
+            capacity <<= 1;
+        }
+        self->rehash(capacity);
+    } else {
+        self->insertBucket(name, newIndex);
+    }
+
+    return self;
+}
+
+ObjectStructure* ObjectStructureWithDictionary::removeProperty(size_t pIndex)
+{
+    ObjectStructureWithDictionary* self = structureForModification();
+    ObjectStructureItemVector& properties = *self->m_properties;
+    size_t ps = properties.size();
+    ASSERT(pIndex < ps);
+
+    size_t pos = self->findBucket(properties[pIndex].m_propertyName);
+    ASSERT(pos != SIZE_MAX);
+    self->m_buckets[pos].m_name = ObjectStructurePropertyName();
+    self->m_buckets[pos].m_index = DeletedBucketIndex;
+
+    if (pIndex + 1 < ps) {
+        // keep insertion order of following properties
+        // only the buckets of the shifted properties are updated
+        memmove(&properties[pIndex], &properties[pIndex + 1], (ps - pIndex - 1) * sizeof(ObjectStructureItem));
+        for (size_t i = pIndex; i < ps - 1; i++) {
+            size_t shiftedPos = self->findBucket(properties[i].m_propertyName);
+            ASSERT(shiftedPos != SIZE_MAX && self->m_buckets[shiftedPos].m_index == i + 1);
+            self->m_buckets[shiftedPos].m_index = i;
+        }
+    }
+    // clear the vacated item not to keep its name alive
+    memset(static_cast<void*>(&properties[ps - 1]), 0, sizeof(ObjectStructureItem));
+    properties.resizeWithUninitializedValues(ps - 1);
+
+    // flags are kept conservatively until convertToFastModeStructure
+    return self;
+}
+
+ObjectStructure* ObjectStructureWithDictionary::replacePropertyDescriptor(size_t idx, const ObjectStructurePropertyDescriptor& newDesc)
+{
+    ObjectStructureWithDictionary* self = structureForModification();
+    self->m_properties->at(idx).m_descriptor = newDesc;
+    self->m_hasEnumerableProperty = self->m_hasEnumerableProperty || newDesc.isEnumerable();
+    return self;
+}
+
+ObjectStructure* ObjectStructureWithDictionary::convertToFastModeStructure()
+{
+    // this structure is left intact because an enumeration can still hold it
+    ObjectStructureItemVector* properties = new ObjectStructureItemVector(*m_properties);
+    size_t ps = properties->size();
+
+    bool hasIndexString = false;
+    bool hasSymbol = false;
+    bool hasNonAtomicName = false;
+    bool hasEnumerableProperty = false;
+    for (size_t i = 0; i < ps; i++) {
+        hasIndexString = hasIndexString | (*properties)[i].m_propertyName.isIndexString();
+        hasSymbol = hasSymbol | (*properties)[i].m_propertyName.isSymbol();
+        hasNonAtomicName = hasNonAtomicName | !(*properties)[i].m_propertyName.hasAtomicString();
+        hasEnumerableProperty = hasEnumerableProperty | (*properties)[i].m_descriptor.isEnumerable();
+    }
+
+    if (ps > ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE) {
+        return new ObjectStructureWithMap(properties, nullptr, hasIndexString, hasSymbol, hasEnumerableProperty);
+    } else {
+        return new ObjectStructureWithoutTransition(properties, hasIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
+    }
+}
 } // namespace Escargot
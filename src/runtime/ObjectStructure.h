@@ -28,6 +28,7 @@
 namespace Escargot {
 
 class ObjectStructure;
+class ObjectStructureWithTransition;
 
 struct ObjectStructureItem : public gc {
     ObjectStructureItem(const ObjectStructurePropertyName& as, const ObjectStructurePropertyDescriptor& desc)
@@ -40,10 +41,29 @@ struct ObjectStructureItem : public gc {
     ObjectStructurePropertyDescriptor m_descriptor;
 };
 
+// structure reached by a transition
+// the pointer is hidden from GC so transition tables do not keep unused structures alive
+// it is cleared by the finalizer of the structure (see ObjectStructureWithTransition::addProperty)
+class ObjectStructureTransitionTarget {
+public:
+    ObjectStructureTransitionTarget(ObjectStructure* structure = nullptr)
+        : m_hiddenStructure(structure ? ~reinterpret_cast<uintptr_t>(structure) : 0)
+    {
+    }
+
+    ObjectStructure* get() const
+    {
+        return m_hiddenStructure ? reinterpret_cast<ObjectStructure*>(~m_hiddenStructure) : nullptr;
+    }
+
+private:
+    uintptr_t m_hiddenStructure;
+};
+
 struct ObjectStructureTransitionVectorItem : public gc {
     ObjectStructurePropertyName m_propertyName;
     ObjectStructurePropertyDescriptor m_descriptor;
-    ObjectStructure* m_structure;
+    ObjectStructureTransitionTarget m_structure;
 
     ObjectStructureTransitionVectorItem(const ObjectStructurePropertyName& as, const ObjectStructurePropertyDescriptor& desc, ObjectStructure* structure)
         : m_propertyName(as)
@@ -64,8 +84,23 @@ struct ObjectStructureTransitionMapItem : public gc {
     }
 };
 
-typedef HashMap<ObjectStructureTransitionMapItem, ObjectStructure*, std::hash<ObjectStructureTransitionMapItem>,
-                std::equal_to<ObjectStructureTransitionMapItem>, GCUtil::gc_malloc_allocator<std::pair<ObjectStructureTransitionMapItem const, ObjectStructure*>>>
+// client data of the transition target finalizer
+// holds the transition key so that the finalizer never reads the dying target structure
+struct ObjectStructureTransitionFinalizerData : public gc {
+    ObjectStructureWithTransition* m_from;
+    ObjectStructurePropertyName m_propertyName;
+    ObjectStructurePropertyDescriptor m_descriptor;
+
+    ObjectStructureTransitionFinalizerData(ObjectStructureWithTransition* from, const ObjectStructurePropertyName& as, const ObjectStructurePropertyDescriptor& desc)
+        : m_from(from)
+        , m_propertyName(as)
+        , m_descriptor(desc)
+    {
+    }
+};
+
+typedef HashMap<ObjectStructureTransitionMapItem, ObjectStructureTransitionTarget, std::hash<ObjectStructureTransitionMapItem>,
+                std::equal_to<ObjectStructureTransitionMapItem>, GCUtil::gc_malloc_allocator<std::pair<ObjectStructureTransitionMapItem const, ObjectStructureTransitionTarget>>>
     ObjectStructureTransitionTableMap;
 
 typedef TightVector<ObjectStructureItem, GCUtil::gc_malloc_allocator<ObjectStructureItem>> ObjectStructureItemTightVector;
@@ -119,8 +154,32 @@ public:
 #endif
 #endif
 
+#ifndef ESCARGOT_OBJECT_STRUCTURE_DICTIONARY_MODE_MIN_SIZE
+#define ESCARGOT_OBJECT_STRUCTURE_DICTIONARY_MODE_MIN_SIZE 16
+#endif
+#ifndef ESCARGOT_OBJECT_STRUCTURE_DICTIONARY_MODE_STABLE_LOOKUP_COUNT
+#define ESCARGOT_OBJECT_STRUCTURE_DICTIONARY_MODE_STABLE_LOOKUP_COUNT 256
+#endif
+
 COMPILE_ASSERT(ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE < 65536, "");
 
+// counts of structures created while adding properties to objects of a context (see Context::objectStructureStatistics)
+// structures are shared by every context of the VMInstance, so each structure is counted by the context which created it
+struct ObjectStructureStatistics {
+    size_t m_structureCount;
+    size_t m_transitionCount;
+    // structures and property item buffers allocated for them
+    // item buffer shared along a transition chain is counted once
+    size_t m_byteSize;
+
+    ObjectStructureStatistics()
+        : m_structureCount(0)
+        , m_transitionCount(0)
+        , m_byteSize(0)
+    {
+    }
+};
+
 class ObjectStructure : public gc {
 public:
     virtual ~ObjectStructure() {}
@@ -143,6 +202,9 @@ public:
         return addProperty(name, desc);
     }
 
+    // same as addProperty, but a newly created structure is counted into statistics
+    ObjectStructure* addProperty(ObjectStructureStatistics& statistics, const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc);
+
     virtual std::pair<size_t, Optional<const ObjectStructureItem*>> findProperty(const ObjectStructurePropertyName& s) = 0;
     virtual const ObjectStructureItem& readProperty(size_t idx) = 0;
     virtual const ObjectStructureItem* properties() const = 0;
@@ -166,6 +228,20 @@ public:
         m_isReferencedByInlineCache = true;
     }
 
+    // dictionary structure is mutated in place
+    // so an enumeration which detects modification by structure identity should mark it
+    void markReferencedByEnumeration()
+    {
+        if (UNLIKELY(m_isDictionary)) {
+            m_isReferencedByInlineCache = true;
+        }
+    }
+
+    bool isDictionaryStructure() const
+    {
+        return m_isDictionary;
+    }
+
     bool hasIndexPropertyName() const
     {
         return m_hasIndexPropertyName;
@@ -187,12 +263,15 @@ public:
     }
 
     bool hasSamePropertiesTo(const ObjectStructure* src) const
+    {
+        return hasSamePropertiesTo(src->properties(), src->propertyCount());
+    }
+
+    bool hasSamePropertiesTo(const ObjectStructureItem* srcProperties, size_t srcCount) const
     {
         size_t myCount = propertyCount();
-        size_t srcCount = src->propertyCount();
         if (myCount == srcCount) {
             auto myProperties = properties();
-            auto srcProperties = src->properties();
             for (size_t j = 0; j < myCount; j++) {
                 if (myProperties[j].m_propertyName != srcProperties[j].m_propertyName || myProperties[j].m_descriptor != srcProperties[j].m_descriptor) {
                     return false;
@@ -212,6 +291,8 @@ protected:
         , m_hasNonAtomicPropertyName(false)
         , m_hasEnumerableProperty(hasEnumerableProperty)
         , m_isReferencedByInlineCache(false)
+        , m_isPropertyBufferExtendedByTransition(false)
+        , m_isDictionary(false)
         , m_transitionTableVectorBufferSize(0)
         , m_transitionTableVectorBufferCapacity(0)
     {
@@ -225,6 +306,8 @@ protected:
         , m_hasNonAtomicPropertyName(hasNonAtomicPropertyName)
         , m_hasEnumerableProperty(hasEnumerableProperty)
         , m_isReferencedByInlineCache(false)
+        , m_isPropertyBufferExtendedByTransition(false)
+        , m_isDictionary(false)
         , m_transitionTableVectorBufferSize(0)
         , m_transitionTableVectorBufferCapacity(0)
     {
@@ -238,6 +321,9 @@ protected:
     bool m_hasNonAtomicPropertyName : 1;
     bool m_hasEnumerableProperty : 1;
     bool m_isReferencedByInlineCache : 1;
+    // a transition from this structure has appended its item right after ours in the shared item buffer
+    bool m_isPropertyBufferExtendedByTransition : 1;
+    bool m_isDictionary : 1;
     uint8_t m_transitionTableVectorBufferSize : 8;
     uint8_t m_transitionTableVectorBufferCapacity : 8;
 };
@@ -337,10 +423,16 @@ public:
         return true;
     }
 
+    // statistics can be nullptr
+    ObjectStructure* addPropertyWithTransition(const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc, ObjectStructureStatistics* statistics);
+
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
 
 private:
+    static void transitionTargetFinalizer(void* obj, void* data);
+    void clearTransition(ObjectStructure* to, const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc);
+
     size_t computeVectorAllocateSize(size_t newSize)
     {
         if (newSize == 0) {
@@ -350,6 +442,8 @@ private:
         return size_t(1) << (base + 1);
     }
 
+    // item buffer can be shared with the parent and descendants of this structure (see addProperty)
+    // items after m_properties.size() belong to descendants, so m_properties is never modified
     ObjectStructureItemTightVector m_properties;
     union {
         ObjectStructureTransitionVectorItem* m_transitionTableVectorBuffer;
@@ -493,6 +587,66 @@ private:
     ObjectStructureItemVector* m_properties;
     Optional<PropertyNameMapWithCache*> m_propertyNameMap;
 };
+
+// structure owned by a single object in dictionary mode (see Object::enterDictionaryMode)
+// properties are kept in insertion order and an open addressing table maps each name to its index
+// every modification is done in place and returns this structure
+class ObjectStructureWithDictionary : public ObjectStructure {
+    struct Bucket {
+        ObjectStructurePropertyName m_name;
+        size_t m_index;
+    };
+
+    static constexpr size_t EmptyBucketIndex = SIZE_MAX;
+    static constexpr size_t DeletedBucketIndex = SIZE_MAX - 1;
+
+public:
+    static ObjectStructureWithDictionary* create(ObjectStructure* from);
+
+    virtual std::pair<size_t, Optional<const ObjectStructureItem*>> findProperty(const ObjectStructurePropertyName& s) override;
+    virtual const ObjectStructureItem& readProperty(size_t idx) override;
+    virtual const ObjectStructureItem* properties() const override;
+    virtual size_t propertyCount() const override;
+    virtual ObjectStructure* addProperty(const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc) override;
+    virtual ObjectStructure* removeProperty(size_t pIndex) override;
+    virtual ObjectStructure* replacePropertyDescriptor(size_t idx, const ObjectStructurePropertyDescriptor& newDesc) override;
+
+    // property set has not been changed for a while
+    bool isStable() const
+    {
+        return m_lookupCountAfterLastModification >= ESCARGOT_OBJECT_STRUCTURE_DICTIONARY_MODE_STABLE_LOOKUP_COUNT;
+    }
+
+    // build a new structure which can be shared and inline cached
+    ObjectStructure* convertToFastModeStructure();
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+
+private:
+    ObjectStructureWithDictionary(ObjectStructureItemVector* properties, bool hasIndexPropertyName,
+                                  bool hasSymbolPropertyName, bool hasNonAtomicPropertyName, bool hasEnumerableProperty);
+
+    static size_t bucketHash(const ObjectStructurePropertyName& name)
+    {
+        size_t hash = name.hashValue();
+        // hash of atomic string is its address
+        return hash ^ (hash >> 4) ^ (hash >> 12);
+    }
+
+    ObjectStructureWithDictionary* structureForModification();
+    size_t findBucket(const ObjectStructurePropertyName& name) const;
+    void insertBucket(const ObjectStructurePropertyName& name, size_t index);
+    void rehash(size_t newCapacity);
+
+    ObjectStructureItemVector* m_properties;
+    Bucket* m_buckets;
+    // power of two
+    uint32_t m_bucketCapacity;
+    // live and deleted buckets
+    uint32_t m_usedBucketCount;
+    uint32_t m_lookupCountAfterLastModification;
+};
 } // namespace Escargot
 
 namespace std {
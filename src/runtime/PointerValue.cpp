@@ -27,6 +27,7 @@ namespace Escargot {
 
 size_t PointerValue::g_objectTag;
 size_t PointerValue::g_prototypeObjectTag;
+size_t PointerValue::g_inlinePropertyStorageObjectTag;
 size_t PointerValue::g_arrayObjectTag;
 size_t PointerValue::g_arrayPrototypeObjectTag;
 size_t PointerValue::g_scriptFunctionObjectTag;
@@ -184,6 +184,18 @@ public:
         return getTypeTag() == POINTER_VALUE_BIGINT_TAG_IN_DATA;
     }
 
+    // an instance of `Object` class itself, not of any derived built-in class
+    inline bool isPlainObject() const
+    {
+        return isNonPrototypePlainObject() || hasVTag(g_prototypeObjectTag);
+    }
+
+    // plain object which has never been set as a prototype
+    inline bool isNonPrototypePlainObject() const
+    {
+        return hasVTag(g_objectTag) || hasVTag(g_inlinePropertyStorageObjectTag);
+    }
+
     inline bool isArrayObject() const
     {
         return hasVTag(g_arrayObjectTag) || hasVTag(g_arrayPrototypeObjectTag);
@@ -1125,6 +1137,8 @@ protected:
     // these values actually have unique virtual table address of each object class
     static size_t g_objectTag;
     static size_t g_prototypeObjectTag;
+    // stays 0 if ESCARGOT_OBJECT_INLINE_PROPERTY_STORAGE is disabled
+    static size_t g_inlinePropertyStorageObjectTag;
     static size_t g_arrayObjectTag;
     static size_t g_arrayPrototypeObjectTag;
     static size_t g_scriptFunctionObjectTag;
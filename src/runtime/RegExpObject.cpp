@@ -28,6 +28,7 @@
 #include "Yarr.h"
 #include "YarrPattern.h"
 #include "YarrInterpreter.h"
+#include "YarrCompiledMatcher.h"
 #include "YarrSyntaxChecker.h"
 
 namespace Escargot {
@@ -64,6 +65,7 @@ RegExpObject::RegExpObject(ExecutionState& state, Object* proto, bool hasLastInd
     , m_hasOwnPropertyWhichHasDefinedFromRegExpPrototype(false)
     , m_yarrPattern(NULL)
     , m_bytecodePattern(NULL)
+    , m_compiledMatcher(NULL)
     , m_lastIndex(Value(0))
     , m_lastExecutedString(NULL)
 {
@@ -167,7 +169,7 @@ void RegExpObject::internalInit(ExecutionState& state, String* source, Option op
     m_source = source->length() ? source : defaultRegExpString;
     m_source = escapePattern(m_source);
 
-    auto& entry = getCacheEntryAndCompileIfNeeded(state, m_source, this->option());
+    RegExpCacheEntry entry = getCacheEntryAndCompileIfNeeded(state, m_source, this->option());
     if (entry.m_yarrError) {
         m_source = previousSource;
         setOptionValueForGC(previousOptions);
@@ -177,6 +179,7 @@ void RegExpObject::internalInit(ExecutionState& state, String* source, Option op
     setLastIndex(state, Value(0));
     m_yarrPattern = entry.m_yarrPattern;
     m_bytecodePattern = entry.m_bytecodePattern;
+    m_compiledMatcher = entry.m_compiledMatcher;
 }
 
 void RegExpObject::init(ExecutionState& state, String* source, String* option)
@@ -277,20 +280,20 @@ RegExpObject::Option RegExpObject::parseOption(ExecutionState& state, String* op
 void RegExpObject::setOption(const Option& option)
 {
     Option currentOption = this->option();
-    if (((currentOption & Option::MultiLine) != (option & Option::MultiLine))
-        || ((currentOption & Option::IgnoreCase) != (option & Option::IgnoreCase))) {
+    if (compileOptions(currentOption) != compileOptions(option)) {
         ASSERT(!m_yarrPattern);
         m_bytecodePattern = NULL;
+        m_compiledMatcher = NULL;
     }
     setOptionValueForGC(option);
 }
 
-RegExpObject::RegExpCacheEntry& RegExpObject::getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option)
+RegExpObject::RegExpCacheEntry RegExpObject::getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option)
 {
     auto cache = state.context()->regexpCache();
-    auto it = cache->find(RegExpCacheKey(source, option));
-    if (it != cache->end()) {
-        return it.value();
+    RegExpCacheEntry* cachedEntry = cache->find(RegExpCacheKey(source, option));
+    if (cachedEntry) {
+        return *cachedEntry;
     } else {
         const char* yarrError = nullptr;
         JSC::Yarr::YarrPattern* yarrPattern = nullptr;
@@ -301,11 +304,135 @@ RegExpObject::RegExpCacheEntry& RegExpObject::getCacheEntryAndCompileIfNeeded(Ex
         } catch (const std::bad_alloc& e) {
             ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "got too complicated RegExp pattern to process");
         }
-        auto iter = cache->insert(std::make_pair(RegExpCacheKey(source, option), RegExpCacheEntry(yarrError, yarrPattern))).first;
-        return iter.value();
+        RegExpCacheEntry entry(yarrError, yarrPattern);
+        cache->insert(RegExpCacheKey(source, option), entry);
+        return entry;
     }
 }
 
+size_t RegExpObject::RegExpCacheEntry::estimatedSizeInBytes() const
+{
+    size_t size = sizeof(RegExpCacheEntry);
+    if (m_yarrPattern) {
+        size += m_yarrPattern->estimatedSizeInBytes();
+    }
+    if (m_bytecodePattern) {
+        size += sizeof(JSC::Yarr::BytecodePattern) + m_bytecodePattern->estimatedSizeInBytes();
+    }
+#if defined(ENABLE_REGEXP_COMPILED_MATCHER)
+    if (m_compiledMatcher) {
+        size += m_compiledMatcher->estimatedSizeInBytes();
+    }
+#endif
+    return size;
+}
+
+void RegExpCache::evictIfNeeded(size_t byteBudget)
+{
+    if (m_totalSizeInBytes <= byteBudget) {
+        return;
+    }
+
+    std::vector<std::pair<uint64_t, size_t>> usage; // (last used, charged size)
+    usage.reserve(m_map.size());
+    for (auto iter = m_map.begin(); iter != m_map.end(); ++iter) {
+        usage.push_back(std::make_pair(iter->second.m_lastUsed, iter->second.m_chargedSizeInBytes));
+    }
+    size_t totalSize = m_totalSizeInBytes;
+
+    // find the use counter below which entries have to go, so the recently used ones fit in the budget
+    std::sort(usage.begin(), usage.end());
+    uint64_t evictBelow = 0;
+    for (size_t i = 0; i < usage.size() && totalSize > byteBudget; i++) {
+        totalSize -= usage[i].second;
+        evictBelow = usage[i].first + 1;
+    }
+
+    for (auto iter = m_map.begin(); iter != m_map.end();) {
+        if (iter->second.m_lastUsed < evictBelow) {
+            ASSERT(m_totalSizeInBytes >= iter->second.m_chargedSizeInBytes);
+            m_totalSizeInBytes -= iter->second.m_chargedSizeInBytes;
+            iter = m_map.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+template <typename CharType>
+static unsigned matchPattern(JSC::Yarr::BytecodePattern* bytecodePattern, JSC::Yarr::CompiledMatcher* compiledMatcher, const CharType* input, unsigned length, unsigned start, unsigned* output)
+{
+#if defined(ENABLE_REGEXP_COMPILED_MATCHER)
+    if (compiledMatcher) {
+        // the interpreter retries the match when the compiled matcher runs out of step budget or backtracking entries
+        JSC::Yarr::JSRegExpResult result = compiledMatcher->match(input, length, start, output);
+        if (result != JSC::Yarr::JSRegExpResult::JITCodeFailure) {
+            return result == JSC::Yarr::JSRegExpResult::Match ? output[0] : JSC::Yarr::offsetNoMatch;
+        }
+    }
+#endif
+    return JSC::Yarr::interpret(bytecodePattern, input, length, start, output);
+}
+
+#if defined(ESCARGOT_ENABLE_TEST)
+static std::string matchOffsetsToString(JSC::Yarr::JSRegExpResult result, const std::vector<unsigned>& output, size_t size)
+{
+    if (result != JSC::Yarr::JSRegExpResult::Match) {
+        return "no match";
+    }
+    std::string description;
+    for (size_t i = 0; i < size; i++) {
+        description += i ? "," : "";
+        description += output[i] == JSC::Yarr::offsetNoMatch ? "-1" : std::to_string(output[i]);
+    }
+    return description;
+}
+
+String* RegExpObject::compareMatchBackends(ExecutionState& state, String* str, size_t startIndex)
+{
+    // patterns are compiled again without the cache because byteCompile takes the character classes of a pattern
+    JSC::Yarr::ErrorCode errorCode = JSC::Yarr::ErrorCode::NoError;
+    JSC::Yarr::YarrPattern* yarrPattern = new JSC::Yarr::YarrPattern(m_source, WTF::OptionSet<JSC::Yarr::Flags>((JSC::Yarr::Flags)option()), errorCode);
+    if (errorCode != JSC::Yarr::ErrorCode::NoError) {
+        return String::fromASCII("unsupported");
+    }
+    JSC::Yarr::CompiledMatcher* compiledMatcher = JSC::Yarr::CompiledMatcher::compile(*yarrPattern);
+    if (!compiledMatcher) {
+        return String::fromASCII("unsupported");
+    }
+    std::unique_ptr<JSC::Yarr::BytecodePattern> bytecodePattern = JSC::Yarr::byteCompile(*yarrPattern, ThreadLocal::bumpPointerAllocator(), errorCode);
+    if (errorCode != JSC::Yarr::ErrorCode::NoError) {
+        return String::fromASCII("unsupported");
+    }
+
+    size_t resultSize = 2 * (bytecodePattern->m_body->m_numSubpatterns + 1);
+    std::vector<unsigned> interpreterOutput(std::max((unsigned)resultSize, bytecodePattern->m_offsetsSize));
+    std::vector<unsigned> compiledOutput(resultSize);
+    size_t length = str->length();
+    unsigned interpreterStart;
+    JSC::Yarr::JSRegExpResult compiledResult;
+    if (str->has8BitContent()) {
+        interpreterStart = JSC::Yarr::interpret(bytecodePattern.get(), str->characters8(), length, startIndex, interpreterOutput.data());
+        compiledResult = compiledMatcher->match(str->characters8(), length, startIndex, compiledOutput.data());
+    } else {
+        interpreterStart = JSC::Yarr::interpret(bytecodePattern.get(), (const UChar*)str->characters16(), length, startIndex, interpreterOutput.data());
+        compiledResult = compiledMatcher->match((const UChar*)str->characters16(), length, startIndex, compiledOutput.data());
+    }
+    if (compiledResult == JSC::Yarr::JSRegExpResult::JITCodeFailure) {
+        return String::fromASCII("fallback");
+    }
+
+    JSC::Yarr::JSRegExpResult interpreterResult = interpreterStart == JSC::Yarr::offsetNoMatch ? JSC::Yarr::JSRegExpResult::NoMatch : JSC::Yarr::JSRegExpResult::Match;
+    std::string interpreterOffsets = matchOffsetsToString(interpreterResult, interpreterOutput, resultSize);
+    std::string compiledOffsets = matchOffsetsToString(compiledResult, compiledOutput, resultSize);
+    if (interpreterOffsets == compiledOffsets) {
+        return String::fromASCII("same");
+    }
+    std::string description = "interpreter: " + interpreterOffsets + " compiled: " + compiledOffsets;
+    return String::fromASCII(description.data(), description.length());
+}
+#endif
+
 bool RegExpObject::matchNonGlobally(ExecutionState& state, String* str, RegexMatchResult& matchResult, bool testOnly, size_t startIndex)
 {
     Option prevOption = option();
@@ -315,7 +442,7 @@ bool RegExpObject::matchNonGlobally(ExecutionState& state, String* str, RegexMat
     return ret;
 }
 
-bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& matchResult, bool testOnly, size_t startIndex)
+bool RegExpObject::matchOffsets(ExecutionState& state, String* str, RegexMatchOffsets& offsets, size_t startIndex)
 {
     Context::RegExpLegacyFeatures& legacyFeatures = state.context()->regexpLegacyFeatures();
     legacyFeatures.input = str;
@@ -323,9 +450,10 @@ bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& m
     m_lastExecutedString = str;
 
     if (!m_bytecodePattern) {
-        RegExpCacheEntry& entry = getCacheEntryAndCompileIfNeeded(state, m_source, option());
+        // entry is a copy, so GC while compiling cannot invalidate it
+        RegExpCacheEntry entry = getCacheEntryAndCompileIfNeeded(state, m_source, option());
         if (entry.m_yarrError) {
-            matchResult.m_subPatternNum = 0;
+            offsets.prepare(0, 2);
             return false;
         }
         m_yarrPattern = entry.m_yarrPattern;
@@ -333,111 +461,84 @@ bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& m
         if (entry.m_bytecodePattern) {
             m_bytecodePattern = entry.m_bytecodePattern;
         } else {
+#if defined(ENABLE_REGEXP_COMPILED_MATCHER)
+            // should be compiled before byteCompile which takes the character classes of the pattern
+            entry.m_compiledMatcher = JSC::Yarr::CompiledMatcher::compile(*m_yarrPattern);
+#endif
             WTF::BumpPointerAllocator* bumpAlloc = ThreadLocal::bumpPointerAllocator();
             JSC::Yarr::ErrorCode errorCode = JSC::Yarr::ErrorCode::NoError;
             std::unique_ptr<JSC::Yarr::BytecodePattern> ownedBytecode = JSC::Yarr::byteCompile(*m_yarrPattern, bumpAlloc, errorCode);
             if (errorCode != JSC::Yarr::ErrorCode::NoError) {
+                offsets.prepare(0, 2);
                 return false;
             }
             m_bytecodePattern = ownedBytecode.release();
             entry.m_bytecodePattern = m_bytecodePattern;
+            // look up the cache again because the entry may have been evicted meanwhile
+            state.context()->regexpCache()->insert(RegExpCacheKey(m_source, option()), entry);
         }
+        m_compiledMatcher = entry.m_compiledMatcher;
     }
 
     ASSERT(!!m_bytecodePattern);
     unsigned subPatternNum = m_bytecodePattern->m_body->m_numSubpatterns;
-    matchResult.m_subPatternNum = (int)subPatternNum;
+    unsigned* outputBuf = offsets.prepare(subPatternNum, std::max((2 * (subPatternNum + 1)), m_bytecodePattern->m_offsetsSize));
     size_t length = str->length();
-    size_t start = startIndex;
-    unsigned result = 0;
+    if (startIndex > length) {
+        return false;
+    }
+
+    unsigned result;
+    if (LIKELY(str->has8BitContent())) {
+        result = matchPattern(m_bytecodePattern, m_compiledMatcher, str->characters8(), length, startIndex, outputBuf);
+    } else {
+        result = matchPattern(m_bytecodePattern, m_compiledMatcher, (const UChar*)str->characters16(), length, startIndex, outputBuf);
+    }
+
+    if (result == JSC::Yarr::offsetNoMatch) {
+        return false;
+    }
+
+    // RegExp.$1 and friends are built from these offsets only when they are read
+    legacyFeatures.recordMatch(str, outputBuf, subPatternNum);
+    return true;
+}
+
+bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& matchResult, bool testOnly, size_t startIndex)
+{
     bool isGlobal = option() & RegExpObject::Option::Global;
     bool isSticky = option() & RegExpObject::Option::Sticky;
     bool gotResult = false;
-    unsigned outputBufLength = std::max((2 * (subPatternNum + 1)), m_bytecodePattern->m_offsetsSize);
-    unsigned* outputBuf = ALLOCA(sizeof(unsigned) * outputBufLength, unsigned int);
-    outputBuf[1] = start;
-    do {
-        start = outputBuf[1];
-        memset(outputBuf, -1, sizeof(unsigned) * 2 * (subPatternNum + 1));
-        if (start > length) {
+    RegexMatchOffsets offsets;
+    size_t start = startIndex;
+
+    while (true) {
+        bool matched = matchOffsets(state, str, offsets, start);
+        matchResult.m_subPatternNum = (int)offsets.subPatternNum();
+        if (!matched) {
             break;
         }
-        if (LIKELY(str->has8BitContent()))
-            result = JSC::Yarr::interpret(m_bytecodePattern, str->characters8(), length, start, outputBuf);
-        else
-            result = JSC::Yarr::interpret(m_bytecodePattern, (const UChar*)str->characters16(), length, start, outputBuf);
-
-        if (result != JSC::Yarr::offsetNoMatch) {
-            gotResult = true;
-            unsigned maxMatchedIndex = subPatternNum;
+        gotResult = true;
 
-            bool lastParenInvalid = false;
-            for (; maxMatchedIndex > 0; maxMatchedIndex--) {
-                if (outputBuf[maxMatchedIndex * 2] != std::numeric_limits<unsigned>::max()) {
-                    break;
-                } else {
-                    lastParenInvalid = true;
-                }
-            }
-
-            // Details:{3, 10, 3, 10, 3, 6, 7, 10, 1684872, 806200}
-            legacyFeatures.dollarCount = maxMatchedIndex;
-            unsigned dollarEnd = std::min(maxMatchedIndex, (unsigned)9);
-            for (unsigned i = 1; i <= dollarEnd; i++) {
-                if (outputBuf[i * 2] == std::numeric_limits<unsigned>::max()) {
-                    legacyFeatures.dollars[i - 1] = StringView();
-                } else {
-                    legacyFeatures.dollars[i - 1] = StringView(str, outputBuf[i * 2], outputBuf[i * 2 + 1]);
-                }
-            }
-
-            if (UNLIKELY(testOnly)) {
-                // outputBuf[1] should be set to lastIndex
-                if (isGlobal || isSticky) {
-                    setLastIndex(state, Value(outputBuf[1]));
-                }
-                if (!lastParenInvalid && subPatternNum) {
-                    legacyFeatures.lastParen = StringView(str, outputBuf[maxMatchedIndex * 2], outputBuf[maxMatchedIndex * 2 + 1]);
-                } else {
-                    legacyFeatures.lastParen = StringView();
-                }
-                legacyFeatures.lastMatch = StringView(str, outputBuf[0], outputBuf[1]);
-                legacyFeatures.leftContext = StringView(str, 0, outputBuf[0]);
-                legacyFeatures.rightContext = StringView(str, outputBuf[1], length);
-                return true;
-            }
-            std::vector<RegexMatchResult::RegexMatchResultPiece> piece;
-            piece.resize(subPatternNum + 1);
-
-            for (unsigned i = 0; i < subPatternNum + 1; i++) {
-                RegexMatchResult::RegexMatchResultPiece p;
-                p.m_start = outputBuf[i * 2];
-                p.m_end = outputBuf[i * 2 + 1];
-                piece[i] = p;
-            }
-
-            if (!lastParenInvalid && subPatternNum) {
-                legacyFeatures.lastParen = StringView(str, piece[maxMatchedIndex].m_start, piece[maxMatchedIndex].m_end);
-            } else {
-                legacyFeatures.lastParen = StringView();
+        if (UNLIKELY(testOnly)) {
+            if (isGlobal || isSticky) {
+                setLastIndex(state, Value(offsets.end(0)));
             }
+            return true;
+        }
 
-            legacyFeatures.leftContext = StringView(str, 0, piece[0].m_start);
-            legacyFeatures.rightContext = StringView(str, piece[maxMatchedIndex].m_end, length);
-            legacyFeatures.lastMatch = StringView(str, piece[0].m_start, piece[0].m_end);
-            matchResult.m_matchResults.push_back(std::vector<RegexMatchResult::RegexMatchResultPiece>(std::move(piece)));
-            if (!isGlobal)
-                break;
-            if (start == outputBuf[1]) {
-                outputBuf[1]++;
-                if (outputBuf[1] > length) {
-                    break;
-                }
-            }
-        } else {
+        const RegexMatchResult::RegexMatchResultPiece* pieces = offsets.pieces();
+        matchResult.m_matchResults.push_back(std::vector<RegexMatchResult::RegexMatchResultPiece>(pieces, pieces + offsets.subPatternNum() + 1));
+        if (!isGlobal) {
             break;
         }
-    } while (result != JSC::Yarr::offsetNoMatch);
+
+        size_t end = offsets.end(0);
+        if (start == end) {
+            end++;
+        }
+        start = end;
+    }
 
     if (!gotResult && ((option() & (RegExpObject::Option::Global | RegExpObject::Option::Sticky)))) {
         setLastIndex(state, Value(0));
@@ -479,27 +580,19 @@ void RegExpObject::createRegexMatchResult(ExecutionState& state, String* str, Re
     } while (testResult);
 }
 
-ArrayObject* RegExpObject::createRegExpMatchedArray(ExecutionState& state, const RegexMatchResult& result, String* input)
+ArrayObject* RegExpObject::createRegExpMatchedArray(ExecutionState& state, const RegexMatchOffsets& offsets, String* input)
 {
-    uint64_t len = 0;
-    for (unsigned i = 0; i < result.m_matchResults.size(); i++) {
-        for (unsigned j = 0; j < result.m_matchResults[i].size(); j++) {
-            len++;
-        }
-    }
+    uint64_t len = offsets.subPatternNum() + 1;
 
     ArrayObject* arr = new ArrayObject(state, len);
-    arr->directDefineOwnProperty(state, state.context()->staticStrings().index, ObjectPropertyDescriptor(Value(result.m_matchResults[0][0].m_start)));
+    arr->directDefineOwnProperty(state, state.context()->staticStrings().index, ObjectPropertyDescriptor(Value(offsets.start(0))));
     arr->directDefineOwnProperty(state, state.context()->staticStrings().input, ObjectPropertyDescriptor(Value(input)));
 
-    size_t idx = 0;
-    for (unsigned i = 0; i < result.m_matchResults.size(); i++) {
-        for (unsigned j = 0; j < result.m_matchResults[i].size(); j++) {
-            if (result.m_matchResults[i][j].m_start == std::numeric_limits<unsigned>::max()) {
-                arr->defineOwnIndexedPropertyWithoutExpanding(state, idx++, Value());
-            } else {
-                arr->defineOwnIndexedPropertyWithoutExpanding(state, idx++, Value(new StringView(input, result.m_matchResults[i][j].m_start, result.m_matchResults[i][j].m_end)));
-            }
+    for (size_t i = 0; i < len; i++) {
+        if (!offsets.hasCapture(i)) {
+            arr->defineOwnIndexedPropertyWithoutExpanding(state, i, Value());
+        } else {
+            arr->defineOwnIndexedPropertyWithoutExpanding(state, i, Value(StringView::createSlice(input, offsets.start(i), offsets.end(i))));
         }
     }
 
@@ -507,18 +600,15 @@ ArrayObject* RegExpObject::createRegExpMatchedArray(ExecutionState& state, const
         ArrayObject* indices = new ArrayObject(state, len);
         arr->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().indices), ObjectPropertyDescriptor(Value(indices), ObjectPropertyDescriptor::AllPresent));
 
-        size_t idx = 0;
-        for (unsigned i = 0; i < result.m_matchResults.size(); i++) {
-            for (unsigned j = 0; j < result.m_matchResults[i].size(); j++) {
-                if (result.m_matchResults[i][j].m_start == std::numeric_limits<unsigned>::max()) {
-                    indices->defineOwnIndexedPropertyWithoutExpanding(state, idx++, Value());
-                } else {
-                    ArrayObject* pair = new ArrayObject(state, 2);
-                    pair->defineOwnIndexedPropertyWithoutExpanding(state, 0, Value(result.m_matchResults[i][j].m_start));
-                    pair->defineOwnIndexedPropertyWithoutExpanding(state, 1, Value(result.m_matchResults[i][j].m_end));
-
-                    indices->defineOwnIndexedPropertyWithoutExpanding(state, idx++, Value(pair));
-                }
+        for (size_t i = 0; i < len; i++) {
+            if (!offsets.hasCapture(i)) {
+                indices->defineOwnIndexedPropertyWithoutExpanding(state, i, Value());
+            } else {
+                ArrayObject* pair = new ArrayObject(state, 2);
+                pair->defineOwnIndexedPropertyWithoutExpanding(state, 0, Value(offsets.start(i)));
+                pair->defineOwnIndexedPropertyWithoutExpanding(state, 1, Value(offsets.end(i)));
+
+                indices->defineOwnIndexedPropertyWithoutExpanding(state, i, Value(pair));
             }
         }
 
@@ -555,23 +645,9 @@ ArrayObject* RegExpObject::createRegExpMatchedArray(ExecutionState& state, const
             if (foundMapElement != m_yarrPattern->m_namedGroupToParenIndices.end()) {
                 Value value;
                 for (size_t i = 0; i < foundMapElement->second.size(); i++) {
-                    Value indexValue;
                     size_t index = foundMapElement->second[i];
-                    size_t indicesIndex = 0;
-                    for (unsigned i = 0; i < result.m_matchResults.size(); i++) {
-                        for (unsigned j = 0; j < result.m_matchResults[i].size(); j++) {
-                            if (indicesIndex == index) {
-                                if (result.m_matchResults[i][j].m_start != std::numeric_limits<unsigned>::max()) {
-                                    indexValue = new StringView(input, result.m_matchResults[i][j].m_start, result.m_matchResults[i][j].m_end);
-                                }
-                                break;
-                            }
-                            indicesIndex++;
-                        }
-                    }
-
-                    if (!indexValue.isUndefinedOrNull()) {
-                        value = indexValue;
+                    if (index < len && offsets.hasCapture(index)) {
+                        value = StringView::createSlice(input, offsets.start(index), offsets.end(index));
                     }
                 }
 
@@ -591,21 +667,16 @@ ArrayObject* RegExpObject::createRegExpMatchedArray(ExecutionState& state, const
     return arr;
 }
 
-void RegExpObject::pushBackToRegExpMatchedArray(ExecutionState& state, ArrayObject* array, size_t& index, const size_t limit, const RegexMatchResult& result, String* str)
+void RegExpObject::pushBackToRegExpMatchedArray(ExecutionState& state, ArrayObject* array, size_t& index, const size_t limit, const RegexMatchOffsets& offsets, String* str)
 {
-    for (unsigned i = 0; i < result.m_matchResults.size(); i++) {
-        for (unsigned j = 0; j < result.m_matchResults[i].size(); j++) {
-            if (i == 0 && j == 0)
-                continue;
-
-            if (std::numeric_limits<unsigned>::max() == result.m_matchResults[i][j].m_start) {
-                array->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(index++)), ObjectPropertyDescriptor(Value(), ObjectPropertyDescriptor::AllPresent));
-            } else {
-                array->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(index++)), ObjectPropertyDescriptor(str->substring(result.m_matchResults[i][j].m_start, result.m_matchResults[i][j].m_end), ObjectPropertyDescriptor::AllPresent));
-            }
-            if (index == limit)
-                return;
+    for (size_t i = 1; i <= offsets.subPatternNum(); i++) {
+        if (!offsets.hasCapture(i)) {
+            array->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(index++)), ObjectPropertyDescriptor(Value(), ObjectPropertyDescriptor::AllPresent));
+        } else {
+            array->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(index++)), ObjectPropertyDescriptor(str->substring(offsets.start(i), offsets.end(i)), ObjectPropertyDescriptor::AllPresent));
         }
+        if (index == limit)
+            return;
     }
 }
 
@@ -30,6 +30,7 @@ namespace JSC {
 namespace Yarr {
 struct YarrPattern;
 struct BytecodePattern;
+struct CompiledMatcher;
 } // namespace Yarr
 } // namespace JSC
 
@@ -44,6 +45,72 @@ struct RegexMatchResult {
     std::vector<std::vector<RegexMatchResultPiece>> m_matchResults;
 };
 
+// Capture offsets of a single match, filled by RegExpObject::matchOffsets.
+// The buffer is reused across calls, so loops over many matches (replace, split)
+// work on plain offsets without allocating a RegexMatchResult for each match
+class RegexMatchOffsets {
+public:
+    RegexMatchOffsets()
+        : m_subPatternNum(0)
+        , m_buffer(m_inlineBuffer)
+    {
+        m_inlineBuffer[0] = m_inlineBuffer[1] = std::numeric_limits<unsigned>::max();
+    }
+
+    RegexMatchOffsets(const RegexMatchOffsets&) = delete;
+    RegexMatchOffsets& operator=(const RegexMatchOffsets&) = delete;
+
+    unsigned subPatternNum() const
+    {
+        return m_subPatternNum;
+    }
+
+    // index 0 is the whole match, 1 ... subPatternNum() are the capture groups
+    bool hasCapture(size_t index) const
+    {
+        return m_buffer[index * 2] != std::numeric_limits<unsigned>::max();
+    }
+
+    unsigned start(size_t index) const
+    {
+        return m_buffer[index * 2];
+    }
+
+    unsigned end(size_t index) const
+    {
+        return m_buffer[index * 2 + 1];
+    }
+
+    const RegexMatchResult::RegexMatchResultPiece* pieces() const
+    {
+        return reinterpret_cast<const RegexMatchResult::RegexMatchResultPiece*>(m_buffer);
+    }
+
+private:
+    friend class RegExpObject;
+    static constexpr size_t InlineBufferSize = 24;
+
+    unsigned* prepare(unsigned subPatternNum, size_t bufferSize)
+    {
+        m_subPatternNum = subPatternNum;
+        if (UNLIKELY(bufferSize > InlineBufferSize)) {
+            if (m_externalBuffer.size() < bufferSize) {
+                m_externalBuffer.resize(bufferSize);
+            }
+            m_buffer = m_externalBuffer.data();
+        } else {
+            m_buffer = m_inlineBuffer;
+        }
+        memset(m_buffer, -1, sizeof(unsigned) * 2 * (subPatternNum + 1));
+        return m_buffer;
+    }
+
+    unsigned m_subPatternNum;
+    unsigned* m_buffer;
+    std::vector<unsigned> m_externalBuffer;
+    unsigned m_inlineBuffer[InlineBufferSize];
+};
+
 class RegExpObject : public DerivedObject {
     void initRegExpObject(ExecutionState& state, bool hasLastIndex = true);
 
@@ -60,21 +127,25 @@ public:
         Sticky = 1 << 7,
     };
 
+    // options which change the compiled pattern (global and hasIndices are handled outside of Yarr)
+    static Option compileOptions(Option option)
+    {
+        return static_cast<Option>(option & (IgnoreCase | MultiLine | DotAll | Unicode | UnicodeSets | Sticky));
+    }
+
     struct RegExpCacheKey {
         RegExpCacheKey(String* body, Option option)
             : m_body(body)
-            , m_multiline(option & RegExpObject::Option::MultiLine)
-            , m_ignoreCase(option & RegExpObject::Option::IgnoreCase)
+            , m_option(compileOptions(option))
         {
         }
 
         bool operator==(const RegExpCacheKey& otherKey) const
         {
-            return (m_body == otherKey.m_body) && (m_multiline == otherKey.m_multiline) && (m_ignoreCase == otherKey.m_ignoreCase);
+            return (m_option == otherKey.m_option) && (m_body == otherKey.m_body || m_body->equals(otherKey.m_body));
         }
         String* m_body;
-        bool m_multiline : 1;
-        bool m_ignoreCase : 1;
+        Option m_option;
     };
 
     struct RegExpCacheEntry {
@@ -82,12 +153,25 @@ public:
             : m_yarrError(yarrError)
             , m_yarrPattern(yarrPattern)
             , m_bytecodePattern(bytecodePattern)
+            , m_compiledMatcher(nullptr)
+            , m_lastUsed(0)
+            , m_chargedSizeInBytes(0)
         {
         }
 
+        size_t estimatedSizeInBytes() const;
+
         const char* m_yarrError;
         JSC::Yarr::YarrPattern* m_yarrPattern;
         JSC::Yarr::BytecodePattern* m_bytecodePattern;
+        // nullptr when the pattern is not supported by the compiled matcher
+        JSC::Yarr::CompiledMatcher* m_compiledMatcher;
+        // value of RegExpCache::m_useCounter at the last lookup
+        uint64_t m_lastUsed;
+        // size added to RegExpCache::m_totalSizeInBytes when this entry was inserted
+        // estimatedSizeInBytes changes after insertion (e.g. byteCompile takes the character classes of m_yarrPattern)
+        // so exactly this size is subtracted when the entry is replaced or evicted
+        size_t m_chargedSizeInBytes;
     };
 
     RegExpObject(ExecutionState& state, String* source, String* option);
@@ -110,6 +194,8 @@ public:
 
     bool match(ExecutionState& state, String* str, RegexMatchResult& result, bool testOnly = false, size_t startIndex = 0);
     bool matchNonGlobally(ExecutionState& state, String* str, RegexMatchResult& result, bool testOnly = false, size_t startIndex = 0);
+    // single match attempt from startIndex which neither reads nor updates lastIndex
+    bool matchOffsets(ExecutionState& state, String* str, RegexMatchOffsets& offsets, size_t startIndex);
 
     String* source()
     {
@@ -167,8 +253,8 @@ public:
     }
 
     void createRegexMatchResult(ExecutionState& state, String* str, RegexMatchResult& result);
-    ArrayObject* createRegExpMatchedArray(ExecutionState& state, const RegexMatchResult& result, String* input);
-    void pushBackToRegExpMatchedArray(ExecutionState& state, ArrayObject* array, size_t& index, const size_t limit, const RegexMatchResult& result, String* str);
+    ArrayObject* createRegExpMatchedArray(ExecutionState& state, const RegexMatchOffsets& offsets, String* input);
+    void pushBackToRegExpMatchedArray(ExecutionState& state, ArrayObject* array, size_t& index, const size_t limit, const RegexMatchOffsets& offsets, String* str);
 
     static String* computeRegExpOptionString(ExecutionState& state, Object* obj);
     static String* regexpSourceValue(ExecutionState& state, Object* obj);
@@ -176,6 +262,13 @@ public:
     // returns error string if there is error
     static Optional<String*> checkRegExpSyntax(String* pattern, String* flags);
 
+#if defined(ESCARGOT_ENABLE_TEST)
+    // matches str from startIndex with the compiled matcher and with the bytecode interpreter
+    // returns "same" when both agree, "unsupported" or "fallback" when the compiled matcher does not run to the end
+    // and the offsets of both otherwise
+    String* compareMatchBackends(ExecutionState& state, String* str, size_t startIndex);
+#endif
+
 protected:
     explicit RegExpObject(ExecutionState& state, Object* proto, bool hasLastIndex = true);
 
@@ -187,7 +280,8 @@ private:
     void setOption(const Option& option);
     void internalInit(ExecutionState& state, String* source, Option option = None);
 
-    static RegExpCacheEntry& getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option);
+    // returns a copy because the cached entry can be moved or evicted by GC while compiling
+    static RegExpCacheEntry getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option);
 
     // has source, option...
     static bool hasOwnRegExpProperty(ExecutionState& state, Object* obj);
@@ -202,6 +296,7 @@ private:
     bool m_hasOwnPropertyWhichHasDefinedFromRegExpPrototype : 1; // source, option, global, ignoreCase...
     JSC::Yarr::YarrPattern* m_yarrPattern;
     JSC::Yarr::BytecodePattern* m_bytecodePattern;
+    JSC::Yarr::CompiledMatcher* m_compiledMatcher;
     EncodedValue m_lastIndex;
     const String* m_lastExecutedString;
 };
@@ -233,12 +328,6 @@ private:
     String* m_string;
 };
 
-typedef HashMap<RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry,
-                std::hash<RegExpObject::RegExpCacheKey>, std::equal_to<RegExpObject::RegExpCacheKey>,
-                GCUtil::gc_malloc_allocator<std::pair<const RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry>>>
-    RegExpCacheMap;
-
-
 class RegExpPrototypeObject : public PrototypeObject {
 public:
     explicit RegExpPrototypeObject(ExecutionState& state)
@@ -260,7 +349,7 @@ template <>
 struct hash<Escargot::RegExpObject::RegExpCacheKey> {
     size_t operator()(Escargot::RegExpObject::RegExpCacheKey const& x) const
     {
-        return x.m_body->hashValue();
+        return x.m_body->hashValue() * 31 + x.m_option;
     }
 };
 
@@ -273,4 +362,96 @@ struct equal_to<Escargot::RegExpObject::RegExpCacheKey> {
 };
 } // namespace std
 
+namespace Escargot {
+
+// Compiled patterns shared by every Context of a VMInstance
+// Entries are keyed by the source and the compile options. Every lookup stamps the entry
+// with a use counter, and evictIfNeeded drops the least recently used entries until
+// the estimated size of the compiled patterns fits in the byte budget
+class RegExpCache : public gc {
+public:
+    typedef HashMap<RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry,
+                    std::hash<RegExpObject::RegExpCacheKey>, std::equal_to<RegExpObject::RegExpCacheKey>,
+                    GCUtil::gc_malloc_allocator<std::pair<const RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry>>>
+        CacheMap;
+
+    RegExpCache()
+        : m_useCounter(0)
+        , m_totalSizeInBytes(0)
+        , m_hitCount(0)
+        , m_missCount(0)
+    {
+    }
+
+    // the returned entry is valid until the next insert or eviction
+    RegExpObject::RegExpCacheEntry* find(const RegExpObject::RegExpCacheKey& key)
+    {
+        auto iter = m_map.find(key);
+        if (iter == m_map.end()) {
+            m_missCount++;
+            return nullptr;
+        }
+        m_hitCount++;
+        iter.value().m_lastUsed = ++m_useCounter;
+        return &iter.value();
+    }
+
+    // inserts the entry or replaces the existing one of the key
+    // entry is charged again with its current size, so attached compiled data is accounted
+    void insert(const RegExpObject::RegExpCacheKey& key, const RegExpObject::RegExpCacheEntry& entry)
+    {
+        auto iter = m_map.find(key);
+        if (iter == m_map.end()) {
+            iter = m_map.insert(std::make_pair(key, entry)).first;
+        } else {
+            ASSERT(m_totalSizeInBytes >= iter->second.m_chargedSizeInBytes);
+            m_totalSizeInBytes -= iter->second.m_chargedSizeInBytes;
+            iter.value() = entry;
+        }
+        iter.value().m_lastUsed = ++m_useCounter;
+        iter.value().m_chargedSizeInBytes = entry.estimatedSizeInBytes();
+        m_totalSizeInBytes += iter->second.m_chargedSizeInBytes;
+    }
+
+    // RegExpObjects hold their own references to the compiled patterns,
+    // so an evicted pattern is compiled again only when it is looked up again
+    void evictIfNeeded(size_t byteBudget);
+
+    void clear()
+    {
+        m_map.clear();
+        m_totalSizeInBytes = 0;
+    }
+
+    size_t size() const
+    {
+        return m_map.size();
+    }
+
+    size_t totalSizeInBytes() const
+    {
+        return m_totalSizeInBytes;
+    }
+
+    size_t hitCount() const
+    {
+        return m_hitCount;
+    }
+
+    size_t missCount() const
+    {
+        return m_missCount;
+    }
+
+private:
+    CacheMap m_map;
+    uint64_t m_useCounter;
+    // sum of estimated sizes of the entries
+    size_t m_totalSizeInBytes;
+    size_t m_hitCount;
+    size_t m_missCount;
+};
+
+} // namespace Escargot
+
 #endif
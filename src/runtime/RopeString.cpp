@@ -112,15 +112,9 @@ void RopeString::flattenRopeStringWorker()
         size_t subLength = data.length;
 
         if (data.has8BitContent) {
-            auto ptr = (const LChar*)data.buffer;
-            for (size_t i = 0; i < subLength; i++) {
-                result[i + pos] = ptr[i];
-            }
+            StringKernels::copyCharacters(result + pos, (const LChar*)data.buffer, subLength);
         } else {
-            auto ptr = (const char16_t*)data.buffer;
-            for (size_t i = 0; i < subLength; i++) {
-                result[i + pos] = ptr[i];
-            }
+            StringKernels::copyCharacters(result + pos, (const char16_t*)data.buffer, subLength);
         }
     }
 
@@ -303,6 +303,12 @@ bool SandBox::createStackTrace(StackTraceDataOnStackVector& stackTraceDataVector
 }
 
 void SandBox::throwException(ExecutionState& state, const Value& exception)
+{
+    setPendingException(state, exception);
+    throw exception;
+}
+
+void SandBox::setPendingException(ExecutionState& state, const Value& exception)
 {
     m_stackTraceDataVector.clear();
     createStackTrace(m_stackTraceDataVector, state);
@@ -310,7 +316,6 @@ void SandBox::throwException(ExecutionState& state, const Value& exception)
     // We MUST save thrown exception Value.
     // because bdwgc cannot track `thrown value`(may turned off by GC_DONT_REGISTER_MAIN_STATIC_DATA)
     m_exception = exception;
-    throw exception;
 }
 
 void SandBox::rethrowPreviouslyCaughtException(ExecutionState& state, Value exception, StackTraceDataOnStackVector&& stackTraceDataVector)
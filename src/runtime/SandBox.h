@@ -110,6 +110,8 @@ public:
     static bool createStackTrace(StackTraceDataOnStackVector& stackTraceDataVector, ExecutionState& state, bool stopAtPause = false);
 
     void throwException(ExecutionState& state, const Value& exception);
+    // same as throwException but leaves the exception pending instead of throwing it
+    void setPendingException(ExecutionState& state, const Value& exception);
     void rethrowPreviouslyCaughtException(ExecutionState& state, Value exception, StackTraceDataOnStackVector&& stackTraceDataVector);
 
     StackTraceDataOnStackVector& stackTraceDataVector()
@@ -130,7 +130,11 @@ Value ScriptClassConstructorFunctionObject::construct(ExecutionState& state, con
             return constructorRealm->globalObject()->objectPrototype();
         });
         // Set the [[Prototype]] internal slot of obj to proto.
-        thisArgument = new Object(state, proto);
+        // property storage is sized for the properties `this` had at the end of the last construction
+        thisArgument = Object::tryCreateWithInlinePropertyStorage(state, proto, interpretedCodeBlock()->constructedObjectPropertyCount());
+        if (!thisArgument) {
+            thisArgument = new Object(state, proto, interpretedCodeBlock()->constructedObjectPropertyCount());
+        }
         // ReturnIfAbrupt(thisArgument).
     }
 
@@ -145,8 +149,12 @@ Value ScriptClassConstructorFunctionObject::construct(ExecutionState& state, con
     // Else, ReturnIfAbrupt(result).
     // Return envRec.GetThisBinding().
     // -> perform at ScriptClassConstructorFunctionObjectReturnValueBinderWithConstruct
-    return FunctionObjectProcessCallGenerator::processCall<ScriptClassConstructorFunctionObject, true, true, true, ScriptClassConstructorFunctionObjectThisValueBinder,
-                                                           ScriptClassConstructorFunctionObjectNewTargetBinderWithConstruct, ScriptClassConstructorFunctionObjectReturnValueBinderWithConstruct>(state, this, thisArgument, argc, argv, newTarget);
+    Value result = FunctionObjectProcessCallGenerator::processCall<ScriptClassConstructorFunctionObject, true, true, true, ScriptClassConstructorFunctionObjectThisValueBinder,
+                                                                   ScriptClassConstructorFunctionObjectNewTargetBinderWithConstruct, ScriptClassConstructorFunctionObjectReturnValueBinderWithConstruct>(state, this, thisArgument, argc, argv, newTarget);
+    if (thisArgument) {
+        interpretedCodeBlock()->setConstructedObjectPropertyCount(std::min(thisArgument->structure()->propertyCount(), (size_t)ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE));
+    }
+    return result;
 }
 
 void ScriptClassConstructorFunctionObject::callConstructor(ExecutionState& state, Object* receiver, const size_t argc, Value* argv, Object* newTarget)
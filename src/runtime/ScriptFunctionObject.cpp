@@ -155,10 +155,17 @@ Value ScriptFunctionObject::construct(ExecutionState& state, const size_t argc,
         return constructorRealm->globalObject()->objectPrototype();
     });
     // Set the [[Prototype]] internal slot of obj to proto.
-    Object* thisArgument = new Object(state, proto);
+    // property storage is sized for the properties `this` had at the end of the last construction
+    InterpretedCodeBlock* codeBlock = interpretedCodeBlock();
+    Object* thisArgument = Object::tryCreateWithInlinePropertyStorage(state, proto, codeBlock->constructedObjectPropertyCount());
+    if (!thisArgument) {
+        thisArgument = new Object(state, proto, codeBlock->constructedObjectPropertyCount());
+    }
 
     // ReturnIfAbrupt(thisArgument).
-    return FunctionObjectProcessCallGenerator::processCall<ScriptFunctionObject, true, true, false, ScriptFunctionObjectObjectThisValueBinderWithConstruct, ScriptFunctionObjectNewTargetBinderWithConstruct, ScriptFunctionObjectReturnValueBinderWithConstruct>(state, this, Value(thisArgument), argc, argv, newTarget).asObject();
+    Value result = FunctionObjectProcessCallGenerator::processCall<ScriptFunctionObject, true, true, false, ScriptFunctionObjectObjectThisValueBinderWithConstruct, ScriptFunctionObjectNewTargetBinderWithConstruct, ScriptFunctionObjectReturnValueBinderWithConstruct>(state, this, Value(thisArgument), argc, argv, newTarget);
+    codeBlock->setConstructedObjectPropertyCount(std::min(thisArgument->structure()->propertyCount(), (size_t)ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE));
+    return result.asObject();
 }
 
 void ScriptFunctionObject::callConstructor(ExecutionState& state, Object* receiver, const size_t argc, Value* argv, Object* newTarget)
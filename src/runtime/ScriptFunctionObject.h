@@ -66,6 +66,14 @@ public:
         return (InterpretedCodeBlock*)m_codeBlock;
     }
 
+    typedef Value (*CallEntry)(ScriptFunctionObject* self, ExecutionState& state, const Value& thisValue, const size_t argc, Value* argv);
+    // entry of [[Call]] which can be invoked without virtual dispatch (used by call-site cache)
+    // ScriptSimpleFunctionObject returns the entry of its specialization
+    virtual CallEntry callEntry()
+    {
+        return genericCallEntry;
+    }
+
     ConstructorKind constructorKind()
     {
         ASSERT(isConstructor());
@@ -104,6 +112,11 @@ protected:
     virtual Value construct(ExecutionState& state, const size_t argc, Value* argv, Object* newTarget) override;
     virtual void callConstructor(ExecutionState& state, Object* receiver, const size_t argc, Value* argv, Object* newTarget) override;
 
+    static Value genericCallEntry(ScriptFunctionObject* self, ExecutionState& state, const Value& thisValue, const size_t argc, Value* argv)
+    {
+        return self->call(state, thisValue, argc, argv);
+    }
+
     LexicalEnvironment* outerEnvironment()
     {
         return m_outerEnvironment;
@@ -47,6 +47,16 @@ protected:
         return true;
     }
 
+    virtual CallEntry callEntry() override
+    {
+        return specializedCallEntry;
+    }
+
+    static Value specializedCallEntry(ScriptFunctionObject* self, ExecutionState& state, const Value& thisValue, const size_t argc, Value* argv)
+    {
+        return static_cast<ScriptSimpleFunctionObject*>(self)->ScriptSimpleFunctionObject::call(state, thisValue, argc, argv);
+    }
+
     virtual Value call(ExecutionState& state, const Value& thisValue, const size_t argc, Value* argv) override
     {
         CHECK_STACK_OVERFLOW(state);
@@ -191,20 +191,24 @@ FOR_EACH_LAZY_THREADING_STATIC_STRING(DECLARE_LAZY_STATIC_STRING);
 
 ::Escargot::String* StaticStrings::dtoa(double d) const
 {
-    size_t size = dtoaCache.size();
-
-    for (size_t i = 0; i < size; ++i) {
-        if (dtoaCache[i].first == d) {
-            return dtoaCache[i].second;
-        }
+    if (UNLIKELY(!dtoaCache)) {
+        dtoaCache = (DtoaCacheEntry*)GC_MALLOC(sizeof(DtoaCacheEntry) * (1 << ESCARGOT_DTOA_CACHE_SIZE_BITS));
     }
 
-    ::Escargot::String* s = String::fromDouble(d);
-    dtoaCache.insert(0, std::make_pair(d, s));
-    if (dtoaCache.size() > dtoaCacheSize) {
-        dtoaCache.erase(dtoaCache.size() - 1);
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(double));
+    // multiplicative hashing mixes every bit into the upper bits
+    // integral numbers have many zero bits in the lower part
+    size_t index = (size_t)((bits * 0x9E3779B97F4A7C15ULL) >> (64 - ESCARGOT_DTOA_CACHE_SIZE_BITS));
+
+    DtoaCacheEntry& entry = dtoaCache[index];
+    if (LIKELY(entry.m_string && entry.m_bits == bits)) {
+        return entry.m_string;
     }
 
+    ::Escargot::String* s = String::fromDouble(d);
+    entry.m_bits = bits;
+    entry.m_string = s;
     return s;
 }
 } // namespace Escargot
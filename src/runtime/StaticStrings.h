@@ -925,11 +925,15 @@ namespace Escargot {
 
 #define ESCARGOT_ASCII_TABLE_MAX 256
 #define ESCARGOT_STRINGS_NUMBERS_MAX 128
+// number of entries of number to string cache is (1 << ESCARGOT_DTOA_CACHE_SIZE_BITS)
+#ifndef ESCARGOT_DTOA_CACHE_SIZE_BITS
+#define ESCARGOT_DTOA_CACHE_SIZE_BITS 7
+#endif
 
 class StaticStrings {
 public:
     StaticStrings(AtomicStringMap* atomicStringMap)
-        : dtoaCacheSize(5)
+        : dtoaCache(nullptr)
         , m_atomicStringMap(atomicStringMap)
     {
         asciiTable = new (malloc(sizeof(AtomicString) * ESCARGOT_ASCII_TABLE_MAX)) AtomicString[ESCARGOT_ASCII_TABLE_MAX];
@@ -1084,8 +1088,12 @@ public:
 
     void initStaticStrings();
 
-    const size_t dtoaCacheSize; // 5;
-    mutable Vector<std::pair<double, ::Escargot::String*>, GCUtil::gc_malloc_allocator<std::pair<double, ::Escargot::String*>>> dtoaCache;
+    // direct-mapped cache of number to string conversion keyed by the bits of the number
+    struct DtoaCacheEntry {
+        uint64_t m_bits;
+        ::Escargot::String* m_string;
+    };
+    mutable DtoaCacheEntry* dtoaCache;
 
     ::Escargot::String* dtoa(double d) const;
 
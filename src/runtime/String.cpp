@@ -120,32 +120,17 @@ bool isAllSpecialCharacters(const std::string& s, bool (*fn)(char))
 
 bool isAllASCII(const char* buf, const size_t len)
 {
-    for (unsigned i = 0; i < len; i++) {
-        if ((buf[i] & 0x80) != 0) {
-            return false;
-        }
-    }
-    return true;
+    return StringKernels::isAllASCII((const LChar*)buf, len);
 }
 
 bool isAllASCII(const char16_t* buf, const size_t len)
 {
-    for (unsigned i = 0; i < len; i++) {
-        if (buf[i] >= 128) {
-            return false;
-        }
-    }
-    return true;
+    return StringKernels::isAllASCII(buf, len);
 }
 
 bool isAllLatin1(const char16_t* buf, const size_t len)
 {
-    for (unsigned i = 0; i < len; i++) {
-        if (buf[i] >= 256) {
-            return false;
-        }
-    }
-    return true;
+    return StringKernels::isAllLatin1(buf, len);
 }
 
 bool isIndexString(String* str)
@@ -385,14 +370,7 @@ bool isWellFormed(const char16_t*& utf16, const char16_t* bufferEnd)
 
 bool StringBufferAccessData::equals16Bit(const char16_t* c1, const char* c2, size_t len)
 {
-    while (len > 0) {
-        if (*c1++ != *c2++) {
-            return false;
-        }
-        len--;
-    }
-
-    return true;
+    return StringKernels::equalCharacters(c1, (const LChar*)c2, len);
 }
 
 UTF16StringData ASCIIString::toUTF16StringData() const
@@ -400,9 +378,7 @@ UTF16StringData ASCIIString::toUTF16StringData() const
     UTF16StringData ret;
     size_t len = length();
     ret.resizeWithUninitializedValues(len);
-    for (size_t i = 0; i < len; i++) {
-        ret[i] = charAt(i);
-    }
+    StringKernels::copyCharacters(ret.data(), ASCIIString::characters8(), len);
     return ret;
 }
 
@@ -421,9 +397,7 @@ UTF16StringData Latin1String::toUTF16StringData() const
     UTF16StringData ret;
     size_t len = length();
     ret.resizeWithUninitializedValues(len);
-    for (size_t i = 0; i < len; i++) {
-        ret[i] = charAt(i);
-    }
+    StringKernels::copyCharacters(ret.data(), Latin1String::characters8(), len);
     return ret;
 }
 
@@ -476,113 +450,61 @@ UTF8StringDataNonGCStd UTF16String::toNonGCUTF8StringData(int options) const
     return bufferAccessData().toUTF8String<UTF8StringDataNonGCStd>(options);
 }
 
-enum Flags : unsigned {
-    NO_FLAGS = 0,
-    EMIT_POSITIVE_EXPONENT_SIGN = 1,
-    EMIT_TRAILING_DECIMAL_POINT = 2,
-    EMIT_TRAILING_ZERO_AFTER_POINT = 4,
-    UNIQUE_ZERO = 8
-};
-
-void CreateDecimalRepresentation(
-    int flags_,
-    const char* decimal_digits,
-    int length,
-    int decimal_point,
-    int digits_after_point,
-    double_conversion::StringBuilder* result_builder)
-{
-    // Create a representation that is padded with zeros if needed.
-    if (decimal_point <= 0) {
-        // "0.00000decimal_rep".
-        result_builder->AddCharacter('0');
-        if (digits_after_point > 0) {
-            result_builder->AddCharacter('.');
-            result_builder->AddPadding('0', -decimal_point);
-            ASSERT(length <= digits_after_point - (-decimal_point));
-            result_builder->AddSubstring(decimal_digits, length);
-            int remaining_digits = digits_after_point - (-decimal_point) - length;
-            result_builder->AddPadding('0', remaining_digits);
-        }
-    } else if (decimal_point >= length) {
-        // "decimal_rep0000.00000" or "decimal_rep.0000"
-        result_builder->AddSubstring(decimal_digits, length);
-        result_builder->AddPadding('0', decimal_point - length);
-        if (digits_after_point > 0) {
-            result_builder->AddCharacter('.');
-            result_builder->AddPadding('0', digits_after_point);
-        }
-    } else {
-        // "decima.l_rep000"
-        ASSERT(digits_after_point > 0);
-        result_builder->AddSubstring(decimal_digits, decimal_point);
-        result_builder->AddCharacter('.');
-        ASSERT(length - decimal_point <= digits_after_point);
-        result_builder->AddSubstring(&decimal_digits[decimal_point],
-                                     length - decimal_point);
-        int remaining_digits = digits_after_point - (length - decimal_point);
-        result_builder->AddPadding('0', remaining_digits);
-    }
-    if (digits_after_point == 0) {
-        if ((flags_ & EMIT_TRAILING_DECIMAL_POINT) != 0) {
-            result_builder->AddCharacter('.');
-        }
-        if ((flags_ & EMIT_TRAILING_ZERO_AFTER_POINT) != 0) {
-            result_builder->AddCharacter('0');
-        }
-    }
-}
-
-void CreateExponentialRepresentation(
-    int flags_,
-    const char* decimal_digits,
-    int length,
-    int exponent,
-    double_conversion::StringBuilder* result_builder)
+static const char s_twoDigitsTable[201] = "00010203040506070809"
+                                           "10111213141516171819"
+                                           "20212223242526272829"
+                                           "30313233343536373839"
+                                           "40414243444546474849"
+                                           "50515253545556575859"
+                                           "60616263646566676869"
+                                           "70717273747576777879"
+                                           "80818283848586878889"
+                                           "90919293949596979899";
+
+// writes decimal digits of value into buffer and returns the number of written characters
+static size_t writeDecimalInteger(uint64_t value, char* buffer)
 {
-    ASSERT(length != 0);
-    result_builder->AddCharacter(decimal_digits[0]);
-    if (length != 1) {
-        result_builder->AddCharacter('.');
-        result_builder->AddSubstring(&decimal_digits[1], length - 1);
+    char digits[20];
+    size_t position = sizeof(digits);
+    while (value >= 100) {
+        size_t index = (value % 100) * 2;
+        value /= 100;
+        digits[--position] = s_twoDigitsTable[index + 1];
+        digits[--position] = s_twoDigitsTable[index];
     }
-    result_builder->AddCharacter('e');
-    if (exponent < 0) {
-        result_builder->AddCharacter('-');
-        exponent = -exponent;
+    if (value >= 10) {
+        size_t index = value * 2;
+        digits[--position] = s_twoDigitsTable[index + 1];
+        digits[--position] = s_twoDigitsTable[index];
     } else {
-        if ((flags_ & EMIT_POSITIVE_EXPONENT_SIGN) != 0) {
-            result_builder->AddCharacter('+');
-        }
-    }
-    if (exponent == 0) {
-        result_builder->AddCharacter('0');
-        return;
-    }
-    ASSERT(exponent < 1e4);
-    const int kMaxExponentLength = 5;
-    char buffer[kMaxExponentLength + 1];
-    buffer[kMaxExponentLength] = '\0';
-    int first_char_pos = kMaxExponentLength;
-    while (exponent > 0) {
-        buffer[--first_char_pos] = '0' + (exponent % 10);
-        exponent /= 10;
+        digits[--position] = '0' + value;
     }
-    result_builder->AddSubstring(&buffer[first_char_pos],
-                                 kMaxExponentLength - first_char_pos);
+
+    size_t length = sizeof(digits) - position;
+    memcpy(buffer, digits + position, length);
+    return length;
 }
 
-ASCIIStringDataNonGCStd dtoa(double number)
+size_t dtoa(double number, char* buffer)
 {
+    char* cursor = buffer;
     if (number == 0) {
-        return "0";
+        *cursor = '0';
+        return 1;
     }
-    const int flags = UNIQUE_ZERO | EMIT_POSITIVE_EXPONENT_SIGN;
-    bool sign = false;
+
     if (number < 0) {
-        sign = true;
+        *cursor++ = '-';
         number = -number;
     }
+
+    // integers below 2^53 are written directly without shortest digit generation
+    const double maxSafeInteger = 9007199254740992.0;
+    if (number < maxSafeInteger && number == (double)(uint64_t)number) {
+        cursor += writeDecimalInteger((uint64_t)number, cursor);
+        return cursor - buffer;
+    }
+
     // The maximal number of digits that are needed to emit a double in base 10.
     // A higher precision can be achieved by using more digits, but the shortest
     // accurate representation of any double will never use more digits than
@@ -591,49 +513,68 @@ ASCIIStringDataNonGCStd dtoa(double number)
     // should be at least kBase10MaximalLength + 1 characters long.
     const int kBase10MaximalLength = 17;
     const int kDecimalRepCapacity = kBase10MaximalLength + 1;
-    char decimal_rep[kDecimalRepCapacity];
-    int decimal_rep_length;
-    int decimal_point;
-    double_conversion::Vector<char> vector(decimal_rep, kDecimalRepCapacity);
-    bool fast_worked = FastDtoa(number, double_conversion::FAST_DTOA_SHORTEST, 0, vector, &decimal_rep_length, &decimal_point);
-    if (!fast_worked) {
-        BignumDtoa(number, double_conversion::BIGNUM_DTOA_SHORTEST, 0, vector, &decimal_rep_length, &decimal_point);
-        vector[decimal_rep_length] = '\0';
+    char decimalRep[kDecimalRepCapacity];
+    int length;
+    int decimalPoint;
+    double_conversion::Vector<char> vector(decimalRep, kDecimalRepCapacity);
+    bool fastWorked = FastDtoa(number, double_conversion::FAST_DTOA_SHORTEST, 0, vector, &length, &decimalPoint);
+    if (!fastWorked) {
+        BignumDtoa(number, double_conversion::BIGNUM_DTOA_SHORTEST, 0, vector, &length, &decimalPoint);
     }
-
-    /* reserve(decimal_rep_length + sign ? 1 : 0);
-    if (sign)
-        operator +=('-');
-    for (unsigned i = 0; i < decimal_rep_length; i ++) {
-        operator +=(decimal_rep[i]);
-    }*/
-
-    const int bufferLength = 128;
-    char buffer[bufferLength];
-    double_conversion::StringBuilder builder(buffer, bufferLength);
-
-    int exponent = decimal_point - 1;
-    const int decimal_in_shortest_low_ = -6;
-    const int decimal_in_shortest_high_ = 21;
-    if ((decimal_in_shortest_low_ <= exponent)
-        && (exponent < decimal_in_shortest_high_)) {
-        CreateDecimalRepresentation(flags, decimal_rep, decimal_rep_length,
-                                    decimal_point,
-                                    double_conversion::Max(0, decimal_rep_length - decimal_point),
-                                    &builder);
+    ASSERT(length > 0 && length <= kBase10MaximalLength);
+
+    // https://tc39.es/ecma262/#sec-numeric-types-number-tostring
+    int exponent = decimalPoint - 1;
+    if (-6 <= exponent && exponent < 21) {
+        if (decimalPoint <= 0) {
+            // "0.00000decimal_rep"
+            *cursor++ = '0';
+            *cursor++ = '.';
+            memset(cursor, '0', -decimalPoint);
+            cursor += -decimalPoint;
+            memcpy(cursor, decimalRep, length);
+            cursor += length;
+        } else if (decimalPoint >= length) {
+            // "decimal_rep0000"
+            memcpy(cursor, decimalRep, length);
+            cursor += length;
+            memset(cursor, '0', decimalPoint - length);
+            cursor += decimalPoint - length;
+        } else {
+            // "decima.l_rep"
+            memcpy(cursor, decimalRep, decimalPoint);
+            cursor += decimalPoint;
+            *cursor++ = '.';
+            memcpy(cursor, decimalRep + decimalPoint, length - decimalPoint);
+            cursor += length - decimalPoint;
+        }
     } else {
-        CreateExponentialRepresentation(flags, decimal_rep, decimal_rep_length, exponent,
-                                        &builder);
-    }
-    ASCIIStringDataNonGCStd str;
-    if (sign)
-        str += '-';
-    char* buf = builder.Finalize();
-    while (*buf) {
-        str += *buf;
-        buf++;
+        // "d.ecimal_repe+exponent"
+        *cursor++ = decimalRep[0];
+        if (length != 1) {
+            *cursor++ = '.';
+            memcpy(cursor, decimalRep + 1, length - 1);
+            cursor += length - 1;
+        }
+        *cursor++ = 'e';
+        if (exponent < 0) {
+            *cursor++ = '-';
+            exponent = -exponent;
+        } else {
+            *cursor++ = '+';
+        }
+        cursor += writeDecimalInteger(exponent, cursor);
     }
-    return str;
+
+    ASSERT((size_t)(cursor - buffer) < DTOA_BUFFER_SIZE);
+    return cursor - buffer;
+}
+
+ASCIIStringDataNonGCStd dtoa(double number)
+{
+    char buffer[DTOA_BUFFER_SIZE];
+    size_t length = dtoa(number, buffer);
+    return ASCIIStringDataNonGCStd(buffer, length);
 }
 
 void String::initEmptyString()
@@ -727,8 +668,9 @@ String* String::fromLatin1(const char16_t* src, size_t len)
 
 String* String::fromDouble(double v)
 {
-    auto s = dtoa(v);
-    return String::fromASCII(s.data(), s.length());
+    char buffer[DTOA_BUFFER_SIZE];
+    size_t length = dtoa(v, buffer);
+    return String::fromASCII(buffer, length);
 }
 
 String* String::fromUTF8(const char* src, size_t len, bool maybeASCII)
@@ -771,16 +713,26 @@ String* String::fromCharCode(char32_t code)
 
 int String::stringCompare(size_t l1, size_t l2, const String* c1, const String* c2)
 {
-    size_t s = 0;
-    const unsigned lmin = l1 < l2 ? l1 : l2;
-    unsigned pos = 0;
-    while (pos < lmin && c1->charAt(s) == c2->charAt(s)) {
-        ++s;
-        ++pos;
+    const size_t lmin = l1 < l2 ? l1 : l2;
+    const auto& d1 = c1->bufferAccessData();
+    const auto& d2 = c2->bufferAccessData();
+    size_t pos;
+    if (d1.has8BitContent) {
+        if (d2.has8BitContent) {
+            pos = StringKernels::findFirstMismatch((const LChar*)d1.bufferAs8Bit, (const LChar*)d2.bufferAs8Bit, lmin);
+        } else {
+            pos = StringKernels::findFirstMismatch(d2.bufferAs16Bit, (const LChar*)d1.bufferAs8Bit, lmin);
+        }
+    } else {
+        if (d2.has8BitContent) {
+            pos = StringKernels::findFirstMismatch(d1.bufferAs16Bit, (const LChar*)d2.bufferAs8Bit, lmin);
+        } else {
+            pos = StringKernels::findFirstMismatch(d1.bufferAs16Bit, d2.bufferAs16Bit, lmin);
+        }
     }
 
     if (pos < lmin)
-        return (c1->charAt(s) > c2->charAt(s)) ? 1 : -1;
+        return (d1.charAt(pos) > d2.charAt(pos)) ? 1 : -1;
 
     if (l1 == l2)
         return 0;
@@ -907,6 +859,15 @@ String* String::toWellFormed()
     return new UTF16String(std::move(result));
 }
 
+template <typename T>
+static ALWAYS_INLINE size_t findInBuffer(const StringBufferAccessData& data, const T* pattern, size_t patternLength, size_t pos)
+{
+    if (data.has8BitContent) {
+        return StringKernels::findSubstring((const LChar*)data.bufferAs8Bit, data.length, pattern, patternLength, pos);
+    }
+    return StringKernels::findSubstring(data.bufferAs16Bit, data.length, pattern, patternLength, pos);
+}
+
 size_t String::find(String* str, size_t pos) const
 {
     const size_t srcStrLen = str->length();
@@ -916,37 +877,12 @@ size_t String::find(String* str, size_t pos) const
         return pos <= size ? pos : SIZE_MAX;
 
     if (srcStrLen <= size) {
-        char32_t src0 = str->charAt(0);
         const auto& data = bufferAccessData();
-        if (data.has8BitContent) {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const LChar*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const LChar*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        } else {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const char16_t*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const char16_t*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
+        const auto& srcData = str->bufferAccessData();
+        if (srcData.has8BitContent) {
+            return findInBuffer(data, (const LChar*)srcData.bufferAs8Bit, srcStrLen, pos);
         }
+        return findInBuffer(data, srcData.bufferAs16Bit, srcStrLen, pos);
     }
     return SIZE_MAX;
 }
@@ -959,37 +895,7 @@ size_t String::find(const char* str, size_t srcStrLen, size_t pos) const
         return pos <= size ? pos : SIZE_MAX;
 
     if (srcStrLen <= size) {
-        char32_t src0 = str[0];
-        const auto& data = bufferAccessData();
-        if (data.has8BitContent) {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const LChar*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const LChar*)data.buffer)[pos + k] != str[k]) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        } else {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const char16_t*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const char16_t*)data.buffer)[pos + k] != str[k]) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        }
+        return findInBuffer(bufferAccessData(), (const LChar*)str, srcStrLen, pos);
     }
     return SIZE_MAX;
 }
@@ -1001,20 +907,19 @@ size_t String::rfind(String* str, size_t pos)
     if (srcStrLen == 0)
         return pos <= size ? pos : -1;
     if (srcStrLen <= size) {
-        do {
-            bool same = true;
-            if (pos >= size) {
-                continue;
-            }
-            for (size_t k = 0; k < srcStrLen; k++) {
-                if (charAt(pos + k) != str->charAt(k)) {
-                    same = false;
-                    break;
-                }
+        // searching starts from min(pos, size - srcStrLen)
+        const auto& data = bufferAccessData();
+        const auto& srcData = str->bufferAccessData();
+        if (data.has8BitContent) {
+            if (srcData.has8BitContent) {
+                return StringKernels::findLastSubstring((const LChar*)data.bufferAs8Bit, size, (const LChar*)srcData.bufferAs8Bit, srcStrLen, pos);
             }
-            if (same)
-                return pos;
-        } while (pos-- > 0);
+            return StringKernels::findLastSubstring((const LChar*)data.bufferAs8Bit, size, srcData.bufferAs16Bit, srcStrLen, pos);
+        }
+        if (srcData.has8BitContent) {
+            return StringKernels::findLastSubstring(data.bufferAs16Bit, size, (const LChar*)srcData.bufferAs8Bit, srcStrLen, pos);
+        }
+        return StringKernels::findLastSubstring(data.bufferAs16Bit, size, srcData.bufferAs16Bit, srcStrLen, pos);
     }
     return SIZE_MAX;
 }
@@ -1022,7 +927,7 @@ size_t String::rfind(String* str, size_t pos)
 String* String::substring(size_t from, size_t to)
 {
     if (to - from > STRING_SUB_STRING_MIN_VIEW_LENGTH) {
-        StringView* str = new StringView(this, from, to);
+        StringView* str = StringView::createSlice(this, from, to);
         return str;
     }
     StringBuilder builder;
@@ -22,6 +22,7 @@
 
 #include "runtime/PointerValue.h"
 #include "util/BasicString.h"
+#include "util/StringKernels.h"
 #include "util/Vector.h"
 #include <string>
 
@@ -60,6 +61,10 @@ UTF16StringData utf8StringToUTF16String(const char* buf, const size_t len);
 UTF8StringData utf16StringToUTF8String(const char16_t* buf, const size_t len);
 ASCIIStringData utf16StringToASCIIString(const char16_t* buf, const size_t len);
 ASCIIStringDataNonGCStd dtoa(double number);
+// writes the shortest representation of number into buffer which has at least DTOA_BUFFER_SIZE bytes
+// returns the number of written characters (buffer is not null-terminated)
+#define DTOA_BUFFER_SIZE 32
+size_t dtoa(double number, char* buffer);
 size_t utf32ToUtf8(char32_t uc, char* UTF8);
 size_t utf32ToUtf16(char32_t i, char16_t* u);
 bool isWellFormed(const char16_t*& utf16, const char16_t* bufferEnd);
@@ -599,12 +604,7 @@ protected:
 
     static ALWAYS_INLINE bool stringEqual(const char16_t* s, const LChar* s1, const size_t len)
     {
-        for (size_t i = 0; i < len; i++) {
-            if (s[i] != s1[i]) {
-                return false;
-            }
-        }
-        return true;
+        return StringKernels::equalCharacters(s, s1, len);
     }
 };
 
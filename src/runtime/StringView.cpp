@@ -19,6 +19,8 @@
 
 #include "Escargot.h"
 #include "StringView.h"
+#include "runtime/StringViewCompactor.h"
+#include "runtime/ThreadLocal.h"
 
 namespace Escargot {
 
@@ -34,4 +36,49 @@ void* StringView::operator new(size_t size)
     }
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
+
+void* CompactableStringView::operator new(size_t size)
+{
+    static MAY_THREAD_LOCAL bool typeInited = false;
+    static MAY_THREAD_LOCAL GC_descr descr;
+    if (!typeInited) {
+        GC_word obj_bitmap[GC_BITMAP_SIZE(CompactableStringView)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(CompactableStringView, m_detachedString));
+        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(CompactableStringView));
+        typeInited = true;
+    }
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+
+StringView* StringView::createSlice(String* str, size_t s, size_t e)
+{
+    if (str->isStringView()) {
+        // refer the root string directly instead of nesting views
+        StringView* parentView = (StringView*)str;
+        s += parentView->m_start;
+        e += parentView->m_start;
+        str = parentView->m_bufferData.bufferAsString;
+    }
+
+    // compressible and reloadable strings own their finalizer
+    if (UNLIKELY(str->length() >= STRING_VIEW_COMPACTION_MIN_PARENT_LENGTH && !str->isCompressibleString() && !str->isReloadableString())) {
+        CompactableStringView* view = new CompactableStringView(str, s, e);
+        ThreadLocal::stringViewCompactor()->track(view);
+        return view;
+    }
+    return new StringView(str, s, e);
+}
+
+void CompactableStringView::detachFromParent()
+{
+    const auto& data = bufferAccessData();
+    String* copied;
+    if (data.has8BitContent) {
+        copied = String::fromLatin1((const LChar*)data.bufferAs8Bit, data.length);
+    } else {
+        copied = new UTF16String(data.bufferAs16Bit, data.length);
+    }
+    m_detachedString = copied;
+    initBufferAccessData(copied, 0, copied->length());
+}
 } // namespace Escargot
@@ -136,6 +136,10 @@ public:
         return true;
     }
 
+    // allocate a slice of `str` on the heap
+    // slices of a large string are tracked so that GC can copy them out and release the large string
+    static StringView* createSlice(String* str, size_t s, size_t e);
+
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
 
@@ -167,6 +171,35 @@ protected:
 private:
     size_t m_start;
 };
+
+// slice of a large string whose pointer to the parent is hidden from GC
+// StringViewCompactor keeps the parent alive with a finalizer and copies the slice out
+// once nothing else refers to the parent
+class CompactableStringView : public StringView {
+    friend class StringViewCompactor;
+
+public:
+    CompactableStringView(String* str, const size_t s, const size_t e)
+        : StringView(str, s, e)
+        , m_detachedString(nullptr)
+    {
+    }
+
+    String* parent() const
+    {
+        return m_bufferData.bufferAsString;
+    }
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+
+private:
+    // replace the parent with a standalone copy of this slice
+    void detachFromParent();
+
+    // the only field scanned by GC
+    String* m_detachedString;
+};
 } // namespace Escargot
 
 #endif
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#include "Escargot.h"
+#include "StringViewCompactor.h"
+#include "runtime/StringView.h"
+#include "runtime/ThreadLocal.h"
+
+namespace Escargot {
+
+StringViewCompactor::StringViewCompactor()
+    : m_retiredParents(nullptr)
+    , m_retiredParentCount(0)
+    , m_retiredParentCapacity(0)
+    , m_retiredParentCountAtMarkEnd(0)
+    , m_retainedBytes(0)
+    , m_usedBytes(0)
+{
+    GCEventListenerSet& list = ThreadLocal::gcEventListenerSet();
+    list.ensureMarkEndListeners()->push_back(std::make_pair(markEndCallback, this));
+    list.ensureReclaimEndListeners()->push_back(std::make_pair(reclaimEndCallback, this));
+}
+
+StringViewCompactor::~StringViewCompactor()
+{
+    // run finalizers already queued because they refer this compactor
+    GC_invoke_finalizers();
+
+    for (auto iter = m_viewsOfParent.begin(); iter != m_viewsOfParent.end(); iter++) {
+        GC_REGISTER_FINALIZER_NO_ORDER(iter->first, nullptr, nullptr, nullptr, nullptr);
+    }
+
+    if (m_retiredParents) {
+        GC_FREE(m_retiredParents);
+    }
+}
+
+static size_t stringByteLength(String* str)
+{
+    return str->length() * (str->has8BitContent() ? 1 : 2);
+}
+
+void StringViewCompactor::track(CompactableStringView* view)
+{
+    std::vector<CompactableStringView*>& views = m_viewsOfParent[view->parent()];
+    if (views.empty()) {
+        // tracked views do not keep the parent alive, this finalizer does
+        GC_REGISTER_FINALIZER_NO_ORDER(view->parent(), parentFinalizer, this, nullptr, nullptr);
+    }
+    views.push_back(view);
+}
+
+void StringViewCompactor::markEndCallback(void* data)
+{
+    StringViewCompactor* self = (StringViewCompactor*)data;
+    self->sweepDeadViews();
+}
+
+void StringViewCompactor::reclaimEndCallback(void* data)
+{
+    StringViewCompactor* self = (StringViewCompactor*)data;
+    self->releaseParents();
+}
+
+void StringViewCompactor::parentFinalizer(void* obj, void* data)
+{
+    StringViewCompactor* self = (StringViewCompactor*)data;
+    self->compactViewsOf((String*)obj);
+}
+
+// NOTE GC holds its lock here, so we should not allocate any GC memory
+void StringViewCompactor::sweepDeadViews()
+{
+    // parents retired before this mark phase are released at the end of reclaiming
+    m_retiredParentCountAtMarkEnd = m_retiredParentCount;
+
+    m_retainedBytes = 0;
+    m_usedBytes = 0;
+    for (auto iter = m_viewsOfParent.begin(); iter != m_viewsOfParent.end();) {
+        std::vector<CompactableStringView*>& views = iter->second;
+        size_t liveCount = 0;
+        size_t usedBytes = 0;
+        for (size_t i = 0; i < views.size(); i++) {
+            if (GC_is_marked(views[i])) {
+                usedBytes += stringByteLength(views[i]);
+                views[liveCount++] = views[i];
+            }
+        }
+        views.resize(liveCount);
+
+        if (!liveCount) {
+            m_parentsWithoutViews.push_back(iter->first);
+            iter = m_viewsOfParent.erase(iter);
+            continue;
+        }
+
+        // an unmarked parent is referred only by tracked views, and its finalizer compacts them
+        if (GC_is_marked(iter->first)) {
+            m_retainedBytes += stringByteLength(iter->first);
+            m_usedBytes += usedBytes;
+        }
+        iter++;
+    }
+}
+
+void StringViewCompactor::releaseParents()
+{
+    for (size_t i = 0; i < m_parentsWithoutViews.size(); i++) {
+        GC_REGISTER_FINALIZER_NO_ORDER(m_parentsWithoutViews[i], nullptr, nullptr, nullptr, nullptr);
+    }
+    m_parentsWithoutViews.clear();
+
+    if (m_retiredParentCountAtMarkEnd) {
+        size_t remain = m_retiredParentCount - m_retiredParentCountAtMarkEnd;
+        memmove(m_retiredParents, m_retiredParents + m_retiredParentCountAtMarkEnd, sizeof(String*) * remain);
+        memset(m_retiredParents + remain, 0, sizeof(String*) * m_retiredParentCountAtMarkEnd);
+        m_retiredParentCount = remain;
+        m_retiredParentCountAtMarkEnd = 0;
+    }
+}
+
+void StringViewCompactor::compactViewsOf(String* parent)
+{
+    auto iter = m_viewsOfParent.find(parent);
+    if (iter == m_viewsOfParent.end()) {
+        return;
+    }
+
+    size_t usedBytes = 0;
+    for (size_t i = 0; i < iter->second.size(); i++) {
+        usedBytes += stringByteLength(iter->second[i]);
+    }
+
+    if (usedBytes * STRING_VIEW_COMPACTION_RATIO >= stringByteLength(parent)) {
+        // copying would not save enough memory, keep the parent for the views
+        GC_REGISTER_FINALIZER_NO_ORDER(parent, parentFinalizer, this, nullptr, nullptr);
+        return;
+    }
+
+    // detaching allocates and may run GC, so the entry is removed first
+    std::vector<CompactableStringView*> views = std::move(iter->second);
+    m_viewsOfParent.erase(iter);
+
+    retireParent(parent);
+    for (size_t i = 0; i < views.size(); i++) {
+        views[i]->detachFromParent();
+    }
+}
+
+void StringViewCompactor::retireParent(String* parent)
+{
+    if (m_retiredParentCount == m_retiredParentCapacity) {
+        size_t newCapacity = std::max(m_retiredParentCapacity * 2, (size_t)4);
+        String** newParents = (String**)GC_MALLOC_UNCOLLECTABLE(sizeof(String*) * newCapacity);
+        if (m_retiredParents) {
+            memcpy(newParents, m_retiredParents, sizeof(String*) * m_retiredParentCount);
+            GC_FREE(m_retiredParents);
+        }
+        m_retiredParents = newParents;
+        m_retiredParentCapacity = newCapacity;
+    }
+    m_retiredParents[m_retiredParentCount++] = parent;
+}
+
+} // namespace Escargot
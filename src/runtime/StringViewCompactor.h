@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotStringViewCompactor__
+#define __EscargotStringViewCompactor__
+
+namespace Escargot {
+
+class String;
+class CompactableStringView;
+
+// StringViewCompactor copies small slices of a large string into standalone strings
+// once the large string is reachable only through those slices
+// slices hide their parent from GC, and the parent is kept alive by a finalizer registered here
+// the finalizer runs when nothing else refers to the parent, and it copies the slices out
+class StringViewCompactor {
+public:
+    StringViewCompactor();
+    ~StringViewCompactor();
+
+    void track(CompactableStringView* view);
+
+    // bytes of large strings that tracked views keep alive, measured at the last GC
+    size_t retainedBytes() const
+    {
+        return m_retainedBytes;
+    }
+
+    // bytes that tracked views actually refer to, measured at the last GC
+    size_t usedBytes() const
+    {
+        return m_usedBytes;
+    }
+
+private:
+    static void markEndCallback(void* data);
+    static void reclaimEndCallback(void* data);
+    static void parentFinalizer(void* obj, void* data);
+
+    void sweepDeadViews();
+    void releaseParents();
+    void compactViewsOf(String* parent);
+    void retireParent(String* parent);
+
+    // these containers are not scanned by GC
+    // dead views are dropped at the end of each mark phase
+    // parents are compared by address, std::hash<String*> hashes the contents
+    std::unordered_map<String*, std::vector<CompactableStringView*>, std::hash<void*>, std::equal_to<void*>> m_viewsOfParent;
+    // parents which lost all of their views, their finalizer is removed at the end of reclaiming
+    std::vector<String*> m_parentsWithoutViews;
+
+    // parents detached by the compaction are kept alive during one more GC
+    // because native code may still hold a pointer into their buffer
+    String** m_retiredParents;
+    size_t m_retiredParentCount;
+    size_t m_retiredParentCapacity;
+    size_t m_retiredParentCountAtMarkEnd;
+
+    size_t m_retainedBytes;
+    size_t m_usedBytes;
+};
+
+} // namespace Escargot
+
+#endif
@@ -23,6 +23,7 @@
 #include "runtime/Global.h"
 #include "runtime/Platform.h"
 #include "parser/ASTAllocator.h"
+#include "runtime/StringViewCompactor.h"
 #include "BumpPointerAllocator.h"
 #if defined(ENABLE_WASM)
 #include "wasm.h"
@@ -50,6 +51,7 @@ MAY_THREAD_LOCAL WASMContext ThreadLocal::g_wasmContext;
 #endif
 MAY_THREAD_LOCAL GCEventListenerSet* ThreadLocal::g_gcEventListenerSet;
 MAY_THREAD_LOCAL ASTAllocator* ThreadLocal::g_astAllocator;
+MAY_THREAD_LOCAL StringViewCompactor* ThreadLocal::g_stringViewCompactor;
 MAY_THREAD_LOCAL WTF::BumpPointerAllocator* ThreadLocal::g_bumpPointerAllocator;
 MAY_THREAD_LOCAL void* ThreadLocal::g_customData;
 
@@ -203,6 +205,10 @@ void ThreadLocal::initialize()
     // in addition, register genericGCEventListener here too
     GC_set_on_collection_event(genericGCEventListener);
 
+    // g_stringViewCompactor
+    // it registers gc event listeners, so it should be created after g_gcEventListenerSet
+    g_stringViewCompactor = new StringViewCompactor();
+
     // g_astAllocator
     g_astAllocator = new ASTAllocator();
 
@@ -243,6 +249,10 @@ void ThreadLocal::finalize()
     g_wasmContext.lastGCCheckTime = 0;
 #endif
 
+    // g_stringViewCompactor
+    delete g_stringViewCompactor;
+    g_stringViewCompactor = nullptr;
+
     // g_gcEventListenerSet
     delete g_gcEventListenerSet;
     g_gcEventListenerSet = nullptr;
@@ -37,6 +37,7 @@ struct WASMContext {
 namespace Escargot {
 
 class ASTAllocator;
+class StringViewCompactor;
 
 class GCEventListenerSet {
 public:
@@ -99,6 +100,7 @@ class ThreadLocal {
 #endif
     static MAY_THREAD_LOCAL GCEventListenerSet* g_gcEventListenerSet;
     static MAY_THREAD_LOCAL ASTAllocator* g_astAllocator;
+    static MAY_THREAD_LOCAL StringViewCompactor* g_stringViewCompactor;
     static MAY_THREAD_LOCAL WTF::BumpPointerAllocator* g_bumpPointerAllocator;
     // custom data allocated by user through Platform::allocateThreadLocalCustomData
     static MAY_THREAD_LOCAL void* g_customData;
@@ -160,6 +162,12 @@ public:
         return g_astAllocator;
     }
 
+    static StringViewCompactor* stringViewCompactor()
+    {
+        ASSERT(inited && !!g_stringViewCompactor);
+        return g_stringViewCompactor;
+    }
+
     static WTF::BumpPointerAllocator* bumpPointerAllocator()
     {
         ASSERT(inited && !!g_bumpPointerAllocator);
@@ -27,6 +27,7 @@
 #include "runtime/StringObject.h"
 #include "runtime/DateObject.h"
 #include "runtime/JobQueue.h"
+#include "runtime/Job.h"
 #include "runtime/CompressibleString.h"
 #include "runtime/ReloadableString.h"
 #include "intl/Intl.h"
@@ -191,6 +192,7 @@ void* VMInstance::operator new(size_t size)
 #endif
 #if defined(ENABLE_THREADING)
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_asyncWaiterData));
+        GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_jobsFromAnotherThread));
 #endif
 
         descr = GC_make_descriptor(desc, GC_WORD_LEN(VMInstance));
@@ -201,12 +203,26 @@ void* VMInstance::operator new(size_t size)
 
 void vmMarkStartCallback(void* data)
 {
+    VMInstance* self = (VMInstance*)data;
+
+    // unreachable register files in the free list are reclaimed by this GC
+    self->m_generatorRegisterFileFreeList.clear();
+
+    {
+        // call-site caches should not keep their callees alive
+        auto& v = self->compiledByteCodeBlocks();
+        for (size_t i = 0; i < v.size(); i++) {
+            v[i]->clearCallInlineCaches();
+        }
+    }
+
 #if !defined(ESCARGOT_DEBUGGER)
     // in debugger mode, do not remove ByteCodeBlock
-    VMInstance* self = (VMInstance*)data;
 
-    if (self->m_regexpCache->size() > REGEXP_CACHE_SIZE_MAX || UNLIKELY(self->inIdleMode())) {
+    if (UNLIKELY(self->inIdleMode())) {
         self->m_regexpCache->clear();
+    } else {
+        self->m_regexpCache->evictIfNeeded(REGEXP_CACHE_BYTE_BUDGET);
     }
 
     auto& currentCodeSizeTotal = self->compiledByteCodeSize();
@@ -262,7 +278,7 @@ void vmReclaimEndCallback(void* data)
     if (t == GC_EventType::GC_EVENT_RECLAIM_END) {
         printf("Done GC: HeapSize: [%f MB , %f MB]\n", GC_get_memory_use() / 1024.f / 1024.f, GC_get_heap_size() / 1024.f / 1024.f);
         printf("bytecode Size %f KiB codeblock count %zu\n", self->compiledByteCodeSize() / 1024.f, self->m_compiledByteCodeBlocks.size());
-        printf("regexp cache size %zu\n", self->regexpCache()->size());
+        printf("regexp cache size %zu hit %zu miss %zu\n", self->regexpCache()->size(), self->regexpCache()->hitCount(), self->regexpCache()->missCount());
     }
     */
 }
@@ -294,6 +310,11 @@ VMInstance::~VMInstance()
 
     m_isFinalized = true;
 
+#if defined(ENABLE_THREADING)
+    // stop works running on another thread before contexts are gone
+    cancelJobsFromAnotherThread();
+#endif
+
     // remove gc event callback
     if (ThreadLocal::isInited()) {
         GCEventListenerSet& list = ThreadLocal::gcEventListenerSet();
@@ -367,6 +388,9 @@ VMInstance::VMInstance(const char* locale, const char* timezone, const char* bas
 #if defined(ENABLE_CODE_CACHE)
     , m_codeCache(nullptr)
 #endif
+#if defined(ENABLE_THREADING)
+    , m_eventFromAnotherThreadChannel(std::make_shared<EventFromAnotherThreadChannel>())
+#endif
 {
     GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj, void*) {
         VMInstance* self = (VMInstance*)obj;
@@ -382,7 +406,7 @@ VMInstance::VMInstance(const char* locale, const char* timezone, const char* bas
 
     m_toStringRecursionPreventer = new ToStringRecursionPreventer();
 
-    m_regexpCache = new (GC) RegExpCacheMap();
+    m_regexpCache = new RegExpCache();
     m_regexpOptionStringCache = (ASCIIString**)GC_MALLOC(256 * sizeof(ASCIIString*));
     memset(m_regexpOptionStringCache, 0, 256 * sizeof(ASCIIString*));
 
@@ -653,6 +677,29 @@ void VMInstance::addObjectStructureToRootSet(ObjectStructure* structure)
     structure->markReferencedByInlineCache();
 }
 
+Value* VMInstance::allocateGeneratorRegisterFile(size_t size)
+{
+    auto& list = m_generatorRegisterFileFreeList;
+    for (size_t i = list.size(); i > 0; i--) {
+        if (list[i - 1].second == size) {
+            Value* registerFile = list[i - 1].first;
+            list.erase(list.begin() + (i - 1));
+            return registerFile;
+        }
+    }
+    return (Value*)CustomAllocator<Value>().allocate(size);
+}
+
+void VMInstance::recycleGeneratorRegisterFile(Value* registerFile, size_t size)
+{
+    if (size > GENERATOR_REGISTER_FILE_RECYCLE_MAX_SIZE || m_generatorRegisterFileFreeList.size() >= GENERATOR_REGISTER_FILE_FREE_LIST_MAX_COUNT) {
+        return;
+    }
+    // same state as a newly allocated one. dead values should not be kept alive either
+    memset(static_cast<void*>(registerFile), 0, sizeof(Value) * size);
+    m_generatorRegisterFileFreeList.push_back(std::make_pair(registerFile, size));
+}
+
 class TempObjectStructure : public ObjectStructure {
 public:
     TempObjectStructure(ObjectStructureItem* properties, size_t propertyCount)
@@ -814,7 +861,7 @@ SandBox::SandBoxResult VMInstance::executePendingJob()
 bool VMInstance::hasPendingJobFromAnotherThread()
 {
 #if defined(ENABLE_THREADING)
-    return m_asyncWaiterData.size();
+    return m_asyncWaiterData.size() || m_jobsFromAnotherThread.size();
 #else
     return false;
 #endif
@@ -823,15 +870,15 @@ bool VMInstance::hasPendingJobFromAnotherThread()
 bool VMInstance::waitEventFromAnotherThread(unsigned timeoutInMillisecond)
 {
 #if defined(ENABLE_THREADING)
-    std::unique_lock<std::mutex> ul(m_asyncWaiterDataMutex);
-    if (m_pendingAsyncWaiterCount) {
+    std::unique_lock<std::mutex> ul(asyncWaiterDataMutex());
+    if (pendingAsyncWaiterCount()) {
         return true;
     }
     bool notified = true;
     if (timeoutInMillisecond) {
-        notified = m_waitEventFromAnotherThreadConditionVariable.wait_for(ul, std::chrono::milliseconds((int64_t)timeoutInMillisecond)) == std::cv_status::no_timeout;
+        notified = waitEventFromAnotherThreadConditionVariable().wait_for(ul, std::chrono::milliseconds((int64_t)timeoutInMillisecond)) == std::cv_status::no_timeout;
     } else {
-        m_waitEventFromAnotherThreadConditionVariable.wait(ul);
+        waitEventFromAnotherThreadConditionVariable().wait(ul);
     }
     return notified;
 #else
@@ -842,7 +889,7 @@ bool VMInstance::waitEventFromAnotherThread(unsigned timeoutInMillisecond)
 void VMInstance::executePendingJobFromAnotherThread()
 {
 #if defined(ENABLE_THREADING)
-    std::unique_lock<std::mutex> ul(m_asyncWaiterDataMutex);
+    std::unique_lock<std::mutex> ul(asyncWaiterDataMutex());
     for (size_t i = 0; i < m_asyncWaiterData.size(); i++) {
         if (std::get<2>(m_asyncWaiterData[i]) == nullptr) {
             Context* context = std::get<0>(m_asyncWaiterData[i]);
@@ -863,10 +910,59 @@ void VMInstance::executePendingJobFromAnotherThread()
             i--;
         }
     }
-    m_pendingAsyncWaiterCount = 0;
+
+    // ready jobs run without lock because they can enqueue another job
+    Vector<JobFromAnotherThread*, GCUtil::gc_malloc_allocator<JobFromAnotherThread*>> readyJobs;
+    for (size_t i = 0; i < m_jobsFromAnotherThread.size(); i++) {
+        if (m_jobsFromAnotherThread[i]->m_ticket->m_isReady) {
+            readyJobs.pushBack(m_jobsFromAnotherThread[i]);
+            m_jobsFromAnotherThread.erase(i);
+            i--;
+        }
+    }
+    pendingAsyncWaiterCount() = 0;
+    ul.unlock();
+
+    for (size_t i = 0; i < readyJobs.size(); i++) {
+        readyJobs[i]->m_ticket.reset();
+        readyJobs[i]->run();
+    }
 #endif
 }
 
+#if defined(ENABLE_THREADING)
+std::shared_ptr<JobFromAnotherThreadTicket> VMInstance::enqueueJobFromAnotherThread(JobFromAnotherThread* job)
+{
+    job->m_ticket = std::make_shared<JobFromAnotherThreadTicket>(m_eventFromAnotherThreadChannel);
+    std::unique_lock<std::mutex> ul(asyncWaiterDataMutex());
+    m_jobsFromAnotherThread.pushBack(job);
+    return job->m_ticket;
+}
+
+void VMInstance::cancelJobsFromAnotherThread(Context* context)
+{
+    // tickets are marked under the lock, so a work finishing now cannot mark them ready
+    Vector<JobFromAnotherThread*, GCUtil::gc_malloc_allocator<JobFromAnotherThread*>> canceledJobs;
+    std::unique_lock<std::mutex> ul(asyncWaiterDataMutex());
+    for (size_t i = 0; i < m_jobsFromAnotherThread.size(); i++) {
+        JobFromAnotherThread* job = m_jobsFromAnotherThread[i];
+        if (!context || job->relatedContext() == context) {
+            job->m_ticket->m_isCanceled = true;
+            job->m_ticket->m_isReady = false;
+            canceledJobs.pushBack(job);
+            m_jobsFromAnotherThread.erase(i);
+            i--;
+        }
+    }
+    ul.unlock();
+
+    for (size_t i = 0; i < canceledJobs.size(); i++) {
+        canceledJobs[i]->cancel();
+        canceledJobs[i]->m_ticket.reset();
+    }
+}
+#endif
+
 #if defined(ENABLE_ICU) && defined(ENABLE_INTL)
 // some locale have script value on it eg) zh_Hant_HK. so we need to remove it
 static std::string icuLocaleToBCP47LanguageRegionPair(const char* l)
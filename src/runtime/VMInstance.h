@@ -31,6 +31,23 @@ class Context;
 class CodeBlock;
 class JobQueue;
 class Job;
+#if defined(ENABLE_THREADING)
+class JobFromAnotherThread;
+class JobFromAnotherThreadTicket;
+
+// plain data which another thread uses to wake the thread of VMInstance up
+// it is shared by std::shared_ptr and holds no GC object, so another thread never touches VMInstance itself
+struct EventFromAnotherThreadChannel {
+    EventFromAnotherThreadChannel()
+        : m_pendingEventCount(0)
+    {
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_conditionVariable;
+    std::atomic_size_t m_pendingEventCount;
+};
+#endif
 class Symbol;
 class String;
 #if defined(ENABLE_COMPRESSIBLE_STRING)
@@ -190,17 +207,34 @@ public:
     bool hasPendingJobFromAnotherThread();
     bool waitEventFromAnotherThread(unsigned timeoutInMillisecond = 0); // zero means infinity
     void executePendingJobFromAnotherThread();
+#if defined(ENABLE_THREADING)
+    // job is kept until another thread marks the returned ticket ready
+    std::shared_ptr<JobFromAnotherThreadTicket> enqueueJobFromAnotherThread(JobFromAnotherThread* job);
+    // cancel jobs of every context if context is nullptr
+    void cancelJobsFromAnotherThread(Context* context = nullptr);
+#endif
 
     std::vector<ByteCodeBlock*>& compiledByteCodeBlocks()
     {
         return m_compiledByteCodeBlocks;
     }
 
+    // register file of generator and async function
+    // a small register file of finished function is kept in a free list and reused by the next one of the same size
+    // the free list is emptied at every GC start, so it never keeps its register files alive
+    Value* allocateGeneratorRegisterFile(size_t size);
+    void recycleGeneratorRegisterFile(Value* registerFile, size_t size);
+
     size_t& compiledByteCodeSize()
     {
         return m_compiledByteCodeSize;
     }
 
+    RegExpCache* regexpCache()
+    {
+        return m_regexpCache;
+    }
+
     size_t maxCompiledByteCodeSize()
     {
         return m_maxCompiledByteCodeSize;
@@ -380,17 +414,17 @@ public:
 
     std::mutex& asyncWaiterDataMutex()
     {
-        return m_asyncWaiterDataMutex;
+        return m_eventFromAnotherThreadChannel->m_mutex;
     }
 
     std::atomic_size_t& pendingAsyncWaiterCount()
     {
-        return m_pendingAsyncWaiterCount;
+        return m_eventFromAnotherThreadChannel->m_pendingEventCount;
     }
 
     std::condition_variable& waitEventFromAnotherThreadConditionVariable()
     {
-        return m_waitEventFromAnotherThreadConditionVariable;
+        return m_eventFromAnotherThreadChannel->m_conditionVariable;
     }
 #endif
 
@@ -425,6 +459,8 @@ private:
 
     std::vector<ByteCodeBlock*> m_compiledByteCodeBlocks;
     size_t m_compiledByteCodeSize;
+    // pairs of register file and its size. not scanned by GC (see vmMarkStartCallback)
+    std::vector<std::pair<Value*, size_t>> m_generatorRegisterFileFreeList;
     size_t m_maxCompiledByteCodeSize;
 
 #if defined(ENABLE_COMPRESSIBLE_STRING)
@@ -461,7 +497,7 @@ private:
     ToStringRecursionPreventer* m_toStringRecursionPreventer;
 
     // regexp object data
-    RegExpCacheMap* m_regexpCache;
+    RegExpCache* m_regexpCache;
     ASCIIString** m_regexpOptionStringCache;
 
 // date object data
@@ -494,10 +530,10 @@ private:
 
 #if defined(ENABLE_THREADING)
     Vector<AsyncWaiterDataItem, GCUtil::gc_malloc_allocator<AsyncWaiterDataItem>> m_asyncWaiterData;
-    std::mutex m_asyncWaiterDataMutex;
-    std::atomic_size_t m_pendingAsyncWaiterCount;
+    // guarded by the mutex of m_eventFromAnotherThreadChannel
+    Vector<JobFromAnotherThread*, GCUtil::gc_malloc_allocator<JobFromAnotherThread*>> m_jobsFromAnotherThread;
 
-    std::condition_variable m_waitEventFromAnotherThreadConditionVariable;
+    std::shared_ptr<EventFromAnotherThreadChannel> m_eventFromAnotherThreadChannel;
 #endif
 };
 } // namespace Escargot
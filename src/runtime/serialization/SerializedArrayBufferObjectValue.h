@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedArrayBufferObjectValue__
+#define __EscargotSerializedArrayBufferObjectValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/serialization/SerializedTransferTable.h"
+#include "runtime/ArrayBufferObject.h"
+#include "runtime/Global.h"
+#include "runtime/Platform.h"
+
+namespace Escargot {
+
+class SerializedArrayBufferObjectValue : public SerializedObjectValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::ArrayBufferObject;
+    }
+
+    // adopt the transferred data block without copying
+    // buffer is left detached if the data block is missing or was already adopted
+    static ::Escargot::ArrayBufferObject* createTransferredBuffer(ExecutionState& state, SerializedTransferTable* transferTable, size_t transferIndex)
+    {
+        ::Escargot::ArrayBufferObject* buffer = new ::Escargot::ArrayBufferObject(state);
+        SerializedTransferTable::Entry entry;
+        if (transferTable) {
+            entry = transferTable->adopt(transferIndex);
+        }
+        if (entry.m_isAttached) {
+            if (!entry.m_data) {
+                // empty data block is not moved
+                if (entry.m_isResizable) {
+                    buffer->allocateResizableBuffer(state, 0, 0);
+                } else {
+                    buffer->allocateBuffer(state, 0);
+                }
+            } else {
+                BackingStore* backingStore;
+                if (entry.m_isResizable) {
+                    backingStore = BackingStore::createDefaultResizableNonSharedBackingStore(entry.m_data, entry.m_byteLength, entry.m_maxByteLength);
+                } else {
+                    backingStore = BackingStore::createDefaultNonSharedBackingStore(entry.m_data, entry.m_byteLength);
+                }
+                buffer->attachBuffer(backingStore);
+            }
+        }
+        return buffer;
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        if (m_transferIndex != SIZE_MAX) {
+            ::Escargot::ArrayBufferObject* buffer = createTransferredBuffer(state, memory.m_transferTable, m_transferIndex);
+            memory.pushBack(Value(buffer));
+            if (m_transferIndex < memory.m_transferredObjects.size()) {
+                memory.m_transferredObjects[m_transferIndex] = Value(buffer);
+            }
+            return Value(buffer);
+        }
+
+        ::Escargot::ArrayBufferObject* buffer = new ::Escargot::ArrayBufferObject(state);
+        memory.pushBack(Value(buffer));
+        if (m_isResizable) {
+            buffer->allocateResizableBuffer(state, m_byteLength, m_maxByteLength);
+        } else {
+            buffer->allocateBuffer(state, m_byteLength);
+        }
+        if (m_byteLength) {
+            buffer->fillData(reinterpret_cast<const uint8_t*>(m_bytes.data()), m_byteLength);
+        }
+
+        return Value(buffer);
+    }
+
+protected:
+    enum Flags : uint8_t {
+        Transferred = 1 << 0,
+        Resizable = 1 << 1,
+    };
+
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        if (m_transferIndex != SIZE_MAX) {
+            // lengths are kept in the transfer table with the data block
+            writeData<uint8_t>(outputStream, Transferred);
+            writeLength(outputStream, m_transferIndex);
+            return;
+        }
+
+        writeData<uint8_t>(outputStream, m_isResizable ? Resizable : 0);
+        writeLength(outputStream, m_byteLength);
+        if (m_isResizable) {
+            writeLength(outputStream, m_maxByteLength);
+        }
+        outputStream.write(m_bytes.data(), m_bytes.size());
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        uint8_t flags = readData<uint8_t>(inputStream);
+        if (flags & Transferred) {
+            SerializedArrayBufferObjectValue* value = new SerializedArrayBufferObjectValue(0, 0, false);
+            value->m_transferIndex = readLength(inputStream);
+            return std::unique_ptr<SerializedValue>(value);
+        }
+
+        size_t byteLength = readLength(inputStream);
+        size_t maxByteLength = (flags & Resizable) ? readLength(inputStream) : byteLength;
+        if (maxByteLength < byteLength || !hasAvailableBytes(inputStream, byteLength)) {
+            return nullptr;
+        }
+        SerializedArrayBufferObjectValue* value = new SerializedArrayBufferObjectValue(byteLength, maxByteLength, flags & Resizable);
+        value->m_bytes.resize(byteLength);
+        inputStream.read(&value->m_bytes[0], byteLength);
+        return std::unique_ptr<SerializedValue>(value);
+    }
+
+    SerializedArrayBufferObjectValue(size_t byteLength, size_t maxByteLength, bool isResizable)
+        : m_byteLength(byteLength)
+        , m_maxByteLength(maxByteLength)
+        , m_isResizable(isResizable)
+        , m_transferIndex(SIZE_MAX)
+    {
+    }
+
+    size_t m_byteLength;
+    size_t m_maxByteLength;
+    bool m_isResizable;
+    // index of the data block in transfer table if this buffer was transferred
+    size_t m_transferIndex;
+    // copied contents of non-transferred ArrayBuffer
+    std::string m_bytes;
+};
+
+} // namespace Escargot
+
+#endif
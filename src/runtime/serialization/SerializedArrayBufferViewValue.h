@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedArrayBufferViewValue__
+#define __EscargotSerializedArrayBufferViewValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/DataViewObject.h"
+#include "runtime/TypedArrayObject.h"
+#include "runtime/TypedArrayInlines.h"
+
+namespace Escargot {
+
+// TypedArray and DataView
+class SerializedArrayBufferViewValue : public SerializedObjectValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::ArrayBufferView;
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        ::Escargot::ArrayBufferView* view = nullptr;
+        if (m_isDataView) {
+            view = new DataViewObject(state);
+        } else {
+            switch (m_typedArrayType) {
+#define DECLARE_TYPEDARRAY_CREATION(TYPE, type, siz, nativeType) \
+    case TypedArrayType::TYPE:                                   \
+        view = new TYPE##ArrayObject(state);                     \
+        break;
+                FOR_EACH_TYPEDARRAY_TYPES(DECLARE_TYPEDARRAY_CREATION)
+#undef DECLARE_TYPEDARRAY_CREATION
+            default:
+                RELEASE_ASSERT_NOT_REACHED();
+            }
+        }
+        memory.pushBack(Value(view));
+
+        Value buffer = m_buffer->toValueWithObjectMemory(state, memory);
+        if (UNLIKELY(!buffer.isObject() || !buffer.asObject()->isArrayBuffer() || !isValidRange(buffer.asObject()->asArrayBuffer()))) {
+            throwMalformedDataError(state);
+        }
+        view->setBuffer(buffer.asObject()->asArrayBuffer(), m_byteOffset, m_byteLength, m_arrayLength, m_isAutoLength);
+        return Value(view);
+    }
+
+protected:
+    // view should not reach out of its buffer
+    // transferred buffer can be left detached, and accesses to a detached buffer are checked anyway
+    bool isValidRange(ArrayBuffer* buffer)
+    {
+        size_t elementSize = m_isDataView ? 1 : TypedArrayHelper::elementSize(m_typedArrayType);
+        if (m_byteOffset % elementSize) {
+            return false;
+        }
+        if (buffer->isDetachedBuffer()) {
+            return true;
+        }
+        size_t bufferByteLength = buffer->byteLength();
+        if (m_isAutoLength) {
+            return m_byteOffset <= bufferByteLength;
+        }
+        if (m_byteOffset > bufferByteLength || m_byteLength > bufferByteLength - m_byteOffset) {
+            return false;
+        }
+        // array length of DataView is not used
+        return m_isDataView || (m_arrayLength == m_byteLength / elementSize && !(m_byteLength % elementSize));
+    }
+
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        writeData<uint8_t>(outputStream, m_isDataView);
+        writeData<uint8_t>(outputStream, static_cast<uint8_t>(m_typedArrayType));
+        writeData<uint8_t>(outputStream, m_isAutoLength);
+        writeLength(outputStream, m_byteOffset);
+        writeLength(outputStream, m_byteLength);
+        writeLength(outputStream, m_arrayLength);
+        m_buffer->serializeInto(outputStream);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        bool isDataView = readData<uint8_t>(inputStream);
+        TypedArrayType typedArrayType = static_cast<TypedArrayType>(readData<uint8_t>(inputStream));
+        bool isAutoLength = readData<uint8_t>(inputStream);
+        size_t byteOffset = readLength(inputStream);
+        size_t byteLength = readLength(inputStream);
+        size_t arrayLength = readLength(inputStream);
+        auto buffer = Serializer::deserializeFrom(inputStream);
+        if (!buffer || typedArrayType > TypedArrayType::BigUint64) {
+            return nullptr;
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedArrayBufferViewValue(isDataView, typedArrayType, isAutoLength,
+                                                                                   byteOffset, byteLength, arrayLength, std::move(buffer)));
+    }
+
+    SerializedArrayBufferViewValue(bool isDataView, TypedArrayType typedArrayType, bool isAutoLength,
+                                   size_t byteOffset, size_t byteLength, size_t arrayLength, std::unique_ptr<SerializedValue>&& buffer)
+        : m_isDataView(isDataView)
+        , m_typedArrayType(typedArrayType)
+        , m_isAutoLength(isAutoLength)
+        , m_byteOffset(byteOffset)
+        , m_byteLength(byteLength)
+        , m_arrayLength(arrayLength)
+        , m_buffer(std::move(buffer))
+    {
+    }
+
+    bool m_isDataView;
+    TypedArrayType m_typedArrayType;
+    bool m_isAutoLength;
+    size_t m_byteOffset;
+    size_t m_byteLength;
+    size_t m_arrayLength;
+    // SerializedArrayBufferObjectValue or SerializedObjectReferenceValue
+    std::unique_ptr<SerializedValue> m_buffer;
+};
+
+} // namespace Escargot
+
+#endif
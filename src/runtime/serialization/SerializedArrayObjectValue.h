@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedArrayObjectValue__
+#define __EscargotSerializedArrayObjectValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/ArrayObject.h"
+
+namespace Escargot {
+
+class SerializedArrayObjectValue : public SerializedObjectValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::ArrayObject;
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        ::Escargot::ArrayObject* arr = new ::Escargot::ArrayObject(state, static_cast<uint64_t>(m_length));
+        memory.pushBack(Value(arr));
+        for (size_t i = 0; i < m_elements.size(); i++) {
+            if (m_elements[i]) {
+                arr->defineOwnIndexedPropertyWithoutExpanding(state, i, m_elements[i]->toValueWithObjectMemory(state, memory));
+            }
+        }
+        defineProperties(state, arr, m_properties, memory);
+        return Value(arr);
+    }
+
+protected:
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        writeLength(outputStream, m_length);
+        // dense elements of fast mode array. holes are marked with a leading zero byte
+        writeLength(outputStream, m_elements.size());
+        for (size_t i = 0; i < m_elements.size(); i++) {
+            if (m_elements[i]) {
+                writeData<uint8_t>(outputStream, 1);
+                m_elements[i]->serializeInto(outputStream);
+            } else {
+                writeData<uint8_t>(outputStream, 0);
+            }
+        }
+        serializePropertyVector(outputStream, m_properties);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        uint64_t length = readLength(inputStream);
+        SerializedValueVector elements;
+        size_t s = readLength(inputStream);
+        // elements are defined without expanding the array, so they should fit into length
+        if (length > std::numeric_limits<uint32_t>::max() || s > length || !hasAvailableBytes(inputStream, s)) {
+            return nullptr;
+        }
+        elements.reserve(s);
+        for (size_t i = 0; i < s; i++) {
+            if (readData<uint8_t>(inputStream)) {
+                auto element = Serializer::deserializeFrom(inputStream);
+                if (!element) {
+                    return nullptr;
+                }
+                elements.push_back(std::move(element));
+            } else {
+                elements.push_back(nullptr);
+            }
+        }
+        SerializedPropertyVector properties;
+        if (!deserializePropertyVector(inputStream, properties)) {
+            return nullptr;
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedArrayObjectValue(length, std::move(elements), std::move(properties)));
+    }
+
+    SerializedArrayObjectValue(uint32_t length, SerializedValueVector&& elements, SerializedPropertyVector&& properties)
+        : m_length(length)
+        , m_elements(std::move(elements))
+        , m_properties(std::move(properties))
+    {
+        ASSERT(m_elements.size() <= m_length);
+    }
+
+    uint32_t m_length;
+    SerializedValueVector m_elements;
+    // index properties of sparse(non-fast mode) array are stored here too
+    SerializedPropertyVector m_properties;
+};
+
+} // namespace Escargot
+
+#endif
@@ -43,27 +43,15 @@ public:
 protected:
     virtual void serializeValueData(std::ostringstream& outputStream) override
     {
-        size_t s = m_value.size();
-        outputStream << s;
-        outputStream << std::endl;
-        for (size_t i = 0; i < s; i++) {
-            outputStream << m_value[i];
-        }
+        writeBytes(outputStream, m_value);
     }
 
     static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
     {
-        size_t s;
-        inputStream >> s;
-        std::string str;
-        str.reserve(s);
-
-        for (size_t i = 0; i < s; i++) {
-            char ch;
-            inputStream >> ch;
-            str.push_back(ch);
+        std::string str = readBytes(inputStream);
+        if (UNLIKELY(inputStream.fail())) {
+            return nullptr;
         }
-
         return std::unique_ptr<SerializedValue>(new SerializedBigIntValue(std::move(str)));
     }
 
@@ -41,14 +41,12 @@ public:
 protected:
     virtual void serializeValueData(std::ostringstream& outputStream) override
     {
-        outputStream << m_value;
-        outputStream << std::endl;
+        writeData<uint8_t>(outputStream, m_value);
     }
 
     static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
     {
-        bool v;
-        inputStream >> v;
+        bool v = readData<uint8_t>(inputStream);
         return std::unique_ptr<SerializedValue>(new SerializedBooleanValue(v));
     }
 
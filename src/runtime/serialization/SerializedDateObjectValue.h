@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedDateObjectValue__
+#define __EscargotSerializedDateObjectValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/DateObject.h"
+
+namespace Escargot {
+
+class SerializedDateObjectValue : public SerializedObjectValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::DateObject;
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        ::Escargot::DateObject* date = new ::Escargot::DateObject(state);
+        if (std::isnan(m_timeValue)) {
+            date->setTimeValueAsNaN();
+        } else {
+            date->setTimeValue(static_cast<time64_t>(m_timeValue));
+        }
+        memory.pushBack(Value(date));
+        return Value(date);
+    }
+
+protected:
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        writeData<double>(outputStream, m_timeValue);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        return std::unique_ptr<SerializedValue>(new SerializedDateObjectValue(readData<double>(inputStream)));
+    }
+
+    SerializedDateObjectValue(double timeValue)
+        : m_timeValue(timeValue)
+    {
+    }
+
+    double m_timeValue;
+};
+
+} // namespace Escargot
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedErrorObjectValue__
+#define __EscargotSerializedErrorObjectValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/ErrorObject.h"
+
+namespace Escargot {
+
+class SerializedErrorObjectValue : public SerializedObjectValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::ErrorObject;
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        ::Escargot::String* message = m_message ? m_message->toValue(state).asString() : ::Escargot::String::emptyString;
+        ::Escargot::ErrorObject* error = ::Escargot::ErrorObject::createError(state, m_code, message, false);
+        memory.pushBack(Value(error));
+        return Value(error);
+    }
+
+protected:
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        writeData<uint8_t>(outputStream, static_cast<uint8_t>(m_code));
+        writeData<uint8_t>(outputStream, !!m_message);
+        if (m_message) {
+            m_message->serializeInto(outputStream);
+        }
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        ErrorCode code = static_cast<ErrorCode>(readData<uint8_t>(inputStream));
+        std::unique_ptr<SerializedValue> message;
+        if (readData<uint8_t>(inputStream)) {
+            message = Serializer::deserializeFrom(inputStream);
+            if (!message || message->type() != SerializedValue::String) {
+                return nullptr;
+            }
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedErrorObjectValue(code, std::move(message)));
+    }
+
+    SerializedErrorObjectValue(ErrorCode code, std::unique_ptr<SerializedValue>&& message)
+        : m_code(code)
+        , m_message(std::move(message))
+    {
+    }
+
+    ErrorCode m_code;
+    std::unique_ptr<SerializedValue> m_message;
+};
+
+} // namespace Escargot
+
+#endif
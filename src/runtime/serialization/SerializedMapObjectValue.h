@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedMapObjectValue__
+#define __EscargotSerializedMapObjectValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/MapObject.h"
+
+namespace Escargot {
+
+class SerializedMapObjectValue : public SerializedObjectValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::MapObject;
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        ::Escargot::MapObject* map = new ::Escargot::MapObject(state);
+        memory.pushBack(Value(map));
+        ASSERT(m_entries.size() % 2 == 0);
+        for (size_t i = 0; i < m_entries.size(); i += 2) {
+            Value key = m_entries[i]->toValueWithObjectMemory(state, memory);
+            Value value = m_entries[i + 1]->toValueWithObjectMemory(state, memory);
+            map->set(state, key, value);
+        }
+        return Value(map);
+    }
+
+protected:
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        serializeValueVector(outputStream, m_entries);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        SerializedValueVector entries;
+        if (!deserializeValueVector(inputStream, entries) || entries.size() % 2) {
+            return nullptr;
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedMapObjectValue(std::move(entries)));
+    }
+
+    SerializedMapObjectValue(SerializedValueVector&& entries)
+        : m_entries(std::move(entries))
+    {
+    }
+
+    // flattened key, value, key, value...
+    SerializedValueVector m_entries;
+};
+
+} // namespace Escargot
+
+#endif
@@ -41,14 +41,12 @@ public:
 protected:
     virtual void serializeValueData(std::ostringstream& outputStream) override
     {
-        outputStream << m_value;
-        outputStream << std::endl;
+        writeData<double>(outputStream, m_value);
     }
 
     static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
     {
-        double v;
-        inputStream >> v;
+        double v = readData<double>(inputStream);
         return std::unique_ptr<SerializedValue>(new SerializedNumberValue(v));
     }
 
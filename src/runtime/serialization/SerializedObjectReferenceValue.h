@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedObjectReferenceValue__
+#define __EscargotSerializedObjectReferenceValue__
+
+#include "runtime/serialization/SerializedValue.h"
+
+namespace Escargot {
+
+// refers an object which already appeared in the serialized object graph
+class SerializedObjectReferenceValue : public SerializedValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::ObjectReference;
+    }
+
+    virtual Value toValue(ExecutionState& state) override
+    {
+        // reference is only valid inside of an object graph
+        throwMalformedDataError(state);
+        return Value();
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        if (UNLIKELY(m_index >= memory.size())) {
+            throwMalformedDataError(state);
+        }
+        return memory[m_index];
+    }
+
+protected:
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        writeLength(outputStream, m_index);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        return std::unique_ptr<SerializedValue>(new SerializedObjectReferenceValue(readLength(inputStream)));
+    }
+
+    SerializedObjectReferenceValue(size_t index)
+        : m_index(index)
+    {
+    }
+
+    size_t m_index;
+};
+
+} // namespace Escargot
+
+#endif
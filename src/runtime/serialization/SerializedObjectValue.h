@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedObjectValue__
+#define __EscargotSerializedObjectValue__
+
+#include "runtime/serialization/Serializer.h"
+
+namespace Escargot {
+
+// base class of serialized values which have an object identity
+// every derived class should register its object into ObjectMemory before converting its children
+class SerializedObjectValue : public SerializedValue {
+    friend class Serializer;
+
+public:
+    virtual Value toValue(ExecutionState& state) override
+    {
+        ObjectMemory memory;
+        return toValueWithObjectMemory(state, memory);
+    }
+
+protected:
+    typedef std::vector<std::unique_ptr<SerializedValue>> SerializedValueVector;
+    // key(String) and value pairs of own enumerable properties
+    typedef std::vector<std::pair<std::unique_ptr<SerializedValue>, std::unique_ptr<SerializedValue>>> SerializedPropertyVector;
+
+    static void serializeValueVector(std::ostringstream& outputStream, SerializedValueVector& values)
+    {
+        writeLength(outputStream, values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+            values[i]->serializeInto(outputStream);
+        }
+    }
+
+    // returns false if the stream is malformed
+    static bool deserializeValueVector(std::istringstream& inputStream, SerializedValueVector& values)
+    {
+        size_t s = readLength(inputStream);
+        // every value takes one byte at least
+        if (!hasAvailableBytes(inputStream, s)) {
+            return false;
+        }
+        values.reserve(s);
+        for (size_t i = 0; i < s; i++) {
+            auto value = Serializer::deserializeFrom(inputStream);
+            if (!value) {
+                return false;
+            }
+            values.push_back(std::move(value));
+        }
+        return true;
+    }
+
+    static void serializePropertyVector(std::ostringstream& outputStream, SerializedPropertyVector& properties)
+    {
+        writeLength(outputStream, properties.size());
+        for (size_t i = 0; i < properties.size(); i++) {
+            properties[i].first->serializeInto(outputStream);
+            properties[i].second->serializeInto(outputStream);
+        }
+    }
+
+    // returns false if the stream is malformed
+    static bool deserializePropertyVector(std::istringstream& inputStream, SerializedPropertyVector& properties)
+    {
+        size_t s = readLength(inputStream);
+        if (!hasAvailableBytes(inputStream, s)) {
+            return false;
+        }
+        properties.reserve(s);
+        for (size_t i = 0; i < s; i++) {
+            auto key = Serializer::deserializeFrom(inputStream);
+            if (!key || key->type() != SerializedValue::String) {
+                return false;
+            }
+            auto value = Serializer::deserializeFrom(inputStream);
+            if (!value) {
+                return false;
+            }
+            properties.push_back(std::make_pair(std::move(key), std::move(value)));
+        }
+        return true;
+    }
+
+    static void defineProperties(ExecutionState& state, ::Escargot::Object* target, SerializedPropertyVector& properties, ObjectMemory& memory)
+    {
+        for (size_t i = 0; i < properties.size(); i++) {
+            Value key = properties[i].first->toValue(state);
+            Value value = properties[i].second->toValueWithObjectMemory(state, memory);
+            target->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, key), ObjectPropertyDescriptor(value, ObjectPropertyDescriptor::AllPresent));
+        }
+    }
+};
+
+} // namespace Escargot
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedPlainObjectValue__
+#define __EscargotSerializedPlainObjectValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+
+namespace Escargot {
+
+class SerializedPlainObjectValue : public SerializedObjectValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::PlainObject;
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        ::Escargot::Object* obj = new ::Escargot::Object(state);
+        memory.pushBack(Value(obj));
+        defineProperties(state, obj, m_properties, memory);
+        return Value(obj);
+    }
+
+protected:
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        serializePropertyVector(outputStream, m_properties);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        SerializedPropertyVector properties;
+        if (!deserializePropertyVector(inputStream, properties)) {
+            return nullptr;
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedPlainObjectValue(std::move(properties)));
+    }
+
+    SerializedPlainObjectValue(SerializedPropertyVector&& properties)
+        : m_properties(std::move(properties))
+    {
+    }
+
+    SerializedPropertyVector m_properties;
+};
+
+} // namespace Escargot
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedRegExpObjectValue__
+#define __EscargotSerializedRegExpObjectValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/RegExpObject.h"
+
+namespace Escargot {
+
+class SerializedRegExpObjectValue : public SerializedObjectValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::RegExpObject;
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        ::Escargot::RegExpObject* regexp = new ::Escargot::RegExpObject(state, m_source->toValue(state).asString(), m_option);
+        memory.pushBack(Value(regexp));
+        return Value(regexp);
+    }
+
+protected:
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        m_source->serializeInto(outputStream);
+        writeData<uint32_t>(outputStream, m_option);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        auto source = Serializer::deserializeFrom(inputStream);
+        if (!source || source->type() != SerializedValue::String) {
+            return nullptr;
+        }
+        uint32_t option = readData<uint32_t>(inputStream);
+        return std::unique_ptr<SerializedValue>(new SerializedRegExpObjectValue(std::move(source), option));
+    }
+
+    SerializedRegExpObjectValue(std::unique_ptr<SerializedValue>&& source, uint32_t option)
+        : m_source(std::move(source))
+        , m_option(option)
+    {
+    }
+
+    std::unique_ptr<SerializedValue> m_source;
+    uint32_t m_option;
+};
+
+} // namespace Escargot
+
+#endif
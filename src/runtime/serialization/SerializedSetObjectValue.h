@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSerializedSetObjectValue__
+#define __EscargotSerializedSetObjectValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/SetObject.h"
+
+namespace Escargot {
+
+class SerializedSetObjectValue : public SerializedObjectValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::SetObject;
+    }
+
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory) override
+    {
+        ::Escargot::SetObject* set = new ::Escargot::SetObject(state);
+        memory.pushBack(Value(set));
+        for (size_t i = 0; i < m_values.size(); i++) {
+            set->add(state, m_values[i]->toValueWithObjectMemory(state, memory));
+        }
+        return Value(set);
+    }
+
+protected:
+    virtual void serializeValueData(std::ostringstream& outputStream) override
+    {
+        serializeValueVector(outputStream, m_values);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    {
+        SerializedValueVector values;
+        if (!deserializeValueVector(inputStream, values)) {
+            return nullptr;
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedSetObjectValue(std::move(values)));
+    }
+
+    SerializedSetObjectValue(SerializedValueVector&& values)
+        : m_values(std::move(values))
+    {
+    }
+
+    SerializedValueVector m_values;
+};
+
+} // namespace Escargot
+
+#endif
@@ -45,14 +45,12 @@ protected:
     virtual void serializeValueData(std::ostringstream& outputStream) override
     {
         size_t ptr = reinterpret_cast<size_t>(m_bufferData);
-        outputStream << ptr;
-        outputStream << std::endl;
+        writeData<size_t>(outputStream, ptr);
     }
 
     static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
     {
-        size_t ptr;
-        inputStream >> ptr;
+        size_t ptr = readData<size_t>(inputStream);
         SharedDataBlockInfo* data = reinterpret_cast<SharedDataBlockInfo*>(ptr);
         return std::unique_ptr<SerializedValue>(new SerializedSharedArrayBufferObjectValue(data));
     }
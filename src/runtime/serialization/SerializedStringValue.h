@@ -35,40 +35,49 @@ public:
 
     virtual Value toValue(ExecutionState& state) override
     {
-        return Value(String::fromUTF8(m_value.data(), m_value.size()));
+        if (m_is8Bit) {
+            return Value(::Escargot::String::fromLatin1(reinterpret_cast<const LChar*>(m_value.data()), m_value.size()));
+        }
+        return Value(new UTF16String(reinterpret_cast<const char16_t*>(m_value.data()), m_value.size() / sizeof(char16_t)));
     }
 
 protected:
     virtual void serializeValueData(std::ostringstream& outputStream) override
     {
-        size_t s = m_value.size();
-        outputStream << s;
-        outputStream << std::endl;
-        for (size_t i = 0; i < s; i++) {
-            outputStream << m_value[i];
-        }
+        writeData<uint8_t>(outputStream, m_is8Bit);
+        writeBytes(outputStream, m_value);
     }
 
     static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
     {
-        size_t s;
-        inputStream >> s;
-        std::string str;
-        str.reserve(s);
-
-        for (size_t i = 0; i < s; i++) {
-            char ch;
-            inputStream >> ch;
-            str.push_back(ch);
+        bool is8Bit = readData<uint8_t>(inputStream);
+        std::string str = readBytes(inputStream);
+        if (UNLIKELY(inputStream.fail())) {
+            return nullptr;
         }
+        return std::unique_ptr<SerializedValue>(new SerializedStringValue(is8Bit, std::move(str)));
+    }
 
-        return std::unique_ptr<SerializedValue>(new SerializedStringValue(std::move(str)));
+    // string contents are kept as raw Latin-1 or UTF-16 code units
+    // so that strings with unpaired surrogates survive the round trip and no UTF-8 conversion is needed
+    explicit SerializedStringValue(::Escargot::String* value)
+        : m_is8Bit(value->has8BitContent())
+    {
+        const auto& bd = value->bufferAccessData();
+        if (m_is8Bit) {
+            m_value.assign(bd.bufferAs8Bit, bd.length);
+        } else {
+            m_value.assign(reinterpret_cast<const char*>(bd.bufferAs16Bit), bd.length * sizeof(char16_t));
+        }
     }
 
-    SerializedStringValue(std::string&& value)
-        : m_value(value)
+    SerializedStringValue(bool is8Bit, std::string&& value)
+        : m_is8Bit(is8Bit)
+        , m_value(std::move(value))
     {
     }
+
+    bool m_is8Bit;
     std::string m_value;
 };
 
@@ -46,36 +46,21 @@ protected:
     virtual void serializeValueData(std::ostringstream& outputStream) override
     {
         if (m_value) {
-            outputStream << true;
-            outputStream << std::endl;
-            size_t s = m_value.value().size();
-            outputStream << s;
-            outputStream << std::endl;
-            for (size_t i = 0; i < s; i++) {
-                outputStream << (m_value.value())[i];
-            }
+            writeData<uint8_t>(outputStream, true);
+            writeBytes(outputStream, m_value.value());
         } else {
-            outputStream << false;
-            outputStream << std::endl;
+            writeData<uint8_t>(outputStream, false);
         }
     }
 
     static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
     {
-        bool hasValue;
-        inputStream >> hasValue;
+        bool hasValue = readData<uint8_t>(inputStream);
         if (hasValue) {
-            size_t s;
-            inputStream >> s;
-            std::string str;
-            str.reserve(s);
-
-            for (size_t i = 0; i < s; i++) {
-                char ch;
-                inputStream >> ch;
-                str.push_back(ch);
+            std::string str = readBytes(inputStream);
+            if (UNLIKELY(inputStream.fail())) {
+                return nullptr;
             }
-
             return std::unique_ptr<SerializedValue>(new SerializedSymbolValue(std::move(str)));
         }
         return std::unique_ptr<SerializedValue>(new SerializedSymbolValue());
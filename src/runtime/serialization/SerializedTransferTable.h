@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializedTransferTable__
+#define __EscargotSerializedTransferTable__
+
+#include "runtime/Global.h"
+#include "runtime/Platform.h"
+
+namespace Escargot {
+
+// data blocks of transferred ArrayBuffers are kept out of the serialized stream
+// stream only has indexes into this table, so a forged or replayed stream cannot reach arbitrary memory
+// table has one entry for each ArrayBuffer of the transfer list in the same order
+// each data block can be adopted only once, and blocks which were never adopted are freed with the table
+class SerializedTransferTable {
+public:
+    struct Entry {
+        Entry()
+            : m_data(nullptr)
+            , m_byteLength(0)
+            , m_maxByteLength(0)
+            , m_isResizable(false)
+            , m_isAttached(false)
+        {
+        }
+
+        Entry(void* data, size_t byteLength, size_t maxByteLength, bool isResizable)
+            : m_data(data)
+            , m_byteLength(byteLength)
+            , m_maxByteLength(maxByteLength)
+            , m_isResizable(isResizable)
+            , m_isAttached(true)
+        {
+        }
+
+        // allocated by Platform. can be nullptr for an empty data block
+        void* m_data;
+        size_t m_byteLength;
+        size_t m_maxByteLength;
+        bool m_isResizable;
+        // false if the buffer was already detached when transferred, or this entry was adopted
+        bool m_isAttached;
+    };
+
+    SerializedTransferTable() {}
+    ~SerializedTransferTable()
+    {
+        for (size_t i = 0; i < m_entries.size(); i++) {
+            const Entry& entry = m_entries[i];
+            if (entry.m_data) {
+                Global::platform()->onFreeArrayBufferObjectDataBuffer(entry.m_data, entry.m_isResizable ? entry.m_maxByteLength : entry.m_byteLength);
+            }
+        }
+    }
+
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    size_t append(const Entry& entry)
+    {
+        m_entries.push_back(entry);
+        return m_entries.size() - 1;
+    }
+
+    // returns a detached entry if index is out of range or the entry was already adopted
+    Entry adopt(size_t index)
+    {
+        Entry result;
+        if (index < m_entries.size()) {
+            result = m_entries[index];
+            m_entries[index] = Entry();
+        }
+        return result;
+    }
+
+private:
+    SerializedTransferTable(const SerializedTransferTable&) = delete;
+    SerializedTransferTable& operator=(const SerializedTransferTable&) = delete;
+
+    std::vector<Entry> m_entries;
+};
+
+} // namespace Escargot
+
+#endif
@@ -24,6 +24,8 @@
 
 namespace Escargot {
 
+class SerializedTransferTable;
+
 class SerializedValue {
     friend class Serializer;
 
@@ -35,7 +37,17 @@ public:
     F(Number)                         \
     F(String)                         \
     F(Symbol)                         \
-    F(BigInt)
+    F(BigInt)                         \
+    F(PlainObject)                    \
+    F(ArrayObject)                    \
+    F(DateObject)                     \
+    F(RegExpObject)                   \
+    F(MapObject)                      \
+    F(SetObject)                      \
+    F(ErrorObject)                    \
+    F(ArrayBufferObject)              \
+    F(ArrayBufferView)                \
+    F(ObjectReference)
 
     enum Type {
 #define DECLARE_SERIALIZABLE_TYPE(name) name,
@@ -49,6 +61,39 @@ public:
     virtual Type type() = 0;
     virtual Value toValue(ExecutionState& state) = 0;
 
+    // objects created while converting a serialized object graph into values
+    // indexed in the order of appearance, which is the same order Serializer uses to number objects
+    struct ObjectMemory : public ValueVector {
+        explicit ObjectMemory(SerializedTransferTable* transferTable = nullptr)
+            : m_transferTable(transferTable)
+        {
+        }
+
+        // data blocks of transferred ArrayBuffers
+        SerializedTransferTable* m_transferTable;
+        // ArrayBuffers created from m_transferTable, indexed as the table
+        // only used if the caller collects every transferred ArrayBuffer (see Serializer::deserializeValueFrom)
+        ValueVector m_transferredObjects;
+    };
+
+    // composite values override this to register created objects into memory
+    // so that SerializedObjectReferenceValue can resolve shared or cyclic references
+    virtual Value toValueWithObjectMemory(ExecutionState& state, ObjectMemory& memory)
+    {
+        return toValue(state);
+    }
+
+    // transferred ArrayBuffers adopt their data blocks from transferTable
+    // they are left detached if transferTable does not have the data block
+    Value toValueWithTransferTable(ExecutionState& state, SerializedTransferTable* transferTable)
+    {
+        ObjectMemory memory(transferTable);
+        return toValueWithObjectMemory(state, memory);
+    }
+
+    // malformed input (e.g. a forged or truncated stream) throws TypeError instead of aborting
+    static void throwMalformedDataError(ExecutionState& state);
+
     void serializeInto(std::ostringstream& outputStream)
     {
         serializeValueType(outputStream);
@@ -59,7 +104,75 @@ protected:
     virtual void serializeValueData(std::ostringstream& outputStream) {}
     void serializeValueType(std::ostringstream& outputStream)
     {
-        outputStream << static_cast<char>(type());
+        writeData<uint8_t>(outputStream, static_cast<uint8_t>(type()));
+    }
+
+    // serialized data is written in native byte order
+    // because it is only consumed by the same build of Escargot (e.g. another thread in the same process)
+    template <typename T>
+    static void writeData(std::ostringstream& outputStream, const T& data)
+    {
+        outputStream.write(reinterpret_cast<const char*>(&data), sizeof(T));
+    }
+
+    template <typename T>
+    static T readData(std::istringstream& inputStream)
+    {
+        T data;
+        inputStream.read(reinterpret_cast<char*>(&data), sizeof(T));
+        return data;
+    }
+
+    // lengths and indexes are mostly small numbers, so encode them as LEB128
+    static void writeLength(std::ostringstream& outputStream, uint64_t length)
+    {
+        do {
+            uint8_t byte = length & 0x7f;
+            length >>= 7;
+            if (length) {
+                byte |= 0x80;
+            }
+            outputStream.put(static_cast<char>(byte));
+        } while (length);
+    }
+
+    static uint64_t readLength(std::istringstream& inputStream)
+    {
+        uint64_t length = 0;
+        unsigned shift = 0;
+        uint8_t byte;
+        do {
+            byte = static_cast<uint8_t>(inputStream.get());
+            length |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            shift += 7;
+        } while ((byte & 0x80) && shift < 64 && inputStream.good());
+        return length;
+    }
+
+    static void writeBytes(std::ostringstream& outputStream, const std::string& bytes)
+    {
+        writeLength(outputStream, bytes.size());
+        outputStream.write(bytes.data(), bytes.size());
+    }
+
+    // length read from the stream should not be trusted before allocating
+    static bool hasAvailableBytes(std::istringstream& inputStream, size_t size)
+    {
+        std::streamsize available = inputStream.good() ? inputStream.rdbuf()->in_avail() : -1;
+        return available >= 0 && static_cast<size_t>(available) >= size;
+    }
+
+    // sets failbit of inputStream if the stream does not have enough bytes
+    static std::string readBytes(std::istringstream& inputStream)
+    {
+        size_t s = readLength(inputStream);
+        if (!hasAvailableBytes(inputStream, s)) {
+            inputStream.setstate(std::ios::failbit);
+            return std::string();
+        }
+        std::string bytes(s, '\0');
+        inputStream.read(&bytes[0], s);
+        return bytes;
     }
 };
 
@@ -20,18 +20,85 @@
 #include "Escargot.h"
 #include "Serializer.h"
 
+#include "runtime/serialization/SerializedArrayBufferObjectValue.h"
+#include "runtime/serialization/SerializedArrayBufferViewValue.h"
+#include "runtime/serialization/SerializedArrayObjectValue.h"
 #include "runtime/serialization/SerializedBigIntValue.h"
 #include "runtime/serialization/SerializedBooleanValue.h"
+#include "runtime/serialization/SerializedDateObjectValue.h"
+#include "runtime/serialization/SerializedErrorObjectValue.h"
+#include "runtime/serialization/SerializedMapObjectValue.h"
 #include "runtime/serialization/SerializedNullValue.h"
 #include "runtime/serialization/SerializedNumberValue.h"
+#include "runtime/serialization/SerializedObjectReferenceValue.h"
+#include "runtime/serialization/SerializedPlainObjectValue.h"
+#include "runtime/serialization/SerializedRegExpObjectValue.h"
+#include "runtime/serialization/SerializedSetObjectValue.h"
 #include "runtime/serialization/SerializedSharedArrayBufferObjectValue.h"
 #include "runtime/serialization/SerializedStringValue.h"
 #include "runtime/serialization/SerializedSymbolValue.h"
 #include "runtime/serialization/SerializedUndefinedValue.h"
+#include "runtime/ArrayObject.h"
+#include "runtime/Context.h"
+#include "runtime/ErrorObject.h"
+#include "runtime/MapObject.h"
+#include "runtime/SetObject.h"
 
 namespace Escargot {
 
 std::unique_ptr<SerializedValue> Serializer::serialize(const Value& value)
+{
+    ObjectMemory memory(nullptr, nullptr);
+    return serializeValue(nullptr, value, memory);
+}
+
+std::unique_ptr<SerializedValue> Serializer::serialize(ExecutionState& state, const Value& value, const ValueVector* transferList, SerializedTransferTable* transferTable)
+{
+    if (transferList) {
+        ASSERT(transferTable);
+        // every transferable should be a distinct attached ArrayBuffer
+        for (size_t i = 0; i < transferList->size(); i++) {
+            const Value& item = (*transferList)[i];
+            if (!item.isObject() || !item.asObject()->isArrayBufferObject() || item.asObject()->asArrayBufferObject()->isDetachedBuffer()) {
+                return nullptr;
+            }
+            for (size_t j = 0; j < i; j++) {
+                if ((*transferList)[j].asObject() == item.asObject()) {
+                    return nullptr;
+                }
+            }
+        }
+    }
+
+    ObjectMemory memory(transferList, transferTable);
+    auto result = serializeValue(&state, value, memory);
+    if (result && transferList) {
+        transferBuffers(memory);
+    }
+    return result;
+}
+
+bool Serializer::serializeInto(const Value& value, std::ostringstream& output)
+{
+    auto sv = serialize(value);
+    if (sv) {
+        sv->serializeInto(output);
+        return true;
+    }
+    return false;
+}
+
+bool Serializer::serializeInto(ExecutionState& state, const Value& value, std::ostringstream& output, const ValueVector* transferList, SerializedTransferTable* transferTable)
+{
+    auto sv = serialize(state, value, transferList, transferTable);
+    if (sv) {
+        sv->serializeInto(output);
+        return true;
+    }
+    return false;
+}
+
+std::unique_ptr<SerializedValue> Serializer::serializeValue(ExecutionState* state, const Value& value, ObjectMemory& memory)
 {
     if (value.isUndefined()) {
         return std::unique_ptr<SerializedValue>(new SerializedUndefinedValue());
@@ -42,7 +109,7 @@ std::unique_ptr<SerializedValue> Serializer::serialize(const Value& value)
     } else if (value.isNumber()) {
         return std::unique_ptr<SerializedValue>(new SerializedNumberValue(value.asNumber()));
     } else if (value.isString()) {
-        return std::unique_ptr<SerializedValue>(new SerializedStringValue(value.asString()->toNonGCUTF8StringData()));
+        return std::unique_ptr<SerializedValue>(new SerializedStringValue(value.asString()));
     } else if (value.isBigInt()) {
         return std::unique_ptr<SerializedValue>(new SerializedBigIntValue(value.asBigInt()->toString()->toNonGCUTF8StringData()));
     } else if (value.isSymbol()) {
@@ -53,30 +120,269 @@ std::unique_ptr<SerializedValue> Serializer::serialize(const Value& value)
         }
     } else if (value.isObject()) {
 #if defined(ENABLE_THREADING)
+        // SharedArrayBuffer is shared by reference, so it is not numbered in ObjectMemory
         if (value.asObject()->isSharedArrayBufferObject()) {
             return std::unique_ptr<SerializedValue>(new SerializedSharedArrayBufferObjectValue(
                 value.asObject()->asSharedArrayBufferObject()->backingStore()->sharedDataBlockInfo()));
         }
 #endif
+        if (state) {
+            return serializeObject(*state, value.asObject(), memory);
+        }
     }
 
     return nullptr;
 }
 
-bool Serializer::serializeInto(const Value& value, std::ostringstream& output)
+static ErrorCode errorCodeFromName(ExecutionState& state, const Value& name)
 {
-    auto sv = serialize(value);
-    if (sv) {
-        sv->serializeInto(output);
-        return true;
+    if (!name.isString()) {
+        return ErrorCode::None;
+    }
+
+    String* nameString = name.asString();
+    const StaticStrings& strings = state.context()->staticStrings();
+    if (nameString->equals(strings.EvalError.string())) {
+        return ErrorCode::EvalError;
+    } else if (nameString->equals(strings.RangeError.string())) {
+        return ErrorCode::RangeError;
+    } else if (nameString->equals(strings.ReferenceError.string())) {
+        return ErrorCode::ReferenceError;
+    } else if (nameString->equals(strings.SyntaxError.string())) {
+        return ErrorCode::SyntaxError;
+    } else if (nameString->equals(strings.TypeError.string())) {
+        return ErrorCode::TypeError;
+    } else if (nameString->equals(strings.URIError.string())) {
+        return ErrorCode::URIError;
+    }
+    return ErrorCode::None;
+}
+
+std::unique_ptr<SerializedValue> Serializer::serializeObject(ExecutionState& state, Object* object, ObjectMemory& memory)
+{
+    auto iter = memory.m_objectIndex.find(object);
+    if (iter != memory.m_objectIndex.end()) {
+        return std::unique_ptr<SerializedValue>(new SerializedObjectReferenceValue(iter->second));
+    }
+
+    // objects are numbered before their children are visited
+    // deserialization registers objects in the same order
+    memory.m_objectIndex.insert(std::make_pair(object, memory.m_visitedObjects.size()));
+    memory.m_visitedObjects.pushBack(Value(object));
+
+    if (object->isPlainObject()) {
+        SerializedObjectValue::SerializedPropertyVector properties;
+        if (!serializeOwnProperties(state, object, false, properties, memory)) {
+            return nullptr;
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedPlainObjectValue(std::move(properties)));
+    } else if (object->isArrayObject()) {
+        ArrayObject* array = object->asArrayObject();
+        uint32_t length = array->arrayLength(state);
+        bool isFastMode = array->isFastModeArray();
+
+        SerializedObjectValue::SerializedValueVector elements;
+        if (isFastMode) {
+            // copy elements first because getters of elements can modify the array
+            ValueVector values;
+            values.resizeWithUninitializedValues(length);
+            for (uint32_t i = 0; i < length; i++) {
+                values[i] = array->m_fastModeData[i];
+            }
+
+            elements.reserve(length);
+            for (uint32_t i = 0; i < length; i++) {
+                if (values[i].isEmpty()) {
+                    elements.push_back(nullptr);
+                } else {
+                    auto element = serializeValue(&state, values[i], memory);
+                    if (!element) {
+                        return nullptr;
+                    }
+                    elements.push_back(std::move(element));
+                }
+            }
+        }
+
+        SerializedObjectValue::SerializedPropertyVector properties;
+        if (!serializeOwnProperties(state, object, isFastMode, properties, memory)) {
+            return nullptr;
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedArrayObjectValue(length, std::move(elements), std::move(properties)));
+    } else if (object->isDateObject()) {
+        return std::unique_ptr<SerializedValue>(new SerializedDateObjectValue(object->asDateObject()->primitiveValue()));
+    } else if (object->isRegExpObject()) {
+        RegExpObject* regexp = object->asRegExpObject();
+        return std::unique_ptr<SerializedValue>(new SerializedRegExpObjectValue(
+            std::unique_ptr<SerializedValue>(new SerializedStringValue(regexp->source())), regexp->option()));
+    } else if (object->isMapObject()) {
+        // copy entries first because serializing a value can run getters which modify the map
+        const MapObject::MapObjectData& storage = object->asMapObject()->storage();
+        ValueVector entries;
+        for (size_t i = 0; i < storage.size(); i++) {
+            if (!storage[i].first.isEmpty()) {
+                entries.pushBack(storage[i].first);
+                entries.pushBack(storage[i].second);
+            }
+        }
+
+        SerializedObjectValue::SerializedValueVector serializedEntries;
+        serializedEntries.reserve(entries.size());
+        for (size_t i = 0; i < entries.size(); i++) {
+            auto entry = serializeValue(&state, entries[i], memory);
+            if (!entry) {
+                return nullptr;
+            }
+            serializedEntries.push_back(std::move(entry));
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedMapObjectValue(std::move(serializedEntries)));
+    } else if (object->isSetObject()) {
+        const SetObject::SetObjectData& storage = object->asSetObject()->storage();
+        ValueVector values;
+        for (size_t i = 0; i < storage.size(); i++) {
+            if (!storage[i].isEmpty()) {
+                values.pushBack(storage[i]);
+            }
+        }
+
+        SerializedObjectValue::SerializedValueVector serializedValues;
+        serializedValues.reserve(values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+            auto value = serializeValue(&state, values[i], memory);
+            if (!value) {
+                return nullptr;
+            }
+            serializedValues.push_back(std::move(value));
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedSetObjectValue(std::move(serializedValues)));
+    } else if (object->isErrorObject()) {
+        const StaticStrings& strings = state.context()->staticStrings();
+        ErrorCode code = errorCodeFromName(state, object->get(state, ObjectPropertyName(strings.name)).value(state, Value(object)));
+
+        std::unique_ptr<SerializedValue> message;
+        ObjectGetResult desc = object->getOwnProperty(state, ObjectPropertyName(strings.message));
+        if (desc.hasValue() && desc.isDataProperty()) {
+            message.reset(new SerializedStringValue(desc.value(state, Value(object)).toString(state)));
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedErrorObjectValue(code, std::move(message)));
+    } else if (object->isArrayBufferObject()) {
+        ArrayBufferObject* buffer = object->asArrayBufferObject();
+        if (buffer->isDetachedBuffer()) {
+            return nullptr;
+        }
+
+        bool isResizable = buffer->isResizableArrayBuffer();
+        size_t byteLength = buffer->byteLength();
+        size_t maxByteLength = isResizable ? buffer->maxByteLength() : byteLength;
+        SerializedArrayBufferObjectValue* value = new SerializedArrayBufferObjectValue(byteLength, maxByteLength, isResizable);
+
+        if (memory.m_transferList) {
+            for (size_t i = 0; i < memory.m_transferList->size(); i++) {
+                if ((*memory.m_transferList)[i].asObject() == buffer) {
+                    // data block is moved in transferBuffers after the whole graph is serialized successfully
+                    memory.m_transferredBuffers.push_back(std::make_pair(buffer, value));
+                    return std::unique_ptr<SerializedValue>(value);
+                }
+            }
+        }
+
+        value->m_bytes.assign(reinterpret_cast<const char*>(buffer->data()), byteLength);
+        return std::unique_ptr<SerializedValue>(value);
+    } else if (object->isArrayBufferView()) {
+        ArrayBufferView* view = object->asArrayBufferView();
+        bool isDataView = object->isDataViewObject();
+        TypedArrayType typedArrayType = isDataView ? TypedArrayType::Int8 : object->asTypedArrayObject()->typedArrayType();
+
+        auto buffer = serializeValue(&state, Value(view->buffer()), memory);
+        if (!buffer) {
+            return nullptr;
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedArrayBufferViewValue(isDataView, typedArrayType, view->isAutoLength(),
+                                                                                   view->byteOffset(), view->byteLength(), view->arrayLength(), std::move(buffer)));
+    }
+
+    // functions, proxies, promises and other exotic objects cannot be cloned
+    return nullptr;
+}
+
+bool Serializer::serializeOwnProperties(ExecutionState& state, Object* object, bool skipIndexProperties,
+                                        std::vector<std::pair<std::unique_ptr<SerializedValue>, std::unique_ptr<SerializedValue>>>& properties, ObjectMemory& memory)
+{
+    Object::OwnPropertyKeyVector keys = object->ownPropertyKeys(state);
+    for (size_t i = 0; i < keys.size(); i++) {
+        const Value& key = keys[i];
+        if (key.isSymbol()) {
+            continue;
+        }
+
+        ObjectPropertyName propertyName(state, key);
+        if (skipIndexProperties && propertyName.isIndexString()) {
+            continue;
+        }
+
+        // property can be removed by getter of previous property
+        ObjectGetResult desc = object->getOwnProperty(state, propertyName);
+        if (!desc.hasValue() || !desc.isEnumerable()) {
+            continue;
+        }
+
+        auto value = serializeValue(&state, desc.value(state, Value(object)), memory);
+        if (!value) {
+            return false;
+        }
+        properties.push_back(std::make_pair(std::unique_ptr<SerializedValue>(new SerializedStringValue(key.toString(state))), std::move(value)));
+    }
+    return true;
+}
+
+void Serializer::transferBuffers(ObjectMemory& memory)
+{
+    // every transferred buffer has its entry at the same index of transferList
+    // even if it is not reachable from the serialized value
+    size_t baseIndex = memory.m_transferTable->size();
+    for (size_t i = 0; i < memory.m_transferList->size(); i++) {
+        ArrayBufferObject* buffer = (*memory.m_transferList)[i].asObject()->asArrayBufferObject();
+        SerializedTransferTable::Entry entry;
+        // getters could detach or resize the buffer during serialization
+        if (!buffer->isDetachedBuffer()) {
+            bool isResizable = buffer->isResizableArrayBuffer();
+            size_t byteLength = buffer->byteLength();
+            size_t maxByteLength = isResizable ? buffer->maxByteLength() : byteLength;
+            void* data = buffer->backingStore()->releasePlatformAllocatedData();
+            if (!data && maxByteLength) {
+                // data block is not owned by Platform (e.g. external buffer). fallback to copy
+                data = Global::platform()->onMallocArrayBufferObjectDataBuffer(maxByteLength);
+                memcpy(data, buffer->data(), byteLength);
+                memset(static_cast<uint8_t*>(data) + byteLength, 0, maxByteLength - byteLength);
+            }
+            entry = SerializedTransferTable::Entry(data, byteLength, maxByteLength, isResizable);
+        }
+        memory.m_transferTable->append(entry);
+    }
+
+    for (size_t i = 0; i < memory.m_transferredBuffers.size(); i++) {
+        ArrayBufferObject* buffer = memory.m_transferredBuffers[i].first;
+        SerializedArrayBufferObjectValue* value = memory.m_transferredBuffers[i].second;
+        for (size_t j = 0; j < memory.m_transferList->size(); j++) {
+            if ((*memory.m_transferList)[j].asObject() == buffer) {
+                value->m_transferIndex = baseIndex + j;
+                break;
+            }
+        }
+        ASSERT(value->m_transferIndex != SIZE_MAX);
+    }
+
+    for (size_t i = 0; i < memory.m_transferList->size(); i++) {
+        ArrayBufferObject* buffer = (*memory.m_transferList)[i].asObject()->asArrayBufferObject();
+        if (!buffer->isDetachedBuffer()) {
+            buffer->detachArrayBuffer();
+        }
     }
-    return false;
 }
 
 std::unique_ptr<SerializedValue> Serializer::deserializeFrom(std::istringstream& input)
 {
-    unsigned char type;
-    input >> type;
+    uint8_t type = static_cast<uint8_t>(input.get());
     switch (type) {
 #define DECLARE_SERIALIZABLE_TYPE(name) \
     case SerializedValue::Type::name:   \
@@ -88,10 +394,40 @@ std::unique_ptr<SerializedValue> Serializer::deserializeFrom(std::istringstream&
         return SerializedSharedArrayBufferObjectValue::deserializeFrom(input);
 #endif
     default:
-        RELEASE_ASSERT_NOT_REACHED();
+        // unknown type or end of stream
+        return nullptr;
     }
-    RELEASE_ASSERT_NOT_REACHED();
-    return nullptr;
+}
+
+Value Serializer::deserializeValueFrom(ExecutionState& state, std::istringstream& input, SerializedTransferTable* transferTable, ValueVector* transferredArrayBuffers)
+{
+    std::unique_ptr<SerializedValue> value = deserializeFrom(input);
+    if (UNLIKELY(!value)) {
+        SerializedValue::throwMalformedDataError(state);
+    }
+
+    SerializedValue::ObjectMemory memory(transferTable);
+    if (transferTable && transferredArrayBuffers) {
+        memory.m_transferredObjects.resize(transferTable->size(), Value(Value::EmptyValue));
+    }
+    Value result = value->toValueWithObjectMemory(state, memory);
+
+    if (transferTable && transferredArrayBuffers) {
+        // entries not reachable from the value are adopted into new ArrayBuffers
+        transferredArrayBuffers->resize(memory.m_transferredObjects.size());
+        for (size_t i = 0; i < memory.m_transferredObjects.size(); i++) {
+            if (memory.m_transferredObjects[i].isEmpty()) {
+                memory.m_transferredObjects[i] = Value(SerializedArrayBufferObjectValue::createTransferredBuffer(state, transferTable, i));
+            }
+            (*transferredArrayBuffers)[i] = memory.m_transferredObjects[i];
+        }
+    }
+    return result;
+}
+
+void SerializedValue::throwMalformedDataError(ExecutionState& state)
+{
+    ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "Malformed serialized data");
 }
 
 } // namespace Escargot
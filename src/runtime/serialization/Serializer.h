@@ -22,17 +22,56 @@
 
 #include "runtime/Value.h"
 #include "runtime/serialization/SerializedValue.h"
+#include "runtime/serialization/SerializedTransferTable.h"
 
 namespace Escargot {
 
+class SerializedArrayBufferObjectValue;
+
 class Serializer {
 public:
     // this function can return nullptr if serialize failed
+    // only primitive values and SharedArrayBuffer can be serialized without ExecutionState
     static std::unique_ptr<SerializedValue> serialize(const Value& value);
+    // structured clone of value. plain objects, arrays, Date, RegExp, Map, Set, Error, ArrayBuffer,
+    // TypedArray and DataView are supported in addition, and shared or cyclic references are preserved
+    // ArrayBuffers in transferList are detached and their data blocks are moved into transferTable without copying
+    // result only has indexes into transferTable, so transferTable is needed if transferList is given
+    // this function can return nullptr if value contains an object which cannot be cloned
+    static std::unique_ptr<SerializedValue> serialize(ExecutionState& state, const Value& value, const ValueVector* transferList = nullptr, SerializedTransferTable* transferTable = nullptr);
     // returns the serialization was successful
     static bool serializeInto(const Value& value, std::ostringstream& output);
+    static bool serializeInto(ExecutionState& state, const Value& value, std::ostringstream& output, const ValueVector* transferList = nullptr, SerializedTransferTable* transferTable = nullptr);
 
+    // returns nullptr if input is malformed
     static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& input);
+    // deserializes and converts a value. throws TypeError if input is malformed
+    // if transferredArrayBuffers is given, it is filled with an ArrayBuffer for each entry of transferTable
+    // in transferList order, including the ones not reachable from the value
+    static Value deserializeValueFrom(ExecutionState& state, std::istringstream& input, SerializedTransferTable* transferTable = nullptr, ValueVector* transferredArrayBuffers = nullptr);
+
+private:
+    struct ObjectMemory {
+        ObjectMemory(const ValueVector* transferList, SerializedTransferTable* transferTable)
+            : m_transferList(transferList)
+            , m_transferTable(transferTable)
+        {
+        }
+
+        // objects are numbered in the order of first appearance
+        std::unordered_map<Object*, size_t> m_objectIndex;
+        // keeps visited objects alive while getters run
+        ValueVector m_visitedObjects;
+        const ValueVector* m_transferList;
+        SerializedTransferTable* m_transferTable;
+        std::vector<std::pair<ArrayBufferObject*, SerializedArrayBufferObjectValue*>> m_transferredBuffers;
+    };
+
+    static std::unique_ptr<SerializedValue> serializeValue(ExecutionState* state, const Value& value, ObjectMemory& memory);
+    static std::unique_ptr<SerializedValue> serializeObject(ExecutionState& state, Object* object, ObjectMemory& memory);
+    static bool serializeOwnProperties(ExecutionState& state, Object* object, bool skipIndexProperties,
+                                       std::vector<std::pair<std::unique_ptr<SerializedValue>, std::unique_ptr<SerializedValue>>>& properties, ObjectMemory& memory);
+    static void transferBuffers(ObjectMemory& memory);
 };
 
 } // namespace Escargot
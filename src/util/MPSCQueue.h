@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#if defined(ENABLE_THREADING)
+
+#ifndef __EscargotMPSCQueue__
+#define __EscargotMPSCQueue__
+
+#include <atomic>
+
+namespace Escargot {
+
+// lock-free multiple producer single consumer queue
+// producers never block each other. only one thread can call dequeue
+template <typename T>
+class MPSCQueue {
+    struct Node {
+        Node()
+            : m_next(nullptr)
+            , m_value()
+        {
+        }
+
+        explicit Node(T&& value)
+            : m_next(nullptr)
+            , m_value(std::move(value))
+        {
+        }
+
+        std::atomic<Node*> m_next;
+        T m_value;
+    };
+
+public:
+    MPSCQueue()
+        : m_head(new Node())
+        , m_tail(m_head.load(std::memory_order_relaxed))
+    {
+    }
+
+    ~MPSCQueue()
+    {
+        Node* node = m_tail;
+        while (node) {
+            Node* next = node->m_next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    // can be called from any thread
+    void enqueue(T&& value)
+    {
+        Node* node = new Node(std::move(value));
+        Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+        // the consumer cannot see node until the link is stored
+        prev->m_next.store(node, std::memory_order_release);
+    }
+
+    // can be called from the consumer thread only
+    // returns false if queue is empty or a producer is in the middle of enqueue
+    bool dequeue(T& result)
+    {
+        Node* tail = m_tail;
+        Node* next = tail->m_next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        result = std::move(next->m_value);
+        // next becomes the new stub node
+        m_tail = next;
+        delete tail;
+        return true;
+    }
+
+    // can be called from the consumer thread only
+    bool isEmpty() const
+    {
+        return !m_tail->m_next.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<Node*> m_head;
+    Node* m_tail;
+};
+
+} // namespace Escargot
+
+#endif
+
+#endif
@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotStringKernels__
+#define __EscargotStringKernels__
+
+// Vectorized kernels for hot string operations.
+// SSE2 (x86) or NEON (aarch64) code is selected at build time and scalar code is used otherwise.
+// Define ESCARGOT_DISABLE_STRING_SIMD to force the scalar code.
+#if !defined(ESCARGOT_DISABLE_STRING_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ESCARGOT_STRING_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define ESCARGOT_STRING_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(ESCARGOT_STRING_SIMD_SSE2) || defined(ESCARGOT_STRING_SIMD_NEON)
+#define ESCARGOT_STRING_SIMD
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Escargot {
+
+// same as the definition in runtime/String.h
+typedef unsigned char LChar;
+
+class StringKernels {
+public:
+    // copy characters with widening or narrowing
+    // narrowing copy expects that every source character fits in Latin-1
+    template <typename T>
+    static ALWAYS_INLINE void copyCharacters(T* dst, const T* src, size_t length)
+    {
+        memcpy(dst, src, sizeof(T) * length);
+    }
+
+    static void copyCharacters(char16_t* dst, const LChar* src, size_t length)
+    {
+        size_t i = 0;
+#if defined(ESCARGOT_STRING_SIMD_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= length; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+        }
+#elif defined(ESCARGOT_STRING_SIMD_NEON)
+        for (; i + 16 <= length; i += 16) {
+            uint8x16_t v = vld1q_u8(src + i);
+            vst1q_u16(reinterpret_cast<uint16_t*>(dst + i), vmovl_u8(vget_low_u8(v)));
+            vst1q_u16(reinterpret_cast<uint16_t*>(dst + i + 8), vmovl_high_u8(v));
+        }
+#endif
+        for (; i < length; i++) {
+            dst[i] = src[i];
+        }
+    }
+
+    static void copyCharacters(LChar* dst, const char16_t* src, size_t length)
+    {
+        size_t i = 0;
+#if defined(ESCARGOT_STRING_SIMD_SSE2)
+        for (; i + 16 <= length; i += 16) {
+            __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(v1, v2));
+        }
+#elif defined(ESCARGOT_STRING_SIMD_NEON)
+        for (; i + 16 <= length; i += 16) {
+            uint16x8_t v1 = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i));
+            uint16x8_t v2 = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i + 8));
+            vst1q_u8(dst + i, vcombine_u8(vmovn_u16(v1), vmovn_u16(v2)));
+        }
+#endif
+        for (; i < length; i++) {
+            ASSERT(src[i] < 256);
+            dst[i] = src[i];
+        }
+    }
+
+    // character classification
+    static bool isAllASCII(const LChar* buf, size_t length)
+    {
+        size_t i = 0;
+#if defined(ESCARGOT_STRING_SIMD_SSE2)
+        for (; i + 16 <= length; i += 16) {
+            if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + i)))) {
+                return false;
+            }
+        }
+#elif defined(ESCARGOT_STRING_SIMD_NEON)
+        for (; i + 16 <= length; i += 16) {
+            if (vmaxvq_u8(vld1q_u8(buf + i)) & 0x80) {
+                return false;
+            }
+        }
+#endif
+        for (; i < length; i++) {
+            if (buf[i] & 0x80) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool isAllASCII(const char16_t* buf, size_t length)
+    {
+        return hasNoBitsOf(buf, length, 0xFF80);
+    }
+
+    static bool isAllLatin1(const char16_t* buf, size_t length)
+    {
+        return hasNoBitsOf(buf, length, 0xFF00);
+    }
+
+    // returns index of the first c in buf or SIZE_MAX
+    static size_t findCharacter(const LChar* buf, size_t length, char16_t c)
+    {
+        if (c > 0xFF || !length) {
+            return SIZE_MAX;
+        }
+        const void* found = memchr(buf, c, length);
+        return found ? reinterpret_cast<const LChar*>(found) - buf : SIZE_MAX;
+    }
+
+    static size_t findCharacter(const char16_t* buf, size_t length, char16_t c)
+    {
+        size_t i = 0;
+#if defined(ESCARGOT_STRING_SIMD)
+        Lanes16 needle = splat16(c);
+        for (; i + 8 <= length; i += 8) {
+            uint64_t mask = laneMask(equal16(load8(buf + i), needle));
+            if (mask) {
+                return i + firstLane(mask);
+            }
+        }
+#endif
+        for (; i < length; i++) {
+            if (buf[i] == c) {
+                return i;
+            }
+        }
+        return SIZE_MAX;
+    }
+
+    // returns the first index where a and b differ or length
+    template <typename A, typename B>
+    static size_t findFirstMismatch(const A* a, const B* b, size_t length)
+    {
+        size_t i = 0;
+#if defined(ESCARGOT_STRING_SIMD)
+        for (; i + 8 <= length; i += 8) {
+            uint64_t mask = laneMask(equal16(load8(a + i), load8(b + i)));
+            if (mask != AllLanesMask) {
+                return i + firstLane(~mask);
+            }
+        }
+#endif
+        for (; i < length; i++) {
+            if (a[i] != b[i]) {
+                return i;
+            }
+        }
+        return length;
+    }
+
+    template <typename T>
+    static ALWAYS_INLINE bool equalCharacters(const T* a, const T* b, size_t length)
+    {
+        return memcmp(a, b, sizeof(T) * length) == 0;
+    }
+
+    template <typename A, typename B>
+    static ALWAYS_INLINE bool equalCharacters(const A* a, const B* b, size_t length)
+    {
+        return findFirstMismatch(a, b, length) == length;
+    }
+
+    // returns the first index of pattern in text starting from `from` or SIZE_MAX
+    // short patterns search the first character with findCharacter and then verify the rest
+    // long patterns use Boyer-Moore-Horspool with a skip table indexed by the lower byte of characters
+    template <typename T, typename P>
+    static size_t findSubstring(const T* text, size_t textLength, const P* pattern, size_t patternLength, size_t from)
+    {
+        if (patternLength == 0) {
+            return from <= textLength ? from : SIZE_MAX;
+        }
+        if (patternLength > textLength || from > textLength - patternLength) {
+            return SIZE_MAX;
+        }
+
+        const size_t last = textLength - patternLength;
+        const size_t m1 = patternLength - 1;
+        if (patternLength < HorspoolMinPatternLength || last - from < HorspoolMinTextLength) {
+            const char16_t first = pattern[0];
+            size_t pos = from;
+            while (pos <= last) {
+                size_t found = findCharacter(text + pos, last - pos + 1, first);
+                if (found == SIZE_MAX) {
+                    return SIZE_MAX;
+                }
+                pos += found;
+                if (equalCharacters(text + pos + 1, pattern + 1, m1)) {
+                    return pos;
+                }
+                pos++;
+            }
+            return SIZE_MAX;
+        }
+
+        size_t skip[256];
+        for (size_t i = 0; i < 256; i++) {
+            skip[i] = patternLength;
+        }
+        for (size_t i = 0; i < m1; i++) {
+            skip[pattern[i] & 0xFF] = m1 - i;
+        }
+
+        const char16_t lastCharacter = pattern[m1];
+        size_t pos = from;
+        while (pos <= last) {
+            char16_t c = text[pos + m1];
+            if (c == lastCharacter && equalCharacters(text + pos, pattern, m1)) {
+                return pos;
+            }
+            pos += skip[c & 0xFF];
+        }
+        return SIZE_MAX;
+    }
+
+    // returns the last index of pattern in text which is not greater than `from` or SIZE_MAX
+    template <typename T, typename P>
+    static size_t findLastSubstring(const T* text, size_t textLength, const P* pattern, size_t patternLength, size_t from)
+    {
+        if (patternLength > textLength) {
+            return SIZE_MAX;
+        }
+        if (patternLength == 0) {
+            return std::min(from, textLength);
+        }
+
+        const char16_t first = pattern[0];
+        size_t pos = std::min(from, textLength - patternLength);
+        do {
+            if (text[pos] == first && equalCharacters(text + pos + 1, pattern + 1, patternLength - 1)) {
+                return pos;
+            }
+        } while (pos-- > 0);
+        return SIZE_MAX;
+    }
+
+    // returns the first index of a character which should be escaped in JSON string ('"', '\\' or control character) or length
+    template <typename T>
+    static size_t findJSONEscapeCharacter(const T* buf, size_t length)
+    {
+        size_t i = 0;
+#if defined(ESCARGOT_STRING_SIMD)
+        const Lanes16 quote = splat16('"');
+        const Lanes16 backslash = splat16('\\');
+        for (; i + 8 <= length; i += 8) {
+            Lanes16 v = load8(buf + i);
+            uint64_t mask = laneMask(or16(or16(equal16(v, quote), equal16(v, backslash)), lessThan16(v, 0x20)));
+            if (mask) {
+                return i + firstLane(mask);
+            }
+        }
+#endif
+        for (; i < length; i++) {
+            if (buf[i] < 0x20 || buf[i] == '"' || buf[i] == '\\') {
+                return i;
+            }
+        }
+        return length;
+    }
+
+    // converts case of ASCII characters from the start of src into dst
+    // returns the index of the first non-ASCII character (or length) where the conversion stopped
+    template <bool toUpper>
+    static size_t convertASCIICase(const LChar* src, LChar* dst, size_t length)
+    {
+        const LChar rangeStart = toUpper ? 'a' : 'A';
+        const LChar rangeEnd = toUpper ? 'z' : 'Z';
+        size_t i = 0;
+#if defined(ESCARGOT_STRING_SIMD_SSE2)
+        const __m128i start = _mm_set1_epi8(rangeStart - 1);
+        const __m128i end = _mm_set1_epi8(rangeEnd + 1);
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+        for (; i + 16 <= length; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            if (_mm_movemask_epi8(v)) {
+                break;
+            }
+            // signed comparison is fine for ASCII
+            __m128i inRange = _mm_and_si128(_mm_cmpgt_epi8(v, start), _mm_cmplt_epi8(v, end));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(v, _mm_and_si128(inRange, caseBit)));
+        }
+#elif defined(ESCARGOT_STRING_SIMD_NEON)
+        const uint8x16_t start = vdupq_n_u8(rangeStart);
+        const uint8x16_t end = vdupq_n_u8(rangeEnd);
+        const uint8x16_t caseBit = vdupq_n_u8(0x20);
+        for (; i + 16 <= length; i += 16) {
+            uint8x16_t v = vld1q_u8(src + i);
+            if (vmaxvq_u8(v) & 0x80) {
+                break;
+            }
+            uint8x16_t inRange = vandq_u8(vcgeq_u8(v, start), vcleq_u8(v, end));
+            vst1q_u8(dst + i, veorq_u8(v, vandq_u8(inRange, caseBit)));
+        }
+#endif
+        for (; i < length; i++) {
+            LChar c = src[i];
+            if (c & 0x80) {
+                break;
+            }
+            dst[i] = (c >= rangeStart && c <= rangeEnd) ? (c ^ 0x20) : c;
+        }
+        return i;
+    }
+
+private:
+    static const size_t HorspoolMinPatternLength = 8;
+    static const size_t HorspoolMinTextLength = 256;
+
+#if defined(ESCARGOT_STRING_SIMD_SSE2)
+    // 8 lanes of 16-bit characters
+    typedef __m128i Lanes16;
+    // _mm_movemask_epi8 gives 2 bits per lane
+    static const unsigned BitsPerLane = 2;
+    static const uint64_t AllLanesMask = 0xFFFF;
+
+    static ALWAYS_INLINE Lanes16 load8(const char16_t* p)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+
+    static ALWAYS_INLINE Lanes16 load8(const LChar* p)
+    {
+        return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128());
+    }
+
+    static ALWAYS_INLINE Lanes16 splat16(char16_t c)
+    {
+        return _mm_set1_epi16(static_cast<short>(c));
+    }
+
+    static ALWAYS_INLINE Lanes16 equal16(Lanes16 a, Lanes16 b)
+    {
+        return _mm_cmpeq_epi16(a, b);
+    }
+
+    static ALWAYS_INLINE Lanes16 or16(Lanes16 a, Lanes16 b)
+    {
+        return _mm_or_si128(a, b);
+    }
+
+    static ALWAYS_INLINE Lanes16 lessThan16(Lanes16 v, char16_t limit)
+    {
+        // v < limit <=> saturated (v - (limit - 1)) == 0
+        return _mm_cmpeq_epi16(_mm_subs_epu16(v, splat16(limit - 1)), _mm_setzero_si128());
+    }
+
+    static ALWAYS_INLINE uint64_t laneMask(Lanes16 v)
+    {
+        return static_cast<uint32_t>(_mm_movemask_epi8(v));
+    }
+#elif defined(ESCARGOT_STRING_SIMD_NEON)
+    typedef uint16x8_t Lanes16;
+    // narrowing shift gives 8 bits per lane
+    static const unsigned BitsPerLane = 8;
+    static const uint64_t AllLanesMask = UINT64_MAX;
+
+    static ALWAYS_INLINE Lanes16 load8(const char16_t* p)
+    {
+        return vld1q_u16(reinterpret_cast<const uint16_t*>(p));
+    }
+
+    static ALWAYS_INLINE Lanes16 load8(const LChar* p)
+    {
+        return vmovl_u8(vld1_u8(p));
+    }
+
+    static ALWAYS_INLINE Lanes16 splat16(char16_t c)
+    {
+        return vdupq_n_u16(c);
+    }
+
+    static ALWAYS_INLINE Lanes16 equal16(Lanes16 a, Lanes16 b)
+    {
+        return vceqq_u16(a, b);
+    }
+
+    static ALWAYS_INLINE Lanes16 or16(Lanes16 a, Lanes16 b)
+    {
+        return vorrq_u16(a, b);
+    }
+
+    static ALWAYS_INLINE Lanes16 lessThan16(Lanes16 v, char16_t limit)
+    {
+        return vcltq_u16(v, vdupq_n_u16(limit));
+    }
+
+    static ALWAYS_INLINE uint64_t laneMask(Lanes16 v)
+    {
+        return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(v, 4)), 0);
+    }
+#endif
+
+#if defined(ESCARGOT_STRING_SIMD)
+    static ALWAYS_INLINE size_t firstLane(uint64_t mask)
+    {
+        ASSERT(mask);
+#if defined(_MSC_VER)
+        unsigned long index;
+#if defined(ESCARGOT_STRING_SIMD_SSE2)
+        _BitScanForward(&index, static_cast<unsigned long>(mask));
+#else
+        _BitScanForward64(&index, mask);
+#endif
+        return index / BitsPerLane;
+#else
+        return __builtin_ctzll(mask) / BitsPerLane;
+#endif
+    }
+#endif
+
+    static bool hasNoBitsOf(const char16_t* buf, size_t length, char16_t bits)
+    {
+        size_t i = 0;
+#if defined(ESCARGOT_STRING_SIMD_SSE2)
+        const __m128i mask = splat16(bits);
+        for (; i + 8 <= length; i += 8) {
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(load8(buf + i), mask), _mm_setzero_si128())) != 0xFFFF) {
+                return false;
+            }
+        }
+#elif defined(ESCARGOT_STRING_SIMD_NEON)
+        const uint16x8_t mask = splat16(bits);
+        for (; i + 8 <= length; i += 8) {
+            if (vmaxvq_u16(vandq_u16(load8(buf + i), mask))) {
+                return false;
+            }
+        }
+#endif
+        for (; i < length; i++) {
+            if (buf[i] & bits) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace Escargot
+
+#endif
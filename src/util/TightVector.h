@@ -492,6 +492,10 @@ public:
         T* newBuffer;
         if (m_buffer == nullptr) {
             newBuffer = GCAllocator().allocate(newSize);
+        } else if (GC_size(m_buffer) >= newSize * sizeof(T)) {
+            // buffer was allocated bigger than needed (see Object::Object(ExecutionState&, Object*, size_t))
+            // GC_REALLOC could shrink it when it is less than half used
+            newBuffer = m_buffer;
         } else {
             newBuffer = (T*)GC_REALLOC(m_buffer, newSize * sizeof(T));
         }
@@ -592,6 +596,13 @@ public:
         m_buffer = resetData;
     }
 
+    // used for specific case
+    // old buffer is not owned by this vector (e.g. inline property storage of Object)
+    void resetWithoutRelease(T* resetData)
+    {
+        m_buffer = resetData;
+    }
+
 
 protected:
     T* m_buffer;
@@ -118,14 +118,10 @@ static Value builtinWASMValidate(ExecutionState& state, Value thisValue, size_t
 
     ArrayBufferObject* srcBuffer = WASMOperations::copyStableBufferBytes(state, source).asPointerValue()->asArrayBufferObject();
     ASSERT(!srcBuffer->isDetachedBuffer());
-    size_t byteLength = srcBuffer->byteLength();
-
-    own wasm_byte_vec_t binary;
-    wasm_byte_vec_new_uninitialized(&binary, byteLength);
-    memcpy(binary.data, srcBuffer->data(), byteLength);
 
+    // srcBuffer is a private copy, so its bytes are validated directly
+    wasm_byte_vec_t binary = { srcBuffer->byteLength(), reinterpret_cast<wasm_byte_t*>(srcBuffer->data()) };
     bool result = wasm_module_validate(ThreadLocal::wasmStore(), &binary);
-    wasm_byte_vec_delete(&binary);
 
     return Value(result);
 }
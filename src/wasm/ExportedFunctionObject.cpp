@@ -36,15 +36,31 @@
 
 namespace Escargot {
 
-ExportedFunctionObject::ExportedFunctionObject(ExecutionState& state, NativeFunctionInfo info, wasm_func_t* func)
+ExportedFunctionObject::ExportedFunctionObject(ExecutionState& state, NativeFunctionInfo info, wasm_func_t* func, const wasm_functype_t* functype)
     : NativeFunctionObject(state, info)
     , m_function(func)
+    , m_valueKinds(nullptr)
+    , m_parameterCount(0)
+    , m_resultCount(0)
 {
-    ASSERT(!!m_function);
+    ASSERT(!!m_function && !!functype);
+
+    const wasm_valtype_vec_t* parameters = wasm_functype_params(functype);
+    const wasm_valtype_vec_t* results = wasm_functype_results(functype);
+    m_parameterCount = parameters->size;
+    m_resultCount = results->size;
+    m_valueKinds = (uint8_t*)malloc(std::max(m_parameterCount + m_resultCount, (uint32_t)1) * sizeof(uint8_t));
+    for (size_t i = 0; i < m_parameterCount; i++) {
+        m_valueKinds[i] = wasm_valtype_kind(parameters->data[i]);
+    }
+    for (size_t i = 0; i < m_resultCount; i++) {
+        m_valueKinds[m_parameterCount + i] = wasm_valtype_kind(results->data[i]);
+    }
 
     addFinalizer([](PointerValue* obj, void* data) {
         ExportedFunctionObject* self = (ExportedFunctionObject*)obj;
         wasm_func_delete(self->function());
+        free(self->m_valueKinds);
     },
                  nullptr);
 }
@@ -62,48 +78,121 @@ void* ExportedFunctionObject::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+static NEVER_INLINE void throwTrapError(ExecutionState& state, own wasm_trap_t* trap)
+{
+    own wasm_name_t message;
+    wasm_trap_message(trap, &message);
+    ESCARGOT_LOG_ERROR("[WASM Message] %s\n", message.data);
+    wasm_name_delete(&message);
+    wasm_trap_delete(trap);
+    ErrorObject::throwBuiltinError(state, ErrorCode::WASMRuntimeError, ErrorObject::Messages::WASM_FuncCallError);
+}
+
+// trampoline for functions whose parameters have the same numeric type and which return at most one numeric value
+// e.g. (i32, i32) -> i32 or (f64) -> f64
+// number arguments and result are converted in place (see WASMValueConverter::toWebAssemblyNumericValue)
+// and the call does not touch the function type
+template <wasm_valkind_t ParameterKind, size_t Arity, bool HasResult, wasm_valkind_t ResultKind>
+static Value callExportedNumericFunction(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
+{
+    ExportedFunctionObject* callee = state.resolveCallee()->asExportedFunctionObject();
+    ASSERT(callee->parameterCount() == Arity && callee->resultCount() == (HasResult ? 1 : 0));
+
+    wasm_val_t argsBuffer[Arity ? Arity : 1];
+    for (size_t i = 0; i < Arity; i++) {
+        argsBuffer[i] = WASMValueConverter::toWebAssemblyNumericValue(state, (argc > i) ? argv[i] : Value(), ParameterKind);
+    }
+    wasm_val_t retBuffer[1];
+    wasm_val_vec_t args = { Arity, argsBuffer };
+    wasm_val_vec_t ret = { HasResult ? 1u : 0u, retBuffer };
+
+    own wasm_trap_t* trap = wasm_func_call(callee->function(), &args, &ret);
+    if (UNLIKELY(!!trap)) {
+        throwTrapError(state, trap);
+        return Value();
+    }
+
+    if (HasResult) {
+        ASSERT(retBuffer[0].kind == ResultKind);
+        return WASMValueConverter::numericToJSValue(retBuffer[0]);
+    }
+    return Value();
+}
+
+template <wasm_valkind_t ParameterKind, size_t Arity>
+static NativeFunctionPointer selectNumericTrampoline(size_t resultCount, wasm_valkind_t resultKind)
+{
+    if (resultCount == 0) {
+        return callExportedNumericFunction<ParameterKind, Arity, false, WASM_I32>;
+    }
+
+    ASSERT(resultCount == 1);
+    switch (resultKind) {
+    case WASM_I32:
+        return callExportedNumericFunction<ParameterKind, Arity, true, WASM_I32>;
+    case WASM_F32:
+        return callExportedNumericFunction<ParameterKind, Arity, true, WASM_F32>;
+    case WASM_F64:
+        return callExportedNumericFunction<ParameterKind, Arity, true, WASM_F64>;
+    default:
+        return nullptr;
+    }
+}
+
+template <wasm_valkind_t ParameterKind>
+static NativeFunctionPointer selectNumericTrampoline(size_t arity, size_t resultCount, wasm_valkind_t resultKind)
+{
+    switch (arity) {
+    case 0:
+        return selectNumericTrampoline<ParameterKind, 0>(resultCount, resultKind);
+    case 1:
+        return selectNumericTrampoline<ParameterKind, 1>(resultCount, resultKind);
+    case 2:
+        return selectNumericTrampoline<ParameterKind, 2>(resultCount, resultKind);
+    case 3:
+        return selectNumericTrampoline<ParameterKind, 3>(resultCount, resultKind);
+    case 4:
+        return selectNumericTrampoline<ParameterKind, 4>(resultCount, resultKind);
+    default:
+        return nullptr;
+    }
+}
+
 static Value callExportedFunction(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
 {
     ExportedFunctionObject* callee = state.resolveCallee()->asExportedFunctionObject();
     wasm_func_t* funcaddr = callee->function();
 
     // Let functype be func_type(store, funcaddr).
-    own wasm_functype_t* functype = wasm_func_type(funcaddr);
-
     // Let [parameters] ? [results] be functype.
-    const wasm_valtype_vec_t* parameters = wasm_functype_params(functype);
-    const wasm_valtype_vec_t* results = wasm_functype_results(functype);
+    // Note) value kinds of functype are cached in ExportedFunctionObject
+    size_t parameterCount = callee->parameterCount();
+    size_t resultCount = callee->resultCount();
+    const uint8_t* parameterKinds = callee->valueKinds();
 
     // Let args be << >>
-    wasm_val_t* argsBuffer = ALLOCA(parameters->size * sizeof(wasm_val_t), wasm_val_t);
-    wasm_val_vec_t args = { parameters->size, argsBuffer };
+    wasm_val_t* argsBuffer = ALLOCA(parameterCount * sizeof(wasm_val_t), wasm_val_t);
+    wasm_val_vec_t args = { parameterCount, argsBuffer };
 
     // For each t of parameters,
-    for (size_t i = 0; i < parameters->size; i++) {
+    for (size_t i = 0; i < parameterCount; i++) {
         // If argValues?s size > i, let arg be argValues[i].
         // Otherwise, let arg be undefined.
         Value arg = (argc > i) ? argv[i] : Value();
 
         // Append ToWebAssemblyValue(arg, t) to args.
-        args.data[i] = WASMValueConverter::toWebAssemblyValue(state, arg, wasm_valtype_kind(parameters->data[i]));
+        args.data[i] = WASMValueConverter::toWebAssemblyValue(state, arg, parameterKinds[i]);
     }
 
-    wasm_val_t* retBuffer = ALLOCA(results->size * sizeof(wasm_val_t), wasm_val_t);
-    wasm_val_vec_t ret = { results->size, retBuffer };
-
-    wasm_functype_delete(functype);
+    wasm_val_t* retBuffer = ALLOCA(resultCount * sizeof(wasm_val_t), wasm_val_t);
+    wasm_val_vec_t ret = { resultCount, retBuffer };
 
     // Let (store, ret) be the result of func_invoke(store, funcaddr, args).
     own wasm_trap_t* trap = wasm_func_call(funcaddr, &args, &ret);
 
     // If ret is error, throw an exception. This exception should be a WebAssembly RuntimeError exception, unless otherwise indicated by the WebAssembly error mapping.
     if (trap) {
-        own wasm_name_t message;
-        wasm_trap_message(trap, &message);
-        ESCARGOT_LOG_ERROR("[WASM Message] %s\n", message.data);
-        wasm_name_delete(&message);
-        wasm_trap_delete(trap);
-        ErrorObject::throwBuiltinError(state, ErrorCode::WASMRuntimeError, ErrorObject::Messages::WASM_FuncCallError);
+        throwTrapError(state, trap);
         return Value();
     }
 
@@ -132,6 +221,45 @@ static Value callExportedFunction(ExecutionState& state, Value thisValue, size_t
     return Object::createArrayFromList(state, values);
 }
 
+static NativeFunctionPointer selectCallTrampoline(const wasm_functype_t* functype)
+{
+    const wasm_valtype_vec_t* parameters = wasm_functype_params(functype);
+    const wasm_valtype_vec_t* results = wasm_functype_results(functype);
+
+    if (results->size > 1) {
+        return callExportedFunction;
+    }
+    wasm_valkind_t resultKind = results->size ? wasm_valtype_kind(results->data[0]) : WASM_I32;
+    if (!WASMValueConverter::isNumericValueType(resultKind)) {
+        return callExportedFunction;
+    }
+
+    // every parameter should have the same numeric type
+    wasm_valkind_t parameterKind = parameters->size ? wasm_valtype_kind(parameters->data[0]) : WASM_I32;
+    for (size_t i = 0; i < parameters->size; i++) {
+        if (wasm_valtype_kind(parameters->data[i]) != parameterKind) {
+            return callExportedFunction;
+        }
+    }
+
+    NativeFunctionPointer trampoline = nullptr;
+    switch (parameterKind) {
+    case WASM_I32:
+        trampoline = selectNumericTrampoline<WASM_I32>(parameters->size, results->size, resultKind);
+        break;
+    case WASM_F32:
+        trampoline = selectNumericTrampoline<WASM_F32>(parameters->size, results->size, resultKind);
+        break;
+    case WASM_F64:
+        trampoline = selectNumericTrampoline<WASM_F64>(parameters->size, results->size, resultKind);
+        break;
+    default:
+        break;
+    }
+
+    return trampoline ? trampoline : callExportedFunction;
+}
+
 ExportedFunctionObject* ExportedFunctionObject::createExportedFunction(ExecutionState& state, wasm_func_t* funcaddr, uint32_t index)
 {
     ASSERT(!!funcaddr);
@@ -153,7 +281,8 @@ ExportedFunctionObject* ExportedFunctionObject::createExportedFunction(Execution
     // Let functype be func_type(store, funcaddr).
     // Let [paramTypes] -> [resultTypes] be functype.
     // Let arity be paramTypes?s size.
-    size_t arity = wasm_func_param_arity(funcaddr);
+    own wasm_functype_t* functype = wasm_func_type(funcaddr);
+    size_t arity = wasm_functype_params(functype)->size;
 
     // Let name be the name of the WebAssembly function funcaddr.
     // Perform ! SetFunctionName(function, name).
@@ -164,7 +293,9 @@ ExportedFunctionObject* ExportedFunctionObject::createExportedFunction(Execution
     // Let realm be the current Realm.
     // Let function be CreateBuiltinFunction(realm, steps, %FunctionPrototype%, ? [[FunctionAddress]] ?).
     // Set function.[[FunctionAddress]] to funcaddr.
-    function = new ExportedFunctionObject(state, NativeFunctionInfo(name, callExportedFunction, arity, NativeFunctionInfo::Strict), funcaddr);
+    // Note) a specialized trampoline is used instead of generic steps if the signature allows
+    function = new ExportedFunctionObject(state, NativeFunctionInfo(name, selectCallTrampoline(functype), arity, NativeFunctionInfo::Strict), funcaddr, functype);
+    wasm_functype_delete(functype);
 
     // Set map[funcaddr] to function.
     state.context()->wasmCache()->appendFunction(funcref, function);
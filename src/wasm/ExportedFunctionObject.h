@@ -25,12 +25,13 @@
 #include "runtime/NativeFunctionObject.h"
 
 struct wasm_func_t;
+struct wasm_functype_t;
 
 namespace Escargot {
 
 class ExportedFunctionObject : public NativeFunctionObject {
 public:
-    explicit ExportedFunctionObject(ExecutionState& state, NativeFunctionInfo info, wasm_func_t* func);
+    explicit ExportedFunctionObject(ExecutionState& state, NativeFunctionInfo info, wasm_func_t* func, const wasm_functype_t* functype);
 
     virtual bool isExportedFunctionObject() const override
     {
@@ -50,8 +51,28 @@ public:
         return m_function;
     }
 
+    size_t parameterCount() const
+    {
+        return m_parameterCount;
+    }
+
+    size_t resultCount() const
+    {
+        return m_resultCount;
+    }
+
+    // value kinds of parameters followed by value kinds of results
+    const uint8_t* valueKinds() const
+    {
+        return m_valueKinds;
+    }
+
 private:
     wasm_func_t* m_function;
+    // signature of m_function is cached here not to call wasm_func_type on every call
+    uint8_t* m_valueKinds;
+    uint32_t m_parameterCount;
+    uint32_t m_resultCount;
 };
 } // namespace Escargot
 #endif // __EscargotExportedFunctionObject__
@@ -39,15 +39,31 @@ WASMHostFunctionEnvironment::WASMHostFunctionEnvironment(Context* r, Object* f,
     : realm(r)
     , func(f)
     , functype(ft)
+    , valueKinds(nullptr)
+    , parameterCount(0)
+    , resultCount(0)
+    , hasOnlyNumericValueTypes(true)
 {
     ASSERT(!!r && !!ft && !!f);
     ASSERT(f->isCallable());
 
+    const wasm_valtype_vec_t* params = wasm_functype_params(ft);
+    const wasm_valtype_vec_t* results = wasm_functype_results(ft);
+    parameterCount = params->size;
+    resultCount = results->size;
+    valueKinds = (uint8_t*)malloc(std::max(parameterCount + resultCount, (uint32_t)1) * sizeof(uint8_t));
+    for (size_t i = 0; i < parameterCount + resultCount; i++) {
+        wasm_valkind_t kind = (i < parameterCount) ? wasm_valtype_kind(params->data[i]) : wasm_valtype_kind(results->data[i - parameterCount]);
+        valueKinds[i] = kind;
+        hasOnlyNumericValueTypes = hasOnlyNumericValueTypes && WASMValueConverter::isNumericValueType(kind);
+    }
+
     // FIXME current wasm_func_new_with_env does not support env-finalizer,
     // so WASMHostFunctionEnvironment needs to be deallocated manually.
     GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj, void*) {
         WASMHostFunctionEnvironment* self = (WASMHostFunctionEnvironment*)obj;
         wasm_functype_delete(self->functype);
+        free(self->valueKinds);
     },
                                    nullptr, nullptr, nullptr);
 }
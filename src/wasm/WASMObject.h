@@ -43,6 +43,12 @@ struct WASMHostFunctionEnvironment : public gc {
     Context* realm;
     Object* func;
     wasm_functype_t* functype;
+    // value kinds of parameters followed by value kinds of results, cached from functype
+    uint8_t* valueKinds;
+    uint32_t parameterCount;
+    uint32_t resultCount;
+    // every parameter and result is i32, f32 or f64
+    bool hasOnlyNumericValueTypes;
 };
 
 class WASMModuleObject : public DerivedObject {
@@ -28,6 +28,7 @@
 #include "runtime/PromiseObject.h"
 #include "runtime/TypedArrayObject.h"
 #include "runtime/ExtendedNativeFunctionObject.h"
+#include "codecache/CodeCache.h"
 #include "wasm/WASMObject.h"
 #include "wasm/ExportedFunctionObject.h"
 #include "wasm/WASMValueConverter.h"
@@ -51,18 +52,24 @@ static own wasm_trap_t* callbackHostFunction(void* env, const wasm_val_vec_t* ar
     ExecutionState state(funcEnv->realm);
 
     // Let [parameters] ? [results] be functype.
-    wasm_functype_t* functype = funcEnv->functype;
-    const wasm_valtype_vec_t* params = wasm_functype_params(functype);
-    const wasm_valtype_vec_t* res = wasm_functype_results(functype);
-    size_t argSize = params->size;
+    // Note) value kinds of functype are cached in WASMHostFunctionEnvironment
+    size_t argSize = funcEnv->parameterCount;
+    const uint8_t* resultKinds = funcEnv->valueKinds + argSize;
 
     // Let jsArguments be << >>
     Value* jsArguments = ALLOCA(sizeof(Value) * argSize, Value);
 
     // For each arg of arguments,
-    for (size_t i = 0; i < argSize; i++) {
-        // Append ! ToJSValue(arg) to jsArguments.
-        jsArguments[i] = WASMValueConverter::toJSValue(state, args->data[i]);
+    if (LIKELY(funcEnv->hasOnlyNumericValueTypes)) {
+        // fast path for i32, f32 and f64 values which need neither context nor allocation
+        for (size_t i = 0; i < argSize; i++) {
+            jsArguments[i] = WASMValueConverter::numericToJSValue(args->data[i]);
+        }
+    } else {
+        for (size_t i = 0; i < argSize; i++) {
+            // Append ! ToJSValue(arg) to jsArguments.
+            jsArguments[i] = WASMValueConverter::toJSValue(state, args->data[i]);
+        }
     }
 
     // Let ret be ? Call(func, undefined, jsArguments).
@@ -95,7 +102,7 @@ static own wasm_trap_t* callbackHostFunction(void* env, const wasm_val_vec_t* ar
     }
 
     // Let resultsSize be results?s size.
-    size_t resultsSize = res->size;
+    size_t resultsSize = funcEnv->resultCount;
     if (resultsSize == 0) {
         // If resultsSize is 0, return << >>
         return nullptr;
@@ -104,7 +111,11 @@ static own wasm_trap_t* callbackHostFunction(void* env, const wasm_val_vec_t* ar
     Value ret = result.result;
     if (resultsSize == 1) {
         // Otherwise, if resultsSize is 1, return << ToWebAssemblyValue(ret, results[0]) >>
-        results->data[0] = WASMValueConverter::toWebAssemblyValue(state, ret, wasm_valtype_kind(res->data[0]));
+        if (LIKELY(funcEnv->hasOnlyNumericValueTypes)) {
+            results->data[0] = WASMValueConverter::toWebAssemblyNumericValue(state, ret, resultKinds[0]);
+        } else {
+            results->data[0] = WASMValueConverter::toWebAssemblyValue(state, ret, resultKinds[0]);
+        }
     } else {
         // Otherwise,
         // Let method be ? GetMethod(ret, @@iterator).
@@ -124,7 +135,7 @@ static own wasm_trap_t* callbackHostFunction(void* env, const wasm_val_vec_t* ar
         // For each value and resultType in values and results, paired linearly,
         // Append ToWebAssemblyValue(value, resultType) to wasmValues.
         for (size_t i = 0; i < resultsSize; i++) {
-            results->data[i] = WASMValueConverter::toWebAssemblyValue(state, values[i], wasm_valtype_kind(res->data[i]));
+            results->data[i] = WASMValueConverter::toWebAssemblyValue(state, values[i], resultKinds[i]);
         }
     }
 
@@ -197,6 +208,57 @@ static Value wasmInstantiateModule(ExecutionState& state, Value thisValue, size_
     return result;
 }
 
+#if defined(ENABLE_CODE_CACHE)
+static bool shouldUseModuleCache(Context* context, const wasm_byte_vec_t* binary)
+{
+    CodeCache* codeCache = context->vmInstance()->codeCache();
+    return codeCache->enabled() && binary->size >= codeCache->minSourceLength();
+}
+
+static own wasm_module_t* loadModuleFromCache(Context* context, const wasm_byte_vec_t* binary)
+{
+    std::vector<uint8_t> artifact;
+    if (!context->vmInstance()->codeCache()->loadWASMModuleCache(reinterpret_cast<const uint8_t*>(binary->data), binary->size, artifact)) {
+        return nullptr;
+    }
+    wasm_byte_vec_t serialized = { artifact.size(), reinterpret_cast<wasm_byte_t*>(artifact.data()) };
+    return wasm_module_deserialize(ThreadLocal::wasmStore(), &serialized);
+}
+
+static void storeModuleToCache(Context* context, const wasm_byte_vec_t* binary, wasm_module_t* module)
+{
+    own wasm_byte_vec_t serialized;
+    wasm_module_serialize(module, &serialized);
+    if (serialized.size) {
+        context->vmInstance()->codeCache()->storeWASMModuleCache(reinterpret_cast<const uint8_t*>(binary->data), binary->size, reinterpret_cast<const uint8_t*>(serialized.data), serialized.size);
+    }
+    wasm_byte_vec_delete(&serialized);
+}
+#endif
+
+static own wasm_module_t* newModuleWithCache(ExecutionState& state, const wasm_byte_vec_t* binary)
+{
+#if defined(ENABLE_CODE_CACHE)
+    bool useCache = shouldUseModuleCache(state.context(), binary);
+    if (useCache) {
+        own wasm_module_t* module = loadModuleFromCache(state.context(), binary);
+        if (module) {
+            return module;
+        }
+    }
+#endif
+
+    own wasm_module_t* module = wasm_module_new(ThreadLocal::wasmStore(), binary);
+
+#if defined(ENABLE_CODE_CACHE)
+    if (module && useCache) {
+        storeModuleToCache(state.context(), binary, module);
+    }
+#endif
+
+    return module;
+}
+
 Value WASMOperations::copyStableBufferBytes(ExecutionState& state, Value source)
 {
     Value copyBuffer = source;
@@ -227,14 +289,11 @@ Value WASMOperations::compileModule(ExecutionState& state, Value thisValue, size
 
     ArrayBufferObject* srcBuffer = source.asPointerValue()->asArrayBufferObject();
     ASSERT(!srcBuffer->isDetachedBuffer());
-    size_t byteLength = srcBuffer->byteLength();
-
-    own wasm_byte_vec_t binary;
-    wasm_byte_vec_new_uninitialized(&binary, byteLength);
-    memcpy(binary.data, srcBuffer->data(), byteLength);
 
-    own wasm_module_t* module = wasm_module_new(ThreadLocal::wasmStore(), &binary);
-    wasm_byte_vec_delete(&binary);
+    // source is a private copy made by copyStableBufferBytes which is never exposed to JavaScript
+    // so its bytes are passed to the compiler directly without another copy
+    wasm_byte_vec_t binary = { srcBuffer->byteLength(), reinterpret_cast<wasm_byte_t*>(srcBuffer->data()) };
+    own wasm_module_t* module = newModuleWithCache(state, &binary);
 
     if (!module) {
         // throw WebAssembly.CompileError
@@ -254,9 +313,148 @@ Value WASMOperations::compileModule(ExecutionState& state, Value thisValue, size
     return new WASMModuleObject(state, proto, module);
 }
 
+#if defined(ENABLE_THREADING)
+// compiles a module on another thread which has its own engine and store
+// compiled module is moved into the store of VMInstance thread through wasm_module_share/obtain
+class WASMAsyncCompileJob : public JobFromAnotherThread {
+public:
+    WASMAsyncCompileJob(Context* relatedContext, PromiseReaction::Capability capability, ArrayBufferObject* source)
+        : JobFromAnotherThread(relatedContext)
+        , m_capability(capability)
+        , m_data(new CompileData())
+    {
+        // bytes are copied before dispatch because the buffer may be backed by memory of the embedder
+        // another thread reads only this copy
+        m_data->bytes.assign(source->data(), source->data() + source->byteLength());
+        m_data->binary.size = m_data->bytes.size();
+        m_data->binary.data = reinterpret_cast<wasm_byte_t*>(m_data->bytes.data());
+    }
+
+    void start()
+    {
+        std::shared_ptr<JobFromAnotherThreadTicket> ticket = relatedContext()->vmInstance()->enqueueJobFromAnotherThread(this);
+        m_data->thread = std::thread(compile, m_data, ticket);
+    }
+
+    virtual SandBox::SandBoxResult run() override
+    {
+        m_data->thread.join();
+        own wasm_module_t* module = nullptr;
+        if (m_data->sharedModule) {
+            module = wasm_module_obtain(ThreadLocal::wasmStore(), m_data->sharedModule);
+        }
+#if defined(ENABLE_CODE_CACHE)
+        // CodeCache is used only on the thread of VMInstance
+        if (module && shouldUseModuleCache(relatedContext(), &m_data->binary)) {
+            storeModuleToCache(relatedContext(), &m_data->binary, module);
+        }
+#endif
+        releaseData();
+
+        struct RunData {
+            WASMAsyncCompileJob* job;
+            wasm_module_t* module;
+        } runData = { this, module };
+
+        SandBox sandbox(relatedContext());
+        return sandbox.run([](ExecutionState& state, void* data) -> Value {
+            RunData* runData = reinterpret_cast<RunData*>(data);
+            const PromiseReaction::Capability& capability = runData->job->m_capability;
+            if (!runData->module) {
+                // reject with WebAssembly.CompileError
+                Value error = ErrorObject::createBuiltinError(state, ErrorCode::WASMCompileError, ErrorObject::Messages::WASM_CompileError);
+                return Object::call(state, capability.m_rejectFunction, Value(), 1, &error);
+            }
+
+            Value moduleObject = new WASMModuleObject(state, state.context()->globalObject()->wasmModulePrototype(), runData->module);
+            return Object::call(state, capability.m_resolveFunction, Value(), 1, &moduleObject);
+        },
+                           &runData);
+    }
+
+    virtual void cancel() override
+    {
+        // the ticket is canceled already, so the compile finishes without marking it ready
+        m_data->thread.join();
+        releaseData();
+    }
+
+private:
+    struct CompileData {
+        CompileData()
+            : engine(nullptr)
+            , store(nullptr)
+            , sharedModule(nullptr)
+        {
+        }
+
+        std::vector<uint8_t> bytes;
+        wasm_byte_vec_t binary;
+        own wasm_engine_t* engine;
+        own wasm_store_t* store;
+        own wasm_shared_module_t* sharedModule;
+        std::thread thread;
+    };
+
+    // runs on another thread. only plain data is accessed here
+    static void compile(CompileData* data, std::shared_ptr<JobFromAnotherThreadTicket> ticket)
+    {
+        data->engine = wasm_engine_new();
+        data->store = wasm_store_new(data->engine);
+        if (!ticket->isCanceled()) {
+            own wasm_module_t* module = wasm_module_new(data->store, &data->binary);
+            if (module) {
+                data->sharedModule = wasm_module_share(module);
+                wasm_module_delete(module);
+            }
+        }
+
+        ticket->markReady();
+    }
+
+    void releaseData()
+    {
+        if (m_data->sharedModule) {
+            wasm_shared_module_delete(m_data->sharedModule);
+        }
+        wasm_store_delete(m_data->store);
+        wasm_engine_delete(m_data->engine);
+        delete m_data;
+        m_data = nullptr;
+    }
+
+    PromiseReaction::Capability m_capability;
+    CompileData* m_data;
+};
+#endif
+
 Object* WASMOperations::asyncCompileModule(ExecutionState& state, Value source)
 {
     PromiseReaction::Capability capability = PromiseObject::newPromiseCapability(state, state.context()->globalObject()->promise());
+
+#if defined(ENABLE_THREADING)
+    // large module is compiled on another thread not to block the event loop
+    if (source.isObject() && source.asObject()->isArrayBufferObject() && source.asObject()->asArrayBufferObject()->byteLength() >= WASM_ASYNC_COMPILE_THREAD_MIN_SIZE) {
+        ArrayBufferObject* srcBuffer = source.asObject()->asArrayBufferObject();
+#if defined(ENABLE_CODE_CACHE)
+        // cached module is loaded here without another thread
+        wasm_byte_vec_t binary = { srcBuffer->byteLength(), reinterpret_cast<wasm_byte_t*>(srcBuffer->data()) };
+        if (shouldUseModuleCache(state.context(), &binary)) {
+            own wasm_module_t* module = loadModuleFromCache(state.context(), &binary);
+            if (module) {
+                Value moduleObject = new WASMModuleObject(state, state.context()->globalObject()->wasmModulePrototype(), module);
+                // handler 1 means "Identity", see PromiseReactionJob::run
+                state.context()->vmInstance()->enqueueJob(new PromiseReactionJob(state.context(), PromiseReaction((Object*)1, capability), moduleObject));
+                return capability.m_promise;
+            }
+        }
+#endif
+        WASMAsyncCompileJob* job = new WASMAsyncCompileJob(state.context(), capability, srcBuffer);
+        job->start();
+        return capability.m_promise;
+    }
+#endif
+
     NativeFunctionObject* asyncCompiler = new NativeFunctionObject(state, NativeFunctionInfo(AtomicString(), WASMOperations::compileModule, 1, NativeFunctionInfo::Strict));
     Job* job = new PromiseReactionJob(state.context(), PromiseReaction(asyncCompiler, capability), source);
     state.context()->vmInstance()->enqueueJob(job);
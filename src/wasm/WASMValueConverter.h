@@ -30,6 +30,44 @@ public:
     static Value toJSValue(ExecutionState& state, const wasm_val_t& value);
     static wasm_valkind_t toValueType(ExecutionState& state, const Value& desc);
     static wasm_val_t toWebAssemblyValue(ExecutionState& state, const Value& value, wasm_valkind_t type);
+
+    // conversions of i32, f32 and f64 values used for calls between JavaScript and WebAssembly
+    // a Value keeps a double unboxed on every target, so numbers are converted without allocation
+    // (heap boxes of 32bit builds are made only when the Value is stored into an EncodedValue slot)
+    // non-number Value falls back to toWebAssemblyValue which may call user code through ToNumber
+    static bool isNumericValueType(wasm_valkind_t type)
+    {
+        return type == WASM_I32 || type == WASM_F32 || type == WASM_F64;
+    }
+
+    static ALWAYS_INLINE Value numericToJSValue(const wasm_val_t& value)
+    {
+        ASSERT(isNumericValueType(value.kind));
+        if (value.kind == WASM_I32) {
+            return Value(value.of.i32);
+        }
+        return Value(Value::DoubleToIntConvertibleTestNeeds, (value.kind == WASM_F32) ? (double)value.of.f32 : value.of.f64);
+    }
+
+    static ALWAYS_INLINE wasm_val_t toWebAssemblyNumericValue(ExecutionState& state, const Value& value, wasm_valkind_t type)
+    {
+        ASSERT(isNumericValueType(type));
+        wasm_val_t result;
+        if (type == WASM_I32 && LIKELY(value.isInt32())) {
+            result.kind = WASM_I32;
+            result.of.i32 = value.asInt32();
+            return result;
+        } else if (type == WASM_F64 && LIKELY(value.isNumber())) {
+            result.kind = WASM_F64;
+            result.of.f64 = value.asNumber();
+            return result;
+        } else if (type == WASM_F32 && LIKELY(value.isNumber())) {
+            result.kind = WASM_F32;
+            result.of.f32 = (float)value.asNumber();
+            return result;
+        }
+        return toWebAssemblyValue(state, value, type);
+    }
 };
 } // namespace Escargot
 #endif // __EscargotWASMValueConverter__
@@ -24,6 +24,8 @@ using namespace Escargot;
 #include "gtest/gtest.h"
 
 #include <vector>
+#include <atomic>
+#include <stdlib.h>
 
 static bool stringEndsWith(const std::string& str, const std::string& suffix)
 {
@@ -326,6 +328,11 @@ public:
 PersistentRefHolder<VMInstanceRef> g_instance;
 PersistentRefHolder<ContextRef> g_context;
 
+static std::string evalTestScript(const std::string& source)
+{
+    return evalScript(g_context.get(), StringRef::createFromASCII(source.data(), source.length()), StringRef::createFromASCII("test.js"), false);
+}
+
 ValueRef* builtinPrint(ExecutionStateRef* state, ValueRef* thisValue, size_t argc, ValueRef** argv, bool isConstructCall)
 {
     if (argc >= 1) {
@@ -589,6 +596,797 @@ TEST(EvalScript, RuntimeError)
     EXPECT_TRUE(s.find("Uncaught 1") == 0);
 }
 
+TEST(EvalScript, MegamorphicPropertyAccess)
+{
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function getType(node) { return node.type; }
+    var proto = { type: 'proto' };
+    var nodes = [];
+    for (var i = 0; i < 64; i++) {
+        var node = Object.create(proto);
+        node['p' + i] = i;
+        nodes.push(node);
+    }
+    for (var j = 0; j < 4; j++) {
+        for (var i = 0; i < nodes.length; i++) {
+            getType(nodes[i]);
+        }
+    }
+    proto.type = 'changed';
+    var result = getType(nodes[3]);
+    Object.setPrototypeOf(nodes[3], { extra: 1, type: 'other' });
+    result += ',' + getType(nodes[3]);
+    nodes[4].type = 'own';
+    result += ',' + getType(nodes[4]);
+    result;
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "changed,other,own");
+}
+
+TEST(EvalScript, InlinedCall)
+{
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function inlinedAdd(a, b) { return a + b; }
+    function inlinedFirst(a) { return a; }
+    var point = { _x: 1, getX() { return this._x; } };
+    function run(p) {
+        var r = 0;
+        for (var i = 0; i < 32; i++) {
+            r = inlinedFirst(inlinedAdd(r, i));
+            p._x = i;
+            r += p.getX();
+        }
+        return r;
+    }
+    function getX(p) {
+        return p.getX();
+    }
+    var result = run(point) + ',' + inlinedAdd('a', 1) + ',' + inlinedFirst();
+    var proxy = new Proxy(point, { get(target, name) { return name === '_x' ? 'proxy' : target[name]; } });
+    var accessor = Object.create(point);
+    Object.defineProperty(accessor, '_x', { get() { return 'accessor'; } });
+    for (var i = 0; i < 16; i++) {
+        getX(point);
+    }
+    result += ',' + getX(proxy) + ',' + getX(accessor) + ',' + getX(point);
+    result;
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "992,a1,undefined,proxy,accessor,31");
+}
+
+TEST(EvalScript, NumberToString)
+{
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var values = [0, -0, 7, -42, 2147483647, -2147483648, 9007199254740991, 1e21, 123456789012345680000, 0.1, -1.5, 1e-6, 1e-7, 5e-324, 1.7976931348623157e308, 1 / 3];
+    var result = values.map(function(v) { return '' + v; }).join(',');
+    // same numbers twice go through the number to string cache
+    var cached = true;
+    for (var i = 0; i < 1000; i++) {
+        cached = cached && ('' + (i * 1.5)) === String(i * 1.5);
+    }
+    result += ',' + cached;
+    result;
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "0,0,7,-42,2147483647,-2147483648,9007199254740991,1e+21,123456789012345680000,0.1,-1.5,0.000001,1e-7,5e-324,1.7976931348623157e+308,0.3333333333333333,true");
+}
+
+TEST(EvalScript, StringSearchAndConversion)
+{
+    evalTestScript(R"(
+    var searchText = 'abcdefgh'.repeat(64) + 'needle-in-haystack' + 'abcdefgh'.repeat(8);
+    var searchWideText = searchText + '\uAC00';
+    )");
+    EXPECT_EQ(evalTestScript("searchText.indexOf('needle-in-haystack')"), "512");
+    EXPECT_EQ(evalTestScript("searchWideText.indexOf('needle-in-haystack')"), "512");
+    EXPECT_EQ(evalTestScript("searchText.lastIndexOf('abcdefgh')"), "586");
+    EXPECT_EQ(evalTestScript("searchText.lastIndexOf('abcdefgh', 10)"), "8");
+    EXPECT_EQ(evalTestScript(R"(searchWideText.indexOf('\uAC00'))"), "594");
+    EXPECT_EQ(evalTestScript("searchText.includes('haystackX')"), "false");
+
+    EXPECT_EQ(evalTestScript(R"(escape('Hello World \xe9\xdf'.toUpperCase()))"), "HELLO%20WORLD%20%C9SS");
+    EXPECT_EQ(evalTestScript(R"(escape('MiXeD CaSe \xc9'.toLowerCase()))"), "mixed%20case%20%E9");
+    EXPECT_EQ(evalTestScript("JSON.stringify('plain text')"), "\"plain text\"");
+    EXPECT_EQ(evalTestScript(R"(escape(JSON.stringify('quote " back \\ tab \t \u0001 \uAC00')))"), "%22quote%20%5C%22%20back%20%5C%5C%20tab%20%5Ct%20%5Cu0001%20%uAC00%22");
+    EXPECT_EQ(evalTestScript("'abc' < 'abd'"), "true");
+    EXPECT_EQ(evalTestScript(R"('\uAC00a' > '\uAC00')"), "true");
+}
+
+static bool subStringCompactionTokenInRange(ExecutionStateRef* state, const char* bodyStart, const char* bodyEnd)
+{
+    ObjectRef* global = state->context()->globalObject();
+    ArrayObjectRef* tokens = global->get(state, StringRef::createFromASCII("subStringCompactionTokens"))->asArrayObject();
+
+    bool result = false;
+    for (uint32_t i = 0; i < 2; i++) {
+        auto token = tokens->get(state, ValueRef::create(i))->asString()->stringBufferAccessData();
+        const char* tokenStart = (const char*)token.buffer;
+        if (tokenStart >= bodyStart && tokenStart < bodyEnd) {
+            result = true;
+        }
+    }
+    return result;
+}
+
+static const char* s_subStringCompactionBodyStart;
+static const char* s_subStringCompactionBodyEnd;
+
+static void subStringCompactionRecordBody(ExecutionStateRef* state)
+{
+    auto body = state->context()->globalObject()->get(state, StringRef::createFromASCII("subStringCompactionBody"))->asString()->stringBufferAccessData();
+    s_subStringCompactionBodyStart = (const char*)body.buffer;
+    s_subStringCompactionBodyEnd = s_subStringCompactionBodyStart + body.length * (body.has8BitContent ? 1 : 2);
+}
+
+TEST(Memory, SubStringCompaction)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var subStringCompactionBody = 'x'.repeat(1024 * 256) + 'token-0123456789-abcdefghijklmnopqrstuvwxyz';
+    var subStringCompactionTokens = [subStringCompactionBody.substring(1024 * 256, subStringCompactionBody.length), subStringCompactionBody.substring(10, 100)];
+    )"),
+               StringRef::createFromASCII("test.js"), false);
+
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        subStringCompactionRecordBody(state);
+        EXPECT_TRUE(subStringCompactionTokenInRange(state, s_subStringCompactionBodyStart, s_subStringCompactionBodyEnd));
+        return ValueRef::createUndefined();
+    });
+
+    // the body is still referred from the global object, so its sub strings are not copied
+    Memory::gc();
+    Memory::gc();
+
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        subStringCompactionRecordBody(state);
+        EXPECT_TRUE(subStringCompactionTokenInRange(state, s_subStringCompactionBodyStart, s_subStringCompactionBodyEnd));
+        return ValueRef::createUndefined();
+    });
+    EXPECT_TRUE(Memory::subStringRetainedSize() >= 1024 * 256);
+    EXPECT_TRUE(Memory::subStringUsedSize() >= 90);
+
+    // once the body is dropped, its sub strings are copied out and the body can be freed
+    evalScript(g_context.get(), StringRef::createFromASCII("subStringCompactionBody = undefined"), StringRef::createFromASCII("test.js"), false);
+    Memory::gc();
+    Memory::gc();
+
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        EXPECT_FALSE(subStringCompactionTokenInRange(state, s_subStringCompactionBodyStart, s_subStringCompactionBodyEnd));
+        return ValueRef::createUndefined();
+    });
+
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII("subStringCompactionTokens[0] + ',' + subStringCompactionTokens[1].length"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "token-0123456789-abcdefghijklmnopqrstuvwxyz,90");
+    evalScript(g_context.get(), StringRef::createFromASCII("subStringCompactionTokens = undefined"), StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(EvalScript, RegExpCompiledMatcher)
+{
+    EXPECT_EQ(evalTestScript(R"(JSON.stringify(/(\d+)-(\d+)/.exec('tel 010-1234')))"), "[\"010-1234\",\"010\",\"1234\"]");
+    EXPECT_EQ(evalTestScript(R"(JSON.stringify(/^(?:a|ab)(c|bcd)(d*)$/.exec('abcd')))"), "[\"abcd\",\"bcd\",\"\"]");
+    EXPECT_EQ(evalTestScript(R"(JSON.stringify(/(a+?)(b*)/i.exec('xAAbB')))"), "[\"A\",\"A\",\"\"]");
+    EXPECT_EQ(evalTestScript(R"(/\bfoo\b/m.test('a\nfoo bar'))"), "true");
+    EXPECT_EQ(evalTestScript(R"(/^b/m.exec('a\nb').index)"), "2");
+    EXPECT_EQ(evalTestScript(R"(JSON.stringify(/(z)((a+)?(b+)?(c))*/.exec('zaacbbbcac')))"), "[\"zaacbbbcac\",\"z\",\"ac\",\"a\",null,\"c\"]");
+    EXPECT_EQ(evalTestScript(R"(JSON.stringify(/[^x]{2,3}y/.exec('xxabcy')))"), "[\"abcy\"]");
+    EXPECT_EQ(evalTestScript(R"('a1b22c333'.replace(/\d+/g, '#'))"), "a#b#c#");
+    EXPECT_EQ(evalTestScript(R"(/y\xe9/i.test('Y\xc9'))"), "true");
+    EXPECT_EQ(evalTestScript(R"(/\uAC00+/.exec('a\uAC00\uAC00b')[0].length)"), "2");
+
+    // these are not supported by the compiled matcher or need a long backtracking stack
+    EXPECT_EQ(evalTestScript(R"(JSON.stringify(/(\w)\1/.exec('abcdd')))"), "[\"dd\",\"d\"]");
+    EXPECT_EQ(evalTestScript(R"(JSON.stringify(/(?=b)\w/.exec('abc')))"), "[\"b\"]");
+    EXPECT_EQ(evalTestScript(R"(/(a|b)*c/.exec('ab'.repeat(5000) + 'c')[1])"), "b");
+}
+
+// compareRegExpBackends is defined only in ESCARGOT_TEST builds, which always build the compiled matcher
+TEST(EvalScript, RegExpCompiledMatcherDifferential)
+{
+    if (evalTestScript("typeof compareRegExpBackends") != "function") {
+        return;
+    }
+
+    EXPECT_EQ(evalTestScript(R"(compareRegExpBackends(/^(?:a|ab)(c|bcd)(d*)$/, 'abcd'))"), "same");
+    EXPECT_EQ(evalTestScript(R"(compareRegExpBackends(/(z)((a+)?(b+)?(c))*/, 'zaacbbbcac'))"), "same");
+    EXPECT_EQ(evalTestScript(R"(compareRegExpBackends(/(a){2,3}?(a)/, 'aaaa'))"), "same");
+    EXPECT_EQ(evalTestScript(R"(compareRegExpBackends(/(\w)\1/, 'abcdd'))"), "unsupported");
+
+    evalTestScript(R"(
+    var differentialSeed = 7;
+    function differentialRandom(n) {
+        differentialSeed = (differentialSeed * 1103515245 + 12345) & 0x7fffffff;
+        return differentialSeed % n;
+    }
+    var differentialAtoms = ['a', 'b', '.', '[ab]', '[^a]', '\\w', '\\s', 'A', '\u00e9', '\uac00'];
+    var differentialQuantifiers = ['', '', '*', '+', '?', '*?', '+?', '??', '{2}', '{1,3}', '{0,2}?'];
+    function differentialTerm(depth) {
+        var kind = differentialRandom(depth > 2 ? 3 : 6);
+        var term;
+        if (kind < 3) {
+            term = differentialAtoms[differentialRandom(differentialAtoms.length)];
+        } else if (kind == 3) {
+            term = '(' + differentialDisjunction(depth + 1) + ')';
+        } else if (kind == 4) {
+            term = '(?:' + differentialDisjunction(depth + 1) + ')';
+        } else {
+            return ['^', '$', '\\b', '\\B'][differentialRandom(4)];
+        }
+        return term + differentialQuantifiers[differentialRandom(differentialQuantifiers.length)];
+    }
+    function differentialDisjunction(depth) {
+        var source = '';
+        do {
+            source += source.length ? '|' : '';
+            for (var i = 1 + differentialRandom(3); i > 0; i--) {
+                source += differentialTerm(depth);
+            }
+        } while (differentialRandom(3) == 0);
+        return source;
+    }
+    var differentialInputs = ['', 'a', 'ab', 'aab', 'abab\nba', 'b a\nAb', 'xxaabbab', 'aaaaaaaaaaaaaaaaaaaab', '\u00e9A\u00c9a', 'a\uac00b\uac00\uac00'];
+    var differentialMismatches = [];
+    var differentialSameCount = 0;
+    for (var i = 0; i < 1500; i++) {
+        var re = new RegExp(differentialDisjunction(0), ['', 'i', 'm', 'y', 'im'][differentialRandom(5)]);
+        for (var j = 0; j < differentialInputs.length; j++) {
+            var input = differentialInputs[j];
+            for (var start = 0; start <= input.length; start += 3) {
+                var result = compareRegExpBackends(re, input, start);
+                if (result == 'same') {
+                    differentialSameCount++;
+                } else if (result != 'unsupported' && result != 'fallback') {
+                    differentialMismatches.push(re + ' ' + JSON.stringify(input) + ' ' + start + ' ' + result);
+                }
+            }
+        }
+    }
+    )");
+    EXPECT_EQ(evalTestScript("differentialMismatches.slice(0, 5).join('\\n')"), "");
+    EXPECT_EQ(evalTestScript("differentialSameCount > 10000"), "true");
+}
+
+TEST(EvalScript, RegExpCompiledMatcherBudget)
+{
+    if (evalTestScript("typeof compareRegExpBackends") != "function") {
+        return;
+    }
+
+    // the matcher keeps its backtracking entries on the heap, so a long loop does not need native stack
+    EXPECT_EQ(evalTestScript(R"(compareRegExpBackends(/(a|b)*c/, 'ab'.repeat(5000) + 'c'))"), "same");
+    // every start position has its own step budget
+    // this costs more than the budget in total but not at any single position
+    EXPECT_EQ(evalTestScript(R"(compareRegExpBackends(/(a+)+b/, ('a'.repeat(12) + 'x').repeat(100)))"), "same");
+    // a single position which costs too much is left to the interpreter
+    EXPECT_EQ(evalTestScript(R"(compareRegExpBackends(/(?:a+a+)+b/, 'a'.repeat(40)))"), "fallback");
+}
+
+TEST(EvalScript, RegExpPrefilter)
+{
+    evalTestScript(R"(
+    var prefilterLog = 'INFO: 1\nERROR: 42\nINFO: 2\nERROR: 7\n';
+    )");
+    EXPECT_EQ(evalTestScript(R"(prefilterLog.match(/ERROR: (\d+)/g).join())"), "ERROR: 42,ERROR: 7");
+    EXPECT_EQ(evalTestScript(R"(/ERROR: (\d+)/.exec(prefilterLog)[1])"), "42");
+    EXPECT_EQ(evalTestScript(R"(/^INFO/.exec(prefilterLog).index)"), "0");
+    EXPECT_EQ(evalTestScript(R"(/^ERROR/.test(prefilterLog))"), "false");
+    EXPECT_EQ(evalTestScript(R"(/^ERROR: (\d+)$/m.exec(prefilterLog)[1])"), "42");
+    EXPECT_EQ(evalTestScript(R"(/.*ERROR.*$/m.exec(prefilterLog)[0])"), "ERROR: 42");
+
+    EXPECT_EQ(evalTestScript(R"(/(?:ERR|WARN)OR/.exec('a WARNOR b').index)"), "2");
+    EXPECT_EQ(evalTestScript(R"(/e+x/i.exec('aaEex').index)"), "2");
+    EXPECT_EQ(evalTestScript(R"(/[0-9]z|q/.exec('a1b2zq').index)"), "3");
+    EXPECT_EQ(evalTestScript(R"(/\uAC00\uAC01/.exec('xx\uAC00\uAC01').index)"), "2");
+    EXPECT_EQ(evalTestScript(R"(/\u{1F600}a/u.exec('b\u{1F600}a').index)"), "1");
+    EXPECT_EQ(evalTestScript(R"(/foo/y.test('afoo'))"), "false");
+    EXPECT_EQ(evalTestScript(R"(/\bfoo\b/.exec('foofoo foo').index)"), "7");
+    EXPECT_EQ(evalTestScript(R"(/x*y/.exec('aaay').index)"), "3");
+
+    evalTestScript(R"(
+    var prefilterSticky = /ERROR/y;
+    prefilterSticky.lastIndex = 8;
+    )");
+    EXPECT_EQ(evalTestScript("prefilterSticky.test(prefilterLog)"), "true");
+    EXPECT_EQ(evalTestScript("prefilterSticky.lastIndex"), "13");
+}
+
+TEST(EvalScript, RegExpMatchFastPaths)
+{
+    EXPECT_EQ(evalTestScript(R"('a1b22c333'.replace(/\d+/g, '<$&>'))"), "a<1>b<22>c<333>");
+    EXPECT_EQ(evalTestScript(R"('John Smith'.replace(/(\w+)\s(\w+)/, '$2, $1'))"), "Smith, John");
+    EXPECT_EQ(evalTestScript("'aaa'.replace(/x*/g, '-')"), "-a-a-a-");
+    EXPECT_EQ(evalTestScript("'abc'.replace(/(?=b)/g, '|')"), "a|bc");
+
+    EXPECT_EQ(evalTestScript("'a,b,,c'.split(/(,)/).join('/')"), "a/,/b/,//,/c");
+    EXPECT_EQ(evalTestScript("'abc'.split(/(?:)/).join('/')"), "a/b/c");
+    EXPECT_EQ(evalTestScript(R"('a1b2c3'.split(/\d/, 2).join('/'))"), "a/b");
+
+    EXPECT_EQ(evalTestScript(R"(
+    /(a)(b)?/.test('xacy');
+    JSON.stringify([RegExp.$1, RegExp.$2, RegExp.lastParen, RegExp.leftContext, RegExp.rightContext, RegExp.lastMatch]);
+    )"),
+              "[\"a\",\"\",\"\",\"x\",\"cy\",\"a\"]");
+    EXPECT_EQ(evalTestScript(R"(
+    /(a)b/.exec('xaby');
+    RegExp.rightContext + RegExp.lastParen;
+    )"),
+              "ya");
+
+    EXPECT_EQ(evalTestScript(R"(
+    var fastPathGlobal = /b/g;
+    fastPathGlobal.lastIndex = 3;
+    'abcb'.replace(fastPathGlobal, 'x');
+    fastPathGlobal.lastIndex;
+    )"),
+              "0");
+    EXPECT_EQ(evalTestScript(R"([...'a1b2'.matchAll(/\d/g)].map(m => m[0] + m.index).join())"), "11,23");
+    EXPECT_EQ(evalTestScript("[...'ab'.matchAll(/(?:)/g)].length"), "3");
+}
+
+TEST(EvalScript, RegExpCache)
+{
+    EXPECT_EQ(evalTestScript(R"(/a.b/s.test('a\nb'))"), "true");
+    EXPECT_EQ(evalTestScript(R"(/a.b/.test('a\nb'))"), "false");
+    EXPECT_EQ(evalTestScript("/foo/y.test('afoo')"), "false");
+    EXPECT_EQ(evalTestScript("/foo/.test('afoo')"), "true");
+    EXPECT_EQ(evalTestScript(R"(new RegExp('\\u{61}', 'u').test('a'))"), "true");
+
+    // more distinct sources than the cache keeps, twice
+    EXPECT_EQ(evalTestScript(R"(
+    var regExpCacheCount = 0;
+    for (var round = 0; round < 2; round++) {
+        for (var i = 0; i < 300; i++) {
+            if (new RegExp('^v' + i + '(\\d+)$').test('v' + i + '42')) {
+                regExpCacheCount++;
+            }
+        }
+    }
+    regExpCacheCount;
+    )"),
+              "600");
+}
+
+TEST(VMInstance, RegExpCacheStatistics)
+{
+    g_instance->evictRegExpCache(0);
+    auto empty = g_instance->regexpCacheStatistics();
+    EXPECT_EQ(empty.entryCount, 0u);
+    EXPECT_EQ(empty.byteSize, 0u);
+
+    // each pattern is inserted on compile and charged again when its bytecode is attached on first match
+    const char* script = R"(
+    var regExpCacheStatisticsCount = 0;
+    for (var i = 0; i < 10; i++) {
+        if (new RegExp('^s' + i + '[a-z]+(\\d)$', 'i').test('S' + i + 'abc7')) {
+            regExpCacheStatisticsCount++;
+        }
+    }
+    regExpCacheStatisticsCount;
+    )";
+    EXPECT_EQ(evalTestScript(script), "10");
+    auto compiled = g_instance->regexpCacheStatistics();
+    EXPECT_TRUE(compiled.entryCount >= 10);
+    EXPECT_TRUE(compiled.byteSize > 0);
+    EXPECT_TRUE(compiled.missCount >= empty.missCount + 10);
+
+    // same sources are found in the cache
+    EXPECT_EQ(evalTestScript(script), "10");
+    auto reused = g_instance->regexpCacheStatistics();
+    EXPECT_TRUE(reused.hitCount >= compiled.hitCount + 10);
+
+    // evicting every entry subtracts exactly what was charged
+    g_instance->evictRegExpCache(0);
+    auto evicted = g_instance->regexpCacheStatistics();
+    EXPECT_EQ(evicted.entryCount, 0u);
+    EXPECT_EQ(evicted.byteSize, 0u);
+}
+
+TEST(EvalScript, ArrayFastModeBuiltins)
+{
+    evalTestScript(R"(
+    var fastArray = [1, 2, 3];
+    fastArray.push(4, 5);
+    )");
+    EXPECT_EQ(evalTestScript("fastArray.pop()"), "5");
+    EXPECT_EQ(evalTestScript("fastArray.shift()"), "1");
+    EXPECT_EQ(evalTestScript("fastArray.unshift(0, 1)"), "5");
+    EXPECT_EQ(evalTestScript("fastArray.join()"), "0,1,2,3,4");
+
+    evalTestScript("var fastSpliced = [1, 2, 3, 4, 5, 6];");
+    EXPECT_EQ(evalTestScript("fastSpliced.splice(1, 2, 'x', 'y', 'z').join()"), "2,3");
+    EXPECT_EQ(evalTestScript("fastSpliced.join()"), "1,x,y,z,4,5,6");
+    EXPECT_EQ(evalTestScript("fastSpliced.splice(2, 3).join()"), "y,z,4");
+    EXPECT_EQ(evalTestScript("fastSpliced.join()"), "1,x,5,6");
+
+    EXPECT_EQ(evalTestScript("[1, 2, 3, 4].slice(1, 3).join()"), "2,3");
+    EXPECT_EQ(evalTestScript("[1, 2].concat([3, 4], 5, [6]).join()"), "1,2,3,4,5,6");
+
+    // callback shrinks the array while iterating
+    EXPECT_EQ(evalTestScript(R"(
+    var fastShrunk = [1, 2, 3, 4];
+    var fastShrunkSeen = [];
+    fastShrunk.forEach(function(v, i) { fastShrunkSeen.push(v); if (i == 0) { fastShrunk.length = 2; } });
+    fastShrunkSeen.join();
+    )"),
+              "1,2");
+
+    // holes must not be treated as undefined elements
+    evalTestScript("var fastHoley = [1, , 3];");
+    EXPECT_EQ(evalTestScript("fastHoley.map(function(v) { return v; }).length"), "3");
+    EXPECT_EQ(evalTestScript("fastHoley.indexOf(undefined)"), "-1");
+    EXPECT_EQ(evalTestScript("fastHoley.includes(undefined)"), "true");
+    EXPECT_EQ(evalTestScript("1 in fastHoley.slice()"), "false");
+    EXPECT_EQ(evalTestScript("1 in fastHoley.concat([])"), "false");
+    EXPECT_EQ(evalTestScript("fastHoley.shift()"), "1");
+    EXPECT_EQ(evalTestScript("0 in fastHoley"), "false");
+
+    // callback writes to the array while iterating
+    evalTestScript("var fastWritten = [1, 2, 3];");
+    EXPECT_EQ(evalTestScript("fastWritten.filter(function(v) { fastWritten[2] = 9; return v > 1; }).join()"), "2,9");
+    EXPECT_EQ(evalTestScript("fastWritten.reduce(function(x, y) { return x + y; })"), "12");
+    EXPECT_EQ(evalTestScript("fastWritten.find(function(v) { return v > 1; })"), "2");
+    EXPECT_EQ(evalTestScript("fastWritten.some(function(v) { return v == 9; })"), "true");
+    EXPECT_EQ(evalTestScript("fastWritten.every(function(v) { return v < 9; })"), "false");
+
+    evalTestScript(R"(
+    var fastDoubles = [1.5, 2.5, 3.5];
+    var fastDoublesCopy = fastDoubles.slice();
+    fastDoubles[0] = 9.5;
+    fastDoubles.unshift(0.5);
+    fastDoubles.splice(1, 1, 4.5);
+    )");
+    EXPECT_EQ(evalTestScript("fastDoubles.join()"), "0.5,4.5,2.5,3.5");
+    EXPECT_EQ(evalTestScript("fastDoublesCopy.join()"), "1.5,2.5,3.5");
+}
+
+TEST(EvalScript, ArrayDoubleElements)
+{
+    evalTestScript(R"(
+    var doubleArray = [];
+    for (var i = 0; i < 10; i++) { doubleArray.push(i * 0.5); }
+    doubleArray[12] = 1.25;
+    )");
+    EXPECT_EQ(evalTestScript("doubleArray.length"), "13");
+    EXPECT_EQ(evalTestScript("doubleArray[3]"), "1.5");
+    EXPECT_EQ(evalTestScript("doubleArray[11]"), "undefined");
+    EXPECT_EQ(evalTestScript("11 in doubleArray"), "false");
+    EXPECT_EQ(evalTestScript("doubleArray.indexOf(1.25)"), "12");
+
+    EXPECT_EQ(evalTestScript("delete doubleArray[0]; 0 in doubleArray"), "false");
+    EXPECT_EQ(evalTestScript("doubleArray.pop()"), "1.25");
+    EXPECT_EQ(evalTestScript("doubleArray.shift()"), "undefined");
+    EXPECT_EQ(evalTestScript("doubleArray.length"), "11");
+
+    EXPECT_EQ(evalTestScript(R"(
+    doubleArray.unshift(-1.5, 2);
+    doubleArray.sort(function(x, y) { return y - x; });
+    doubleArray.slice(0, 4).join();
+    )"),
+              "4.5,4,3.5,3");
+    EXPECT_EQ(evalTestScript("doubleArray[1] = NaN; isNaN(doubleArray[1])"), "true");
+    EXPECT_EQ(evalTestScript("doubleArray.includes(NaN)"), "true");
+    EXPECT_EQ(evalTestScript("doubleArray.length = 3; doubleArray.join()"), "4.5,NaN,3.5");
+
+    // storing a non-number leaves double mode
+    EXPECT_EQ(evalTestScript("doubleArray[1] = 'str'; doubleArray.push(0.25); doubleArray.join()"), "4.5,str,3.5,0.25");
+    EXPECT_EQ(evalTestScript("typeof doubleArray[1]"), "string");
+
+    evalTestScript(R"(
+    var doubleHoley = [1, 2, 3];
+    doubleHoley[1] = 2.5;
+    doubleHoley[5] = 3.5;
+    Object.defineProperty(doubleHoley, 0, { value: 7.5 });
+    )");
+    EXPECT_EQ(evalTestScript("doubleHoley.join()"), "7.5,2.5,3,,,3.5");
+    EXPECT_EQ(evalTestScript("Object.keys(doubleHoley).join()"), "0,1,2,5");
+    EXPECT_EQ(evalTestScript("JSON.stringify(doubleHoley)"), "[7.5,2.5,3,null,null,3.5]");
+    EXPECT_EQ(evalTestScript("Object.freeze(doubleHoley); doubleHoley[2] = 9; doubleHoley[2]"), "3");
+
+    EXPECT_EQ(evalTestScript(R"(
+    var doubleKeys = [];
+    for (var k in [0.5, 1.5]) { doubleKeys.push(k); }
+    doubleKeys.join();
+    )"),
+              "0,1");
+
+    // property value switching between int and double
+    EXPECT_EQ(evalTestScript(R"(
+    var doubleProperty = { x: 0 };
+    var doublePropertyValues = [];
+    for (var j = 0; j < 4; j++) { doubleProperty.x = j % 2 ? j + 0.5 : j; doublePropertyValues.push(doubleProperty.x); }
+    doublePropertyValues.join();
+    )"),
+              "0,1.5,2,3.5");
+}
+
+TEST(EvalScript, BuiltinIteratorFastPath)
+{
+    EXPECT_EQ(evalTestScript(R"(
+    var iteratorSum = 0;
+    for (var v of [1, 2, 3]) { iteratorSum += v; }
+    iteratorSum;
+    )"),
+              "6");
+    EXPECT_EQ(evalTestScript(R"(
+    var iteratorTyped = '';
+    for (var v of new Uint8Array([4, 5])) { iteratorTyped += v; }
+    iteratorTyped;
+    )"),
+              "45");
+    EXPECT_EQ(evalTestScript(R"(
+    var iteratorMapEntries = [];
+    for (var [k, v] of new Map([[1, 'a'], [2, 'b']])) { iteratorMapEntries.push(k + v); }
+    iteratorMapEntries.join();
+    )"),
+              "1a,2b");
+    EXPECT_EQ(evalTestScript("[...new Set([3, 3, 4])].join()"), "3,4");
+    EXPECT_EQ(evalTestScript("[...'ab'].join('-')"), "a-b");
+    EXPECT_EQ(evalTestScript("var [iteratorFirst, , ...iteratorRest] = [7, 8, 9, 10]; iteratorFirst + ':' + iteratorRest.join()"), "7:9,10");
+
+    // elements pushed while iterating are visited
+    EXPECT_EQ(evalTestScript(R"(
+    var iteratorGrowing = [1, 2, 3];
+    var iteratorGrowingSeen = [];
+    for (var v of iteratorGrowing) { iteratorGrowingSeen.push(v); if (v == 1) iteratorGrowing.push(4); }
+    iteratorGrowingSeen.join();
+    )"),
+              "1,2,3,4");
+
+    // a patched %ArrayIteratorPrototype%.next disables the fast path
+    EXPECT_EQ(evalTestScript(R"(
+    var iteratorProto = Object.getPrototypeOf([][Symbol.iterator]());
+    var iteratorOrigNext = iteratorProto.next;
+    var iteratorNextCalls = 0;
+    iteratorProto.next = function () { iteratorNextCalls++; return iteratorOrigNext.call(this); };
+    var iteratorPatched = [];
+    try {
+        iteratorPatched.push([...[5, 6]].join() + ':' + iteratorNextCalls);
+        for (var v of [1]) { }
+        iteratorPatched.push(iteratorNextCalls);
+    } finally {
+        iteratorProto.next = iteratorOrigNext;
+    }
+    iteratorPatched.join('|');
+    )"),
+              "5,6:3|5");
+
+    evalTestScript(R"(
+    var iteratorClosed = 0;
+    var iteratorIterable = { [Symbol.iterator]() { var i = 0; return { next() { return { value: i++, done: i > 3 }; }, return() { iteratorClosed++; return {}; } }; } };
+    )");
+    EXPECT_EQ(evalTestScript("for (var v of iteratorIterable) { if (v == 1) break; } iteratorClosed"), "1");
+    EXPECT_EQ(evalTestScript("Array.from(iteratorIterable).join()"), "0,1,2");
+    EXPECT_EQ(evalTestScript("iteratorClosed"), "1");
+}
+
+TEST(EvalScript, ThrowInTryBlock)
+{
+    EXPECT_EQ(evalTestScript(R"(
+    var throwSum = 0;
+    for (var i = 0; i < 100; i++) {
+        try { throw i; } catch (e) { throwSum += e; }
+    }
+    throwSum;
+    )"),
+              "4950");
+
+    evalTestScript(R"(
+    var throwFinallyLog = [];
+    function throwInTry(x) {
+        try {
+            if (x) throw new TypeError('t' + x);
+            return 'ok';
+        } catch (e) {
+            return e.name + ':' + e.message + ':' + (typeof e.stack);
+        } finally {
+            throwFinallyLog.push('f' + x);
+        }
+    }
+    )");
+    EXPECT_EQ(evalTestScript("throwInTry(0)"), "ok");
+    EXPECT_EQ(evalTestScript("throwInTry(1)"), "TypeError:t1:string");
+    EXPECT_EQ(evalTestScript("throwFinallyLog.join()"), "f0,f1");
+
+    EXPECT_EQ(evalTestScript(R"(
+    var throwOuter = [];
+    try {
+        try { throw 'inner'; } finally { throwOuter.push('fin'); }
+    } catch (e) { throwOuter.push(e); }
+    throwOuter.join();
+    )"),
+              "fin,inner");
+    EXPECT_EQ(evalTestScript(R"(
+    var throwRethrown;
+    try {
+        try { throw 1; } catch (e) { throw e + 1; }
+    } catch (e) { throwRethrown = e; }
+    throwRethrown;
+    )"),
+              "2");
+    EXPECT_EQ(evalTestScript(R"(
+    var throwLoopLog = [];
+    for (var j = 0; j < 3; j++) {
+        try { if (j == 1) throw j; throwLoopLog.push('a' + j); } catch (e) { throwLoopLog.push('c' + e); continue; }
+        throwLoopLog.push('b' + j);
+    }
+    throwLoopLog.join();
+    )"),
+              "a0,b0,c1,a2,b2");
+    EXPECT_EQ(evalTestScript(R"(
+    function* throwInGenerator() { try { yield 1; throw 2; } catch (e) { yield e * 10; } }
+    [...throwInGenerator()].join();
+    )"),
+              "1,20");
+    // exceptions of callees, builtins and nested blocks still unwind with C++ exception
+    // and reach the same catch block as the pending ones
+    EXPECT_EQ(evalTestScript(R"(
+    var throwMixedLog = [];
+    function throwFromCallee(x) { throw 'callee' + x; }
+    for (var k = 0; k < 8; k++) {
+        try {
+            if (k % 4 == 0) throw 'direct' + k;
+            if (k % 4 == 1) throwFromCallee(k);
+            if (k % 4 == 2) null.x;
+            { let blockScoped = k; throw 'block' + blockScoped; }
+        } catch (e) { throwMixedLog.push(typeof e == 'string' ? e : e.name); }
+    }
+    throwMixedLog.join();
+    )"),
+              "direct0,callee1,TypeError,block3,direct4,callee5,TypeError,block7");
+}
+
+TEST(EvalScript, GeneratorResume)
+{
+    evalTestScript(R"(
+    var generatorLog = [];
+    function* generatorCount(n) { for (var i = 0; i < n; i++) { var r = yield i; if (r) generatorLog.push('r' + r); } return 'end'; }
+    var generatorCounter = generatorCount(3);
+    )");
+    EXPECT_EQ(evalTestScript("generatorCounter.next().value"), "0");
+    EXPECT_EQ(evalTestScript("generatorCounter.next('a').value"), "1");
+    EXPECT_EQ(evalTestScript("generatorLog.join()"), "ra");
+    EXPECT_EQ(evalTestScript("generatorCounter.next().value"), "2");
+    EXPECT_EQ(evalTestScript("JSON.stringify(generatorCounter.next())"), "{\"value\":\"end\",\"done\":true}");
+    EXPECT_EQ(evalTestScript("JSON.stringify(generatorCounter.next())"), "{\"done\":true}");
+    EXPECT_EQ(evalTestScript("var generatorSum = 0; for (var v of generatorCount(1000)) { generatorSum += v; } generatorSum"), "499500");
+
+    evalTestScript(R"(
+    function* generatorGuarded() {
+        yield 1;
+        try { yield 2; yield 3; } finally { generatorLog.push('cleanup'); }
+        { let x = 4; yield x; }
+    }
+    generatorLog = [];
+    var generatorReturned = generatorGuarded();
+    )");
+    EXPECT_EQ(evalTestScript("generatorReturned.next().value"), "1");
+    EXPECT_EQ(evalTestScript("generatorReturned.next().value"), "2");
+    EXPECT_EQ(evalTestScript("JSON.stringify(generatorReturned.return(9))"), "{\"value\":9,\"done\":true}");
+    EXPECT_EQ(evalTestScript("generatorLog.join()"), "cleanup");
+    EXPECT_EQ(evalTestScript("JSON.stringify(generatorReturned.next())"), "{\"done\":true}");
+
+    // return before entering the try block skips finally
+    EXPECT_EQ(evalTestScript("generatorLog = []; var generatorEarly = generatorGuarded(); generatorEarly.next(); JSON.stringify(generatorEarly.return(7))"), "{\"value\":7,\"done\":true}");
+    EXPECT_EQ(evalTestScript("generatorLog.length"), "0");
+
+    evalTestScript("var generatorThrown = generatorGuarded(); generatorThrown.next();");
+    EXPECT_EQ(evalTestScript("var generatorThrowMessage; try { generatorThrown.throw(new Error('boom')); } catch (e) { generatorThrowMessage = e.message; } generatorThrowMessage"), "boom");
+    EXPECT_EQ(evalTestScript("JSON.stringify(generatorThrown.next())"), "{\"done\":true}");
+
+    EXPECT_EQ(evalTestScript("generatorLog = []; [...generatorGuarded()].join()"), "1,2,3,4");
+    EXPECT_EQ(evalTestScript("generatorLog.join()"), "cleanup");
+
+    evalTestScript(R"(
+    function* generatorInner() { var a = yield 'x'; yield a + 1; }
+    function* generatorOuter() { var r = yield* generatorInner(); yield 'done'; }
+    var generatorDelegating = generatorOuter();
+    )");
+    EXPECT_EQ(evalTestScript("generatorDelegating.next().value"), "x");
+    EXPECT_EQ(evalTestScript("generatorDelegating.next(5).value"), "6");
+    EXPECT_EQ(evalTestScript("generatorDelegating.next().value"), "done");
+}
+
+TEST(EvalScript, GeneratorRegisterFileReuse)
+{
+    // register files of finished generators are reused, so a reused one should look like a new one
+    evalTestScript(R"(
+    function* reusedGenerator(n) {
+        var fresh;
+        var tdz;
+        try { later; } catch (e) { tdz = e.name; }
+        yield String(fresh) + ':' + tdz;
+        let later = n;
+        fresh = { n: n };
+        yield later + fresh.n;
+    }
+    function* reusedThrowingGenerator(n) { var kept = n; yield kept; throw kept; }
+    async function reusedAsync(n) { var fresh; await null; var result = String(fresh) + n; fresh = n; return result; }
+    )");
+    EXPECT_EQ(evalTestScript("var reusedLog = []; for (var i = 0; i < 3; i++) { for (var v of reusedGenerator(i)) reusedLog.push(v); } reusedLog.join()"),
+              "undefined:ReferenceError,0,undefined:ReferenceError,2,undefined:ReferenceError,4");
+    EXPECT_EQ(evalTestScript("var reusedThrown = []; for (var i = 0; i < 3; i++) { try { for (var v of reusedThrowingGenerator(i)) reusedThrown.push(v); } catch (e) { reusedThrown.push('t' + e); } } reusedThrown.join()"),
+              "0,t0,1,t1,2,t2");
+    EXPECT_EQ(evalTestScript("var reusedAsyncLog = []; for (var i = 0; i < 3; i++) { reusedAsync(i).then(function(v) { reusedAsyncLog.push(v); }); }"), "undefined");
+    EXPECT_EQ(evalTestScript("reusedAsyncLog.join()"), "undefined0,undefined1,undefined2");
+    // a generator suspended while another one of the same size finishes keeps its own registers
+    EXPECT_EQ(evalTestScript("var reusedSuspended = reusedGenerator(10); reusedSuspended.next(); [...reusedGenerator(20)]; reusedSuspended.next().value"), "20");
+}
+
+TEST(EvalScript, ConstructorPropertyStorage)
+{
+    evalTestScript(R"(
+    var constructorSeenX = [];
+    function ConstructorPoint(x, y, z) { constructorSeenX.push('x' in this); this.x = x; this.y = y; if (z) { this.z = z; } }
+    var constructorPoints = [];
+    for (var i = 0; i < 5; i++) { constructorPoints.push(new ConstructorPoint(i, i * 2, i % 2 ? i : 0)); }
+    )");
+    // reserved storage must not be visible as properties
+    EXPECT_EQ(evalTestScript("constructorSeenX.join()"), "false,false,false,false,false");
+    EXPECT_EQ(evalTestScript("JSON.stringify(constructorPoints[3])"), "{\"x\":3,\"y\":6,\"z\":3}");
+    EXPECT_EQ(evalTestScript("Object.keys(constructorPoints[4]).join()"), "x,y");
+
+    EXPECT_EQ(evalTestScript(R"(
+    var constructorChanged = new ConstructorPoint(1, 2, 3);
+    delete constructorChanged.y;
+    constructorChanged.w = 4;
+    constructorChanged.v = 5;
+    JSON.stringify(constructorChanged);
+    )"),
+              "{\"x\":1,\"z\":3,\"w\":4,\"v\":5}");
+
+    // returning an object discards the constructed one
+    evalTestScript("function ConstructorReturning() { this.a = 1; return { b: 2 }; }");
+    EXPECT_EQ(evalTestScript("JSON.stringify(new ConstructorReturning())"), "{\"b\":2}");
+    EXPECT_EQ(evalTestScript("JSON.stringify(new ConstructorReturning())"), "{\"b\":2}");
+
+    evalTestScript(R"(
+    var ConstructorClass = class { constructor(n) { for (var i = 0; i < n; i++) { this['k' + i] = i; } } };
+    var ConstructorDerived = class extends ConstructorClass { constructor() { super(1); this.d = 1; } };
+    )");
+    EXPECT_EQ(evalTestScript("Object.keys(new ConstructorClass(6)).length"), "6");
+    EXPECT_EQ(evalTestScript("JSON.stringify(new ConstructorClass(2))"), "{\"k0\":0,\"k1\":1}");
+    EXPECT_EQ(evalTestScript("Object.keys(new ConstructorClass(40)).length"), "40");
+    EXPECT_EQ(evalTestScript("JSON.stringify(new ConstructorDerived())"), "{\"k0\":0,\"d\":1}");
+}
+
+TEST(EvalScript, InlinePropertyStorage)
+{
+    evalTestScript(R"(
+    function InlinePoint(x, y) { this.x = x; this.y = y; }
+    var inlineLiterals = [];
+    var inlinePoints = [];
+    var inlineSpreads = [];
+    for (var i = 0; i < 3; i++) {
+        var o = { a: 1, b: 2, c: 3 };
+        o.d = 4; o.e = 5;
+        delete o.b;
+        var p = new InlinePoint(i, i + 1);
+        p.z = 7; p.w = 8; p.v = 9; p.u = 10; p.t = 11; p.s = 12; p.q = 13;
+        delete p.x;
+        inlineLiterals.push(o);
+        inlinePoints.push(p);
+        inlineSpreads.push({ ...o, f: 6 });
+    }
+    )");
+    for (int i = 0; i < 3; i++) {
+        std::string index = std::to_string(i);
+        EXPECT_EQ(evalTestScript("JSON.stringify(inlineLiterals[" + index + "])"), "{\"a\":1,\"c\":3,\"d\":4,\"e\":5}");
+        EXPECT_EQ(evalTestScript("JSON.stringify(inlinePoints[" + index + "])"), "{\"y\":" + std::to_string(i + 1) + ",\"z\":7,\"w\":8,\"v\":9,\"u\":10,\"t\":11,\"s\":12,\"q\":13}");
+        EXPECT_EQ(evalTestScript("JSON.stringify(inlineSpreads[" + index + "])"), "{\"a\":1,\"c\":3,\"d\":4,\"e\":5,\"f\":6}");
+    }
+
+    // values leave the object body when it becomes a prototype
+    EXPECT_EQ(evalTestScript(R"(
+    var inlineProto = new InlinePoint(1, 2);
+    var inlineChild = Object.create(inlineProto);
+    var before = inlineChild.x + inlineChild.y;
+    inlineProto.x = 10; inlineProto.k = 20; delete inlineProto.y;
+    before + ',' + inlineChild.x + ',' + inlineChild.y + ',' + inlineChild.k + ',' + JSON.stringify(inlineProto);
+    )"),
+              "3,10,undefined,20,{\"x\":10,\"k\":20}");
+}
+
 TEST(Object, ConstructorName)
 {
     ObjectRef* testObj = eval(g_context.get(), StringRef::createFromASCII("function foo(){}; var ctorNameTest = new foo(); ctorNameTest;"))->asObject();
@@ -709,6 +1507,352 @@ TEST(FunctionObject, CallConsturctor)
     });
 }
 
+TEST(FunctionObject, CallSiteCacheStatistics)
+{
+    FunctionObjectRef* fn = eval(g_context.get(), StringRef::createFromASCII(R"(
+    function callSiteCacheStatisticsAdd(a, b) { return a + b; }
+    function callSiteCacheStatisticsTest() {
+        var sum = 0;
+        for (var i = 0; i < 100; i++) {
+            sum = callSiteCacheStatisticsAdd(sum, i);
+        }
+        return sum;
+    }
+    callSiteCacheStatisticsTest;
+    )"))
+                                ->asFunctionObject();
+
+    auto statistics = fn->callSiteCacheStatistics();
+    EXPECT_EQ(statistics.hitCount, 0u);
+    EXPECT_EQ(statistics.missCount, 0u);
+
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, FunctionObjectRef* fn) -> ValueRef* {
+        EXPECT_EQ(fn->call(state, ValueRef::createUndefined(), 0, nullptr)->asNumber(), 4950);
+        return ValueRef::createUndefined();
+    },
+                       fn);
+
+    // first call fills the cache. GC during the loop could empty it and cause a refill
+    statistics = fn->callSiteCacheStatistics();
+    EXPECT_EQ(statistics.hitCount + statistics.missCount, 100u);
+    EXPECT_TRUE(statistics.missCount >= 1);
+    EXPECT_TRUE(statistics.hitCount > statistics.missCount);
+    // `a + b` over numbers is evaluated at call-site once the cache is hot
+    EXPECT_TRUE(statistics.inlinedCallCount > 0);
+    EXPECT_TRUE(statistics.inlinedCallCount < statistics.hitCount);
+}
+
+TEST(FunctionObject, InlinedCallStatistics)
+{
+    FunctionObjectRef* fn = eval(g_context.get(), StringRef::createFromASCII(R"(
+    var inlinedCallPoint = { _x: 3, getX() { return this._x; } };
+    function inlinedCallConcat(a, b) { return a + b; }
+    function inlinedCallStatisticsTest(useString) {
+        var sum = 0;
+        for (var i = 0; i < 100; i++) {
+            sum += useString ? inlinedCallConcat('', i).length : inlinedCallPoint.getX();
+        }
+        return sum;
+    }
+    inlinedCallStatisticsTest;
+    )"))
+                                ->asFunctionObject();
+
+    // string operand may call user code, so the callee is always called
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, FunctionObjectRef* fn) -> ValueRef* {
+        ValueRef* argv[1] = { ValueRef::create(true) };
+        EXPECT_EQ(fn->call(state, ValueRef::createUndefined(), 1, argv)->asNumber(), 190);
+        return ValueRef::createUndefined();
+    },
+                       fn);
+    auto statistics = fn->callSiteCacheStatistics();
+    EXPECT_TRUE(statistics.hitCount > 0);
+    EXPECT_EQ(statistics.inlinedCallCount, 0u);
+
+    // `return this._x` reads own data property of the receiver at call-site
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, FunctionObjectRef* fn) -> ValueRef* {
+        ValueRef* argv[1] = { ValueRef::create(false) };
+        EXPECT_EQ(fn->call(state, ValueRef::createUndefined(), 1, argv)->asNumber(), 300);
+        return ValueRef::createUndefined();
+    },
+                       fn);
+    statistics = fn->callSiteCacheStatistics();
+    EXPECT_TRUE(statistics.inlinedCallCount > 0);
+}
+
+TEST(FunctionObject, CallSiteCacheAcrossGC)
+{
+    FunctionObjectRef* fn = eval(g_context.get(), StringRef::createFromASCII(R"(
+    function callSiteCacheTestAdd(a, b) { return a + b; }
+    function callSiteCacheTestSub(a, b) { return a - b; }
+    function callSiteCacheTest(f) {
+        var sum = 0;
+        for (var i = 0; i < 100; i++) {
+            sum = f(sum, i);
+        }
+        return sum;
+    }
+    callSiteCacheTest;
+    )"))
+                                ->asFunctionObject();
+
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, FunctionObjectRef* fn) -> ValueRef* {
+        ValueRef* add = state->context()->globalObject()->get(state, StringRef::createFromASCII("callSiteCacheTestAdd"));
+        ValueRef* sub = state->context()->globalObject()->get(state, StringRef::createFromASCII("callSiteCacheTestSub"));
+        EXPECT_EQ(fn->call(state, ValueRef::createUndefined(), 1, &add)->asNumber(), 4950);
+        // GC empties call-site caches; cached callee should be refilled, not reused
+        Memory::gc();
+        EXPECT_EQ(fn->call(state, ValueRef::createUndefined(), 1, &sub)->asNumber(), -4950);
+        EXPECT_EQ(fn->call(state, ValueRef::createUndefined(), 1, &add)->asNumber(), 4950);
+        return ValueRef::createUndefined();
+    },
+                       fn);
+}
+
+TEST(EvalScript, DictionaryModeObject)
+{
+    evalTestScript(R"(
+    var dictionaryCache = {};
+    for (var i = 0; i < 40; i++) {
+        dictionaryCache["k" + i] = i;
+    }
+    for (var i = 40; i < 200; i++) {
+        dictionaryCache["k" + i] = i;
+        delete dictionaryCache["k" + (i - 40)];
+    }
+    delete dictionaryCache.k199;
+    dictionaryCache.k100 = "x";
+    var dictionaryKeys = Object.keys(dictionaryCache);
+    )");
+    EXPECT_EQ(evalTestScript("dictionaryKeys.length"), "40");
+    // insertion order is kept across deletions
+    EXPECT_EQ(evalTestScript("dictionaryKeys[0]"), "k160");
+    EXPECT_EQ(evalTestScript("dictionaryKeys[dictionaryKeys.length - 1]"), "k100");
+    EXPECT_EQ(evalTestScript("dictionaryCache.k160"), "160");
+    EXPECT_EQ(evalTestScript("dictionaryCache.k100"), "x");
+    EXPECT_EQ(evalTestScript("'k159' in dictionaryCache"), "false");
+    EXPECT_EQ(evalTestScript("'k160' in dictionaryCache"), "true");
+
+    // properties deleted while enumerating are skipped, added ones are not visited
+    EXPECT_EQ(evalTestScript(R"(
+    var dictionaryVisited = 0;
+    for (var k in dictionaryCache) {
+        if (k === "k161") {
+            delete dictionaryCache.k162;
+            dictionaryCache.added = 1;
+        }
+        dictionaryVisited++;
+    }
+    dictionaryVisited;
+    )"),
+              "39");
+
+    EXPECT_EQ(evalTestScript(R"(
+    var dictionaryRead;
+    for (var i = 0; i < 1000; i++) {
+        dictionaryRead = dictionaryCache.k170;
+    }
+    dictionaryRead;
+    )"),
+              "170");
+    EXPECT_EQ(evalTestScript("Object.create(dictionaryCache).k170"), "170");
+    EXPECT_EQ(evalTestScript("Object.getOwnPropertyNames(dictionaryCache).slice(-2).join()"), "k100,added");
+
+    // deleting from the middle shifts the following properties
+    evalTestScript(R"(
+    var dictionaryShift = {};
+    for (var i = 0; i < 64; i++) {
+        dictionaryShift["s" + i] = i;
+    }
+    for (var i = 0; i < 64; i += 3) {
+        delete dictionaryShift["s" + i];
+    }
+    var dictionaryShiftOk = true;
+    for (var i = 0; i < 64; i++) {
+        var expected = (i % 3) ? i : undefined;
+        if (dictionaryShift["s" + i] !== expected) {
+            dictionaryShiftOk = false;
+        }
+    }
+    )");
+    EXPECT_EQ(evalTestScript("dictionaryShiftOk"), "true");
+    EXPECT_EQ(evalTestScript("Object.keys(dictionaryShift).length"), "42");
+    EXPECT_EQ(evalTestScript("Object.keys(dictionaryShift).slice(0, 4).join()"), "s1,s2,s4,s5");
+
+    // object becomes fast mode while an enumeration still holds its dictionary structure
+    evalTestScript(R"(
+    var dictionaryStable = {};
+    for (var i = 0; i < 40; i++) {
+        dictionaryStable["t" + i] = i;
+    }
+    delete dictionaryStable.t0;
+    var dictionaryStableVisited = [];
+    for (var k in dictionaryStable) {
+        if (k === "t1") {
+            var sum = 0;
+            for (var j = 0; j < 2000; j++) {
+                sum += dictionaryStable.t5;
+            }
+            delete dictionaryStable.t3;
+        }
+        dictionaryStableVisited.push(k);
+    }
+    )");
+    EXPECT_EQ(evalTestScript("dictionaryStableVisited.length"), "38");
+    EXPECT_EQ(evalTestScript("dictionaryStableVisited.slice(0, 3).join()"), "t1,t2,t4");
+    EXPECT_EQ(evalTestScript("dictionaryStable.t39"), "39");
+}
+
+TEST(EvalScript, CopyOwnPropertiesByStructure)
+{
+    evalTestScript(R"(
+    var copySource = { x: 1.5, y: "s", z: 3 };
+    var copySpread = { ...copySource };
+    copySource.x = 2.5;
+    copySpread.z = 4;
+    )");
+    // copies do not share property storage with the source
+    EXPECT_EQ(evalTestScript("copySpread.x"), "1.5");
+    EXPECT_EQ(evalTestScript("copySource.z"), "3");
+    EXPECT_EQ(evalTestScript("Object.keys(copySpread).join()"), "x,y,z");
+    EXPECT_EQ(evalTestScript("JSON.stringify(Object.entries({ w: 0, ...copySource, x: 9, ...null, ...undefined, ...'ab' }))"),
+              "[[\"0\",\"a\"],[\"1\",\"b\"],[\"w\",0],[\"x\",9],[\"y\",\"s\"],[\"z\",3]]");
+
+    // accessors are read, non-enumerable properties are skipped, symbols are copied
+    evalTestScript(R"(
+    var copySymbol = Symbol("s");
+    var copyWithGetter = { get k() { return "getter"; }, [copySymbol]: 1, 2: "two" };
+    Object.defineProperty(copyWithGetter, "hidden", { value: 1, enumerable: false });
+    var copyOfGetter = { ...copyWithGetter };
+    )");
+    EXPECT_EQ(evalTestScript("Object.keys(copyOfGetter).join()"), "2,k");
+    EXPECT_EQ(evalTestScript("copyOfGetter[copySymbol]"), "1");
+    EXPECT_EQ(evalTestScript("Object.getOwnPropertyDescriptor(copyOfGetter, 'k').value"), "getter");
+
+    EXPECT_EQ(evalTestScript(R"(
+    var copyAssigned = Object.assign({}, copySource);
+    copySource.y = "changed";
+    Object.values(copyAssigned).join();
+    )"),
+              "2.5,s,3");
+
+    // own __proto__ data property is assigned as a property, not as the prototype
+    evalTestScript(R"(var copyProto = Object.assign({}, JSON.parse('{"__proto__": 5, "q": 1}'));)");
+    EXPECT_EQ(evalTestScript("Object.getPrototypeOf(copyProto) === Object.prototype"), "true");
+    EXPECT_EQ(evalTestScript("Object.keys(copyProto).join()"), "q");
+
+    // setter deleting a source property while assigning
+    evalTestScript(R"(
+    var copySetterLog = [];
+    var copySetterTarget = { set x(v) { copySetterLog.push(v); delete copySetterSource.y; } };
+    var copySetterSource = { x: 1, y: 2, z: 3 };
+    Object.assign(copySetterTarget, copySetterSource);
+    )");
+    EXPECT_EQ(evalTestScript("copySetterLog.join()"), "1");
+    EXPECT_EQ(evalTestScript("Object.keys(copySetterTarget).join()"), "x,z");
+
+    // cached key lists are not shared with callers
+    EXPECT_EQ(evalTestScript("Object.keys(copySource).push('extra'); Object.keys(copySource).join()"), "x,y,z");
+    EXPECT_EQ(evalTestScript("Object.keys(copySource) !== Object.keys(copySource)"), "true");
+    EXPECT_EQ(evalTestScript(R"(
+    var copyKeysChanged = { m: 1 };
+    Object.keys(copyKeysChanged);
+    copyKeysChanged.n = 2;
+    delete copyKeysChanged.m;
+    Object.keys(copyKeysChanged).join();
+    )"),
+              "n");
+
+    // structure is not shared if a setter or read-only property on the prototype chain handles Set
+    evalTestScript(R"(
+    var assignSetterLog = [];
+    var assignSetterTarget = Object.assign(Object.create({ set x(v) { assignSetterLog.push(v); } }), { x: 1, y: 2 });
+    var assignDeepLog = [];
+    var assignDeepTarget = Object.assign(Object.create(Object.create({ set x(v) { assignDeepLog.push(v); } })), { x: 3 });
+    )");
+    EXPECT_EQ(evalTestScript("assignSetterLog.join()"), "1");
+    EXPECT_EQ(evalTestScript("Object.keys(assignSetterTarget).join()"), "y");
+    EXPECT_EQ(evalTestScript("assignSetterTarget.hasOwnProperty('x')"), "false");
+    EXPECT_EQ(evalTestScript("assignDeepLog.join()"), "3");
+    EXPECT_EQ(evalTestScript("assignDeepTarget.hasOwnProperty('x')"), "false");
+
+    evalTestScript(R"(
+    var assignFrozenTarget = Object.create(Object.freeze({ x: 0 }));
+    var assignFrozenError;
+    try {
+        Object.assign(assignFrozenTarget, { x: 1, y: 2 });
+    } catch (e) {
+        assignFrozenError = e;
+    }
+    )");
+    EXPECT_EQ(evalTestScript("assignFrozenError instanceof TypeError"), "true");
+    EXPECT_EQ(evalTestScript("assignFrozenTarget.hasOwnProperty('x')"), "false");
+    EXPECT_EQ(evalTestScript("assignFrozenTarget.x"), "0");
+    EXPECT_EQ(evalTestScript("Object.keys(assignFrozenTarget).join()"), "");
+    // frozen prototype without the assigned names does not block sharing
+    EXPECT_EQ(evalTestScript("Object.keys(Object.assign(Object.create(Object.freeze({ z: 0 })), { x: 1, y: 2 })).join()"), "x,y");
+    EXPECT_EQ(evalTestScript(R"(
+    var assignGetterOnlyError;
+    try {
+        Object.assign(Object.create({ get x() { return 1; } }), { x: 2 });
+    } catch (e) {
+        assignGetterOnlyError = e;
+    }
+    assignGetterOnlyError instanceof TypeError;
+    )"),
+              "true");
+
+    // proxy on the prototype chain receives Set
+    evalTestScript(R"(
+    var assignProxyLog = [];
+    var assignProxyTarget = Object.create(new Proxy({}, { set(t, k, v, recv) { assignProxyLog.push(k + "=" + v); return true; } }));
+    Object.assign(assignProxyTarget, { x: 1, y: 2 });
+    )");
+    EXPECT_EQ(evalTestScript("assignProxyLog.join()"), "x=1,y=2");
+    EXPECT_EQ(evalTestScript("Object.keys(assignProxyTarget).join()"), "");
+}
+
+TEST(Context, ObjectStructureStatistics)
+{
+    PersistentRefHolder<ContextRef> otherContext = ContextRef::create(g_instance.get());
+    auto otherBefore = otherContext->objectStructureStatistics();
+    auto before = g_context->objectStructureStatistics();
+
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var objectStructureStatisticsTest = [];
+    for (var i = 0; i < 20; i++) {
+        var o = {};
+        o["objectStructureStatisticsTest" + i] = i;
+        o.second = i;
+        objectStructureStatisticsTest.push(o);
+    }
+    )"),
+               StringRef::createFromASCII("test.js"), false);
+
+    auto after = g_context->objectStructureStatistics();
+    EXPECT_TRUE(after.structureCount >= before.structureCount + 40);
+    EXPECT_TRUE(after.transitionCount >= before.transitionCount + 40);
+    EXPECT_TRUE(after.byteSize > before.byteSize);
+
+    // reusing existing transitions creates no structure
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    for (var i = 0; i < 20; i++) {
+        var o = {};
+        o["objectStructureStatisticsTest" + i] = i;
+        o.second = i;
+    }
+    )"),
+               StringRef::createFromASCII("test.js"), false);
+    auto reused = g_context->objectStructureStatistics();
+    EXPECT_TRUE(reused.transitionCount < after.transitionCount + 40);
+
+    // counters are kept for each context
+    auto otherAfter = otherContext->objectStructureStatistics();
+    EXPECT_EQ(otherAfter.structureCount, otherBefore.structureCount);
+    EXPECT_EQ(otherAfter.transitionCount, otherBefore.transitionCount);
+    EXPECT_EQ(otherAfter.byteSize, otherBefore.byteSize);
+}
+
 TEST(ObjectTemplate, Basic1)
 {
     ObjectTemplateRef* tpl = ObjectTemplateRef::create();
@@ -2467,6 +3611,481 @@ TEST(Serializer, Basic9)
     EXPECT_TRUE(v2->asString()->equals(v1->asString()));
 }
 
+TEST(Serializer, Object)
+{
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        ObjectRef* obj = ObjectRef::create(state);
+        MapObjectRef* map = MapObjectRef::create(state);
+        map->set(state, StringRef::createFromASCII("key"), ValueRef::create(10));
+        obj->set(state, StringRef::createFromASCII("map"), map);
+        obj->set(state, StringRef::createFromASCII("self"), obj);
+        obj->set(state, StringRef::createFromASCII("str"), StringRef::createFromASCII("hello world\t"));
+
+        std::ostringstream ostream;
+        EXPECT_TRUE(SerializerRef::serializeInto(state, obj, ostream));
+        std::istringstream istream(ostream.str());
+        ValueRef* result = SerializerRef::deserializeFrom(g_context.get(), istream);
+
+        EXPECT_TRUE(result->isObject());
+        ObjectRef* cloned = result->asObject();
+        EXPECT_TRUE(cloned != obj);
+        EXPECT_TRUE(cloned->get(state, StringRef::createFromASCII("self")) == cloned);
+        EXPECT_TRUE(cloned->get(state, StringRef::createFromASCII("str"))->asString()->equalsWithASCIIString("hello world\t", 12));
+        MapObjectRef* clonedMap = cloned->get(state, StringRef::createFromASCII("map"))->asMapObject();
+        EXPECT_TRUE(clonedMap->get(state, StringRef::createFromASCII("key"))->asNumber() == 10);
+        return ValueRef::createUndefined();
+    });
+}
+
+TEST(Serializer, TransferArrayBuffer)
+{
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        ArrayBufferObjectRef* buffer = ArrayBufferObjectRef::create(state);
+        buffer->allocateBuffer(state, 16);
+        buffer->rawBuffer()[3] = 42;
+
+        ValueVectorRef* transferList = ValueVectorRef::create(1);
+        transferList->set(0, buffer);
+
+        SerializedTransferTableRef* transferTable = SerializedTransferTableRef::create();
+        std::ostringstream ostream;
+        EXPECT_TRUE(SerializerRef::serializeInto(state, buffer, ostream, transferList, transferTable));
+        EXPECT_TRUE(buffer->isDetachedBuffer());
+        EXPECT_TRUE(transferTable->size() == 1);
+
+        // stream without its transfer table cannot reach the data block
+        std::istringstream istreamWithoutTable(ostream.str());
+        ValueRef* detached = SerializerRef::deserializeFrom(g_context.get(), istreamWithoutTable);
+        EXPECT_TRUE(detached->asArrayBufferObject()->isDetachedBuffer());
+
+        std::istringstream istream(ostream.str());
+        ValueRef* result = SerializerRef::deserializeFrom(g_context.get(), istream, transferTable);
+        EXPECT_TRUE(result->isArrayBufferObject());
+        EXPECT_TRUE(result->asArrayBufferObject()->byteLength() == 16);
+        EXPECT_TRUE(result->asArrayBufferObject()->rawBuffer()[3] == 42);
+
+        // data block is adopted only once, so replayed stream gets a detached buffer
+        std::istringstream replayed(ostream.str());
+        ValueRef* replayedResult = SerializerRef::deserializeFrom(g_context.get(), replayed, transferTable);
+        EXPECT_TRUE(replayedResult->asArrayBufferObject()->isDetachedBuffer());
+        transferTable->destroy();
+
+        // functions cannot be cloned
+        std::ostringstream ostream2;
+        EXPECT_FALSE(SerializerRef::serializeInto(state, state->context()->globalObject()->get(state, StringRef::createFromASCII("Object")), ostream2));
+        return ValueRef::createUndefined();
+    });
+}
+
+TEST(Serializer, TransferUnreachableArrayBuffer)
+{
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        ArrayBufferObjectRef* unreachable = ArrayBufferObjectRef::create(state);
+        unreachable->allocateBuffer(state, 8);
+        unreachable->rawBuffer()[7] = 7;
+        ArrayBufferObjectRef* reachable = ArrayBufferObjectRef::create(state);
+        reachable->allocateBuffer(state, 4);
+        reachable->rawBuffer()[0] = 1;
+        ArrayBufferObjectRef* empty = ArrayBufferObjectRef::create(state);
+        empty->allocateBuffer(state, 0);
+
+        ObjectRef* obj = ObjectRef::create(state);
+        obj->set(state, StringRef::createFromASCII("buffer"), reachable);
+
+        ValueVectorRef* transferList = ValueVectorRef::create(3);
+        transferList->set(0, unreachable);
+        transferList->set(1, reachable);
+        transferList->set(2, empty);
+
+        SerializedTransferTableRef* transferTable = SerializedTransferTableRef::create();
+        std::ostringstream ostream;
+        EXPECT_TRUE(SerializerRef::serializeInto(state, obj, ostream, transferList, transferTable));
+        // every transferred buffer has its own entry
+        EXPECT_TRUE(transferTable->size() == 3);
+        EXPECT_TRUE(unreachable->isDetachedBuffer());
+        EXPECT_TRUE(empty->isDetachedBuffer());
+
+        std::istringstream istream(ostream.str());
+        ValueVectorRef* buffers = ValueVectorRef::create();
+        ValueRef* result = SerializerRef::deserializeFrom(state, istream, transferTable, buffers);
+        EXPECT_TRUE(buffers->size() == 3);
+        EXPECT_TRUE(buffers->at(0)->asArrayBufferObject()->byteLength() == 8);
+        EXPECT_TRUE(buffers->at(0)->asArrayBufferObject()->rawBuffer()[7] == 7);
+        EXPECT_TRUE(buffers->at(1) == result->asObject()->get(state, StringRef::createFromASCII("buffer")));
+        EXPECT_TRUE(buffers->at(1)->asArrayBufferObject()->rawBuffer()[0] == 1);
+        EXPECT_FALSE(buffers->at(2)->asArrayBufferObject()->isDetachedBuffer());
+        EXPECT_TRUE(buffers->at(2)->asArrayBufferObject()->byteLength() == 0);
+        transferTable->destroy();
+        return ValueRef::createUndefined();
+    });
+}
+
+TEST(Serializer, MalformedInput)
+{
+    // reference to an object which was never deserialized
+    std::string forgedReference;
+    forgedReference.push_back(static_cast<char>(16));
+    forgedReference.push_back(static_cast<char>(5));
+    std::istringstream istream1(forgedReference);
+    EXPECT_TRUE(SerializerRef::deserializeFrom(g_context.get(), istream1) == nullptr);
+
+    // unknown type
+    std::istringstream istream2(std::string(1, static_cast<char>(200)));
+    EXPECT_TRUE(SerializerRef::deserializeFrom(g_context.get(), istream2) == nullptr);
+
+    // truncated stream
+    std::ostringstream ostream;
+    EXPECT_TRUE(SerializerRef::serializeInto(StringRef::createFromASCII("hello world"), ostream));
+    std::string truncated = ostream.str();
+    truncated.resize(truncated.size() - 3);
+    std::istringstream istream3(truncated);
+    EXPECT_TRUE(SerializerRef::deserializeFrom(g_context.get(), istream3) == nullptr);
+
+    // Uint8Array with byteOffset 3 and length 2 over a 4 byte ArrayBuffer
+    const char forgedView[] = { 15, 0, 3, 0, 3, 2, 2, 14, 0, 4, 1, 2, 3, 4 };
+    std::istringstream istream4(std::string(forgedView, sizeof(forgedView)));
+    EXPECT_TRUE(SerializerRef::deserializeFrom(g_context.get(), istream4) == nullptr);
+
+    // ExecutionStateRef version throws TypeError
+    auto result = Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        std::string forged(1, static_cast<char>(16));
+        forged.push_back(static_cast<char>(0));
+        std::istringstream istream(forged);
+        return SerializerRef::deserializeFrom(state, istream);
+    });
+    EXPECT_FALSE(result.isSuccessful());
+    EXPECT_TRUE(result.resultOrErrorToString(g_context.get())->toStdUTF8String().find("TypeError") != std::string::npos);
+}
+
+TEST(WorkerPool, PostMessage)
+{
+    if (!Globals::supportsThreading()) {
+        return;
+    }
+
+    static std::atomic<int> sum(0);
+    WorkerPoolRef* pool = WorkerPoolRef::create(
+        2, 0, [](VMInstanceRef* instance, size_t workerIndex, void* data) -> PersistentRefHolder<ContextRef> {
+            return ContextRef::create(instance);
+        },
+        [](ExecutionStateRef* state, size_t workerIndex, ValueRef* message, void* data) {
+            ValueRef* value = message->asObject()->get(state, StringRef::createFromASCII("value"));
+            sum.fetch_add(value->toInt32(state));
+        });
+    EXPECT_EQ(pool->workerCount(), 2u);
+
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, WorkerPoolRef* pool) -> ValueRef* {
+        for (int i = 1; i <= 10; i++) {
+            ObjectRef* message = ObjectRef::create(state);
+            message->set(state, StringRef::createFromASCII("value"), ValueRef::create(i));
+            EXPECT_TRUE(pool->postMessage(state, i % 2, message));
+        }
+        return ValueRef::createUndefined();
+    },
+                       pool);
+
+    // destroy waits until every posted message is handled
+    pool->destroy();
+    EXPECT_EQ(sum.load(), 55);
+}
+
+TEST(WorkerPool, TransferArrayBuffer)
+{
+    if (!Globals::supportsThreading()) {
+        return;
+    }
+
+    static std::atomic<int> received(0);
+    WorkerPoolRef* pool = WorkerPoolRef::create(
+        1, 0, [](VMInstanceRef* instance, size_t workerIndex, void* data) -> PersistentRefHolder<ContextRef> {
+            return ContextRef::create(instance);
+        },
+        [](ExecutionStateRef* state, size_t workerIndex, ValueRef* message, void* data) {
+            ArrayBufferObjectRef* buffer = message->asArrayBufferObject();
+            received.store(buffer->byteLength() == 16 ? buffer->rawBuffer()[3] : -1);
+        });
+
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, WorkerPoolRef* pool) -> ValueRef* {
+        ArrayBufferObjectRef* buffer = ArrayBufferObjectRef::create(state);
+        buffer->allocateBuffer(state, 16);
+        buffer->rawBuffer()[3] = 42;
+        ValueVectorRef* transferList = ValueVectorRef::create(1);
+        transferList->set(0, buffer);
+        EXPECT_TRUE(pool->postMessage(state, 0, buffer, transferList));
+        EXPECT_TRUE(buffer->isDetachedBuffer());
+        return ValueRef::createUndefined();
+    },
+                       pool);
+
+    pool->destroy();
+    EXPECT_EQ(received.load(), 42);
+}
+
+TEST(WorkerPool, PostMessageWhileTerminating)
+{
+    if (!Globals::supportsThreading()) {
+        return;
+    }
+
+    static std::atomic<int> acceptedCount(0);
+    static std::atomic<int> handledCount(0);
+    static std::atomic<int> rejectedCount(0);
+    static WorkerPoolRef* pool;
+    pool = WorkerPoolRef::create(
+        2, 0, [](VMInstanceRef* instance, size_t workerIndex, void* data) -> PersistentRefHolder<ContextRef> {
+            return ContextRef::create(instance);
+        },
+        [](ExecutionStateRef* state, size_t workerIndex, ValueRef* message, void* data) {
+            if (workerIndex == 0) {
+                // forwarded message is rejected once the pool starts terminating
+                if (pool->postMessage(state, 1, message)) {
+                    acceptedCount.fetch_add(1);
+                }
+                // worker 0 is the only sender, so this is the final count after its last message
+                rejectedCount.store(static_cast<int>(pool->metrics(1).rejectedMessageCount));
+            } else {
+                handledCount.fetch_add(1);
+            }
+        });
+
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        for (int i = 0; i < 100; i++) {
+            EXPECT_TRUE(pool->postMessage(state, 0, ValueRef::create(i)));
+        }
+        return ValueRef::createUndefined();
+    });
+
+    // every accepted message should be handled before worker exits
+    pool->destroy();
+    EXPECT_EQ(acceptedCount.load(), handledCount.load());
+    // messages rejected before and after serialization are both counted
+    EXPECT_EQ(acceptedCount.load() + rejectedCount.load(), 100);
+}
+
+TEST(WebAssembly, NumericCallTrampoline)
+{
+    // exports: add (i32, i32) -> i32, dbl (f64) -> f64, fmul (f32, f32) -> f32, callHost (i32) -> i32 calling env.hostAdd1,
+    // mixed (i32, f64) -> f64 which uses the generic path, trap () -> () which runs unreachable
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var wasmTrampolineBytes = new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x20, 0x06, 0x60, 0x02, 0x7f, 0x7f, 0x01,
+        0x7f, 0x60, 0x01, 0x7c, 0x01, 0x7c, 0x60, 0x02, 0x7d, 0x7d, 0x01, 0x7d, 0x60, 0x01, 0x7f, 0x01,
+        0x7f, 0x60, 0x02, 0x7f, 0x7c, 0x01, 0x7c, 0x60, 0x00, 0x00, 0x02, 0x10, 0x01, 0x03, 0x65, 0x6e,
+        0x76, 0x08, 0x68, 0x6f, 0x73, 0x74, 0x41, 0x64, 0x64, 0x31, 0x00, 0x03, 0x03, 0x07, 0x06, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x2e, 0x06, 0x03, 0x61, 0x64, 0x64, 0x00, 0x01, 0x03, 0x64,
+        0x62, 0x6c, 0x00, 0x02, 0x04, 0x66, 0x6d, 0x75, 0x6c, 0x00, 0x03, 0x08, 0x63, 0x61, 0x6c, 0x6c,
+        0x48, 0x6f, 0x73, 0x74, 0x00, 0x04, 0x05, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x00, 0x05, 0x04, 0x74,
+        0x72, 0x61, 0x70, 0x00, 0x06, 0x0a, 0x34, 0x06, 0x07, 0x00, 0x20, 0x00, 0x20, 0x01, 0x6a, 0x0b,
+        0x0e, 0x00, 0x20, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xa2, 0x0b, 0x07,
+        0x00, 0x20, 0x00, 0x20, 0x01, 0x94, 0x0b, 0x06, 0x00, 0x20, 0x00, 0x10, 0x00, 0x0b, 0x08, 0x00,
+        0x20, 0x00, 0xb7, 0x20, 0x01, 0xa0, 0x0b, 0x03, 0x00, 0x00, 0x0b
+    ]);
+    var wasmTrampolineHost = function(x) { return x + 1; };
+    typeof WebAssembly === "object" && (function() {
+        var module = new WebAssembly.Module(wasmTrampolineBytes);
+        var instance = new WebAssembly.Instance(module, { env: { hostAdd1: function(x) { return wasmTrampolineHost(x); } } });
+        this.wasmTrampolineExports = instance.exports;
+        return true;
+    })();
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    if (s != "true") {
+        // WebAssembly is not enabled
+        EXPECT_EQ(s, "false");
+        return;
+    }
+
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.add(2, 3)"), "5");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.add(2147483647, 1)"), "-2147483648");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.add(1.9, 1)"), "2");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.add()"), "0");
+    // non-number arguments go through ToWebAssemblyValue
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.add('4', 1)"), "5");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.add({ valueOf() { return 7; } }, 1)"), "8");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.dbl(1.5)"), "3");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.dbl(0.1)"), "0.2");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.dbl('x')"), "NaN");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.fmul(1.5, 2)"), "3");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.fmul(0.1, 1)"), "0.10000000149011612");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.mixed(1, 0.5)"), "1.5");
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.trap.length + ',' + wasmTrampolineExports.add.length"), "0,2");
+    EXPECT_EQ(evalTestScript("try { wasmTrampolineExports.trap(); 'no trap'; } catch (e) { e instanceof WebAssembly.RuntimeError; }"), "true");
+
+    // host import with numeric signature
+    EXPECT_EQ(evalTestScript("wasmTrampolineExports.callHost(41)"), "42");
+    EXPECT_EQ(evalTestScript("wasmTrampolineHost = function(x) { return '5'; }; wasmTrampolineExports.callHost(1)"), "5");
+    EXPECT_EQ(evalTestScript("wasmTrampolineHost = function(x) { return 2.7; }; wasmTrampolineExports.callHost(1)"), "2");
+    EXPECT_EQ(evalTestScript("wasmTrampolineHost = function(x) { throw 'host'; }; try { wasmTrampolineExports.callHost(1); } catch (e) { e instanceof WebAssembly.RuntimeError; }"), "true");
+}
+
+TEST(WebAssembly, CompileOnThread)
+{
+    if (!Globals::supportsThreading()) {
+        return;
+    }
+
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var wasmCompileResult = {};
+    function wasmPaddedModule(magic) {
+        // custom section pads module over the size compiled on another thread
+        var payload = 64 * 1024;
+        var bytes = new Uint8Array(8 + 1 + 3 + 2 + payload);
+        bytes.set([0x00, magic, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00]);
+        // section id, LEB128 size of (name length + name + payload), name "x"
+        bytes.set([0x00, 0x82, 0x80, 0x04, 0x01, 0x78], 8);
+        return bytes.buffer;
+    }
+    typeof WebAssembly === "object" &&
+    WebAssembly.compile(wasmPaddedModule(0x61)).then(function(m) {
+        wasmCompileResult.valid = m instanceof WebAssembly.Module;
+    }, function(e) {
+        wasmCompileResult.valid = String(e);
+    }) && WebAssembly.compile(wasmPaddedModule(0x62)).then(function(m) {
+        wasmCompileResult.invalid = "resolved";
+    }, function(e) {
+        wasmCompileResult.invalid = e instanceof WebAssembly.CompileError;
+    }) && true;
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    if (s != "true") {
+        // WebAssembly is not enabled
+        EXPECT_EQ(s, "false");
+        return;
+    }
+
+    // completion of compile is delivered as job from another thread
+    while (g_instance->hasPendingJobFromAnotherThread()) {
+        g_instance->waitEventFromAnotherThread();
+        g_instance->executePendingJobFromAnotherThread();
+        while (g_instance->hasPendingJob()) {
+            g_instance->executePendingJob();
+        }
+    }
+
+    s = evalScript(g_context.get(), StringRef::createFromASCII("wasmCompileResult.valid + '|' + wasmCompileResult.invalid"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "true|true");
+}
+
+TEST(WebAssembly, CompileOnThreadCanceledWithContext)
+{
+    if (!Globals::supportsThreading()) {
+        return;
+    }
+
+    PersistentRefHolder<ContextRef> otherContext = ContextRef::create(g_instance.get());
+    auto s = evalScript(otherContext.get(), StringRef::createFromASCII(R"(
+    var wasmCompileResult = "pending";
+    var bytes = new Uint8Array(8 + 1 + 3 + 2 + 64 * 1024);
+    bytes.set([0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00]);
+    bytes.set([0x00, 0x82, 0x80, 0x04, 0x01, 0x78], 8);
+    typeof WebAssembly === "object" &&
+    WebAssembly.compile(bytes.buffer).then(function(m) {
+        wasmCompileResult = "resolved";
+    }, function(e) {
+        wasmCompileResult = "rejected";
+    }) && true;
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    if (s != "true") {
+        // WebAssembly is not enabled
+        EXPECT_EQ(s, "false");
+        return;
+    }
+    EXPECT_TRUE(g_instance->hasPendingJobFromAnotherThread());
+
+    // tearing the context down waits the compile and drops its job
+    otherContext->clearRelatedQueuedJobs();
+    EXPECT_FALSE(g_instance->hasPendingJobFromAnotherThread());
+
+    g_instance->executePendingJobFromAnotherThread();
+    while (g_instance->hasPendingJob()) {
+        g_instance->executePendingJob();
+    }
+    s = evalScript(otherContext.get(), StringRef::createFromASCII("wasmCompileResult"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "pending");
+}
+
+static void drainWASMCompileJobs(VMInstanceRef* instance)
+{
+    while (instance->hasPendingJobFromAnotherThread()) {
+        instance->waitEventFromAnotherThread();
+        instance->executePendingJobFromAnotherThread();
+    }
+    while (instance->hasPendingJob()) {
+        instance->executePendingJob();
+    }
+}
+
+TEST(WebAssembly, CompileWithCodeCache)
+{
+    char cacheDir[] = "/tmp/escargot-wasm-cache-XXXXXX";
+    ASSERT_TRUE(mkdtemp(cacheDir) != nullptr);
+
+    PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create(nullptr, nullptr, cacheDir);
+    PersistentRefHolder<ContextRef> context = createEscargotContext(instance.get());
+    if (!instance->isCodeCacheEnabled()) {
+        context.release();
+        instance.release();
+        return;
+    }
+
+    auto s = evalScript(context.get(), StringRef::createFromASCII(R"(
+    var wasmCacheResult = {};
+    function wasmCachePaddedModule(magic) {
+        var payload = 64 * 1024;
+        var bytes = new Uint8Array(8 + 1 + 3 + 2 + payload);
+        bytes.set([0x00, magic, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00]);
+        bytes.set([0x00, 0x82, 0x80, 0x04, 0x01, 0x78], 8);
+        return bytes.buffer;
+    }
+    function wasmCacheCompile(name, buffer) {
+        WebAssembly.compile(buffer).then(function(m) {
+            wasmCacheResult[name] = m instanceof WebAssembly.Module;
+        }, function(e) {
+            wasmCacheResult[name] = e instanceof WebAssembly.CompileError ? "CompileError" : String(e);
+        });
+    }
+    typeof WebAssembly === "object" && (function() {
+        var buffer = wasmCachePaddedModule(0x61);
+        wasmCacheCompile("valid", buffer);
+        // bytes are copied by compile, so changing them later has no effect
+        new Uint8Array(buffer).fill(0xff);
+        wasmCacheCompile("invalid", wasmCachePaddedModule(0x62));
+        return true;
+    })();
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    if (s != "true") {
+        // WebAssembly is not enabled
+        EXPECT_EQ(s, "false");
+        context.release();
+        instance.release();
+        return;
+    }
+
+    drainWASMCompileJobs(instance.get());
+    s = evalScript(context.get(), StringRef::createFromASCII("wasmCacheResult.valid + '|' + wasmCacheResult.invalid"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "true|CompileError");
+    EXPECT_EQ(instance->codeCacheWASMModuleLoadCount(), 0u);
+
+    // completed compile was stored, so the same bytes are loaded from the cache
+    evalScript(context.get(), StringRef::createFromASCII("wasmCacheCompile('cached', wasmCachePaddedModule(0x61))"), StringRef::createFromASCII("test.js"), false);
+    drainWASMCompileJobs(instance.get());
+    s = evalScript(context.get(), StringRef::createFromASCII("String(wasmCacheResult.cached)"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "true");
+    EXPECT_EQ(instance->codeCacheWASMModuleLoadCount(), 1u);
+
+    // failed compile is never stored
+    evalScript(context.get(), StringRef::createFromASCII("wasmCacheCompile('invalidAgain', wasmCachePaddedModule(0x62))"), StringRef::createFromASCII("test.js"), false);
+    drainWASMCompileJobs(instance.get());
+    s = evalScript(context.get(), StringRef::createFromASCII("String(wasmCacheResult.invalidAgain)"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "CompileError");
+    EXPECT_EQ(instance->codeCacheWASMModuleLoadCount(), 1u);
+
+    context.release();
+    instance.release();
+}
+
 TEST(ExecutionState, TryCatchFinally)
 {
     Evaluator::execute(g_context, [](ExecutionStateRef* state) -> ValueRef* {
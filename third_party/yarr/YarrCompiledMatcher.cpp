@@ -0,0 +1,936 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "WTFBridge.h"
+#include "YarrCompiledMatcher.h"
+
+// test builds always have the compiled matcher so that it can be compared with the interpreter
+#if defined(ENABLE_REGEXP_COMPILED_MATCHER) || defined(ESCARGOT_ENABLE_TEST)
+
+#include <algorithm>
+#include <map>
+
+namespace JSC { namespace Yarr {
+
+// CharacterClassMatcher keeps its own copy of a CharacterClass
+// because byteCompile moves the user character classes into the BytecodePattern
+// Latin1 characters are tested with a bitmap, others with sorted lists
+class CharacterClassMatcher {
+public:
+    CharacterClassMatcher(const CharacterClass* characterClass, bool invert)
+        : m_anyCharacter(characterClass->m_anyCharacter)
+        , m_invert(invert)
+    {
+        memset(m_bitmap, 0, sizeof(m_bitmap));
+        for (char32_t ch = 0; ch < 256; ch++) {
+            if (contains(characterClass, ch) != invert) {
+                m_bitmap[ch >> 5] |= 1u << (ch & 31);
+            }
+        }
+
+        m_matches.assign(characterClass->m_matchesUnicode.begin(), characterClass->m_matchesUnicode.end());
+        std::sort(m_matches.begin(), m_matches.end());
+
+        std::vector<CharacterRange> ranges(characterClass->m_rangesUnicode.begin(), characterClass->m_rangesUnicode.end());
+        std::sort(ranges.begin(), ranges.end(), [](const CharacterRange& a, const CharacterRange& b) {
+            return a.begin < b.begin;
+        });
+        for (size_t i = 0; i < ranges.size(); i++) {
+            if (m_ranges.size() && ranges[i].begin <= m_ranges.back().end) {
+                m_ranges.back().end = std::max(m_ranges.back().end, ranges[i].end);
+            } else {
+                m_ranges.push_back(ranges[i]);
+            }
+        }
+    }
+
+    ALWAYS_INLINE bool test(char32_t ch) const
+    {
+        if (LIKELY(ch < 256)) {
+            return m_bitmap[ch >> 5] & (1u << (ch & 31));
+        }
+        return testNonLatin1(ch) != m_invert;
+    }
+
+    size_t estimatedSizeInBytes() const
+    {
+        return sizeof(CharacterClassMatcher) + m_matches.capacity() * sizeof(char32_t) + m_ranges.capacity() * sizeof(CharacterRange);
+    }
+
+private:
+    // same rule as Interpreter::testCharacterClass
+    static bool contains(const CharacterClass* characterClass, char32_t ch)
+    {
+        if (characterClass->m_anyCharacter) {
+            return true;
+        }
+
+        const Vector<char32_t>& matches = isASCII(ch) ? characterClass->m_matches : characterClass->m_matchesUnicode;
+        const Vector<CharacterRange>& ranges = isASCII(ch) ? characterClass->m_ranges : characterClass->m_rangesUnicode;
+        for (size_t i = 0; i < matches.size(); i++) {
+            if (matches[i] == ch) {
+                return true;
+            }
+        }
+        for (size_t i = 0; i < ranges.size(); i++) {
+            if (ch >= ranges[i].begin && ch <= ranges[i].end) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool testNonLatin1(char32_t ch) const
+    {
+        if (m_anyCharacter) {
+            return true;
+        }
+        if (std::binary_search(m_matches.begin(), m_matches.end(), ch)) {
+            return true;
+        }
+        auto iter = std::upper_bound(m_ranges.begin(), m_ranges.end(), ch, [](char32_t c, const CharacterRange& range) {
+            return c < range.begin;
+        });
+        return iter != m_ranges.begin() && ch <= (iter - 1)->end;
+    }
+
+    uint32_t m_bitmap[256 / 32];
+    std::vector<char32_t> m_matches;
+    std::vector<CharacterRange> m_ranges;
+    bool m_anyCharacter;
+    bool m_invert;
+};
+
+struct CharacterAtom {
+    CharacterAtom(char32_t lo = 0, char32_t hi = 0)
+        : m_lo(lo)
+        , m_hi(hi)
+    {
+    }
+
+    ALWAYS_INLINE bool test(char32_t ch) const
+    {
+        return ch == m_lo || ch == m_hi;
+    }
+
+    char32_t m_lo;
+    char32_t m_hi;
+};
+
+enum class MatcherOpcode : uint8_t {
+    Literal, // run of single characters like /abc/, m_characters[index .. index + count)
+    FixedRepeat, // atom{count}
+    GreedyRepeat, // atom{min,max}
+    NonGreedyRepeat, // atom{min,max}?
+    BOL,
+    EOL,
+    WordBoundary,
+    Disjunction, // m_alternatives[index .. index + count)
+    BeginCapture, // index is subpattern id
+    EndCapture,
+    Loop, // quantified parentheses, index is loop index
+    LoopBack, // end of a loop body, body is the Loop instruction
+    Accept,
+};
+
+// next is the continuation of every instruction except Disjunction, LoopBack and Accept
+// every alternative of a Disjunction is already connected to the continuation of the disjunction
+struct MatcherInstruction {
+    MatcherInstruction(MatcherOpcode opcode, unsigned next)
+        : m_opcode(opcode)
+        , m_flag(false)
+        , m_next(next)
+        , m_index(0)
+        , m_count(0)
+        , m_min(0)
+        , m_max(0)
+        , m_body(0)
+        , m_firstCapture(1)
+        , m_lastCapture(0)
+        , m_characterClass(nullptr)
+    {
+    }
+
+    // atoms of repeats are single characters or character classes
+    ALWAYS_INLINE bool testAtom(char32_t ch) const
+    {
+        return m_characterClass ? m_characterClass->test(ch) : m_atom.test(ch);
+    }
+
+    MatcherOpcode m_opcode;
+    bool m_flag; // invert of WordBoundary, multiline of BOL and EOL, greedy of Loop
+    unsigned m_next;
+    unsigned m_index;
+    unsigned m_count;
+    unsigned m_min;
+    unsigned m_max;
+    unsigned m_body;
+    unsigned m_firstCapture;
+    unsigned m_lastCapture;
+    CharacterAtom m_atom;
+    // also newline or wordchar class of assertions
+    const CharacterClassMatcher* m_characterClass;
+};
+
+struct MatcherProgram {
+    std::vector<MatcherInstruction> m_instructions;
+    std::vector<unsigned> m_alternatives;
+    std::vector<CharacterAtom> m_characters;
+    std::vector<std::unique_ptr<CharacterClassMatcher>> m_characterClasses;
+};
+
+static constexpr unsigned noInstruction = std::numeric_limits<unsigned>::max();
+// about 6MB of backtracking entries, the interpreter retries longer matches
+static constexpr size_t maxBacktrackEntries = 1 << 18;
+
+// the matcher never recurses
+// backtracking points and the values they have to restore are pushed on one stack
+// failure pops the stack, restoring the values, until a backtracking point can try another way
+struct BacktrackEntry {
+    enum Type : uint8_t {
+        RestoreSlot,
+        ResumeAlternative, // try alternative value of the Disjunction at pc
+        ResumeGreedyRepeat, // give back one character of value characters matched at pos
+        ResumeNonGreedyRepeat, // take one more character after value characters matched at pos
+        ResumeAt, // continue at pc, e.g. exit of a greedy loop whose iteration failed
+        ResumeLoopIteration, // run one more iteration of a non greedy loop at pc
+    };
+
+    BacktrackEntry(Type type, unsigned pc, unsigned pos, unsigned value, unsigned* slot)
+        : m_type(type)
+        , m_pc(pc)
+        , m_pos(pos)
+        , m_value(value)
+        , m_slot(slot)
+    {
+    }
+
+    Type m_type;
+    unsigned m_pc;
+    unsigned m_pos;
+    unsigned m_value;
+    unsigned* m_slot;
+};
+
+template <typename CharType>
+class MatchState {
+public:
+    MatchState(const MatcherProgram& program, const CharType* input, unsigned length, unsigned* output, unsigned* groupStarts, unsigned* loopCounts, unsigned* loopStarts)
+        : m_program(program)
+        , m_input(input)
+        , m_length(length)
+        , m_output(output)
+        , m_groupStarts(groupStarts)
+        , m_loopCounts(loopCounts)
+        , m_loopStarts(loopStarts)
+        , m_matchEnd(0)
+        , m_remainingSteps(matchLimit)
+        , m_failed(false)
+    {
+    }
+
+    // the budget is given to every start position
+    // so a long input without a match does not exhaust it
+    void resetBudget()
+    {
+        m_remainingSteps = matchLimit;
+    }
+
+    bool failed() const
+    {
+        return m_failed;
+    }
+
+    unsigned matchEnd() const
+    {
+        return m_matchEnd;
+    }
+
+    // returns true when the program matches at pos
+    // the stack is empty and every slot is restored when it returns false
+    bool run(unsigned pc, unsigned pos);
+
+private:
+    // every backtracking point consumes one step
+    // running out of steps or entries aborts the match so that the interpreter can retry it
+    ALWAYS_INLINE bool consumeStep()
+    {
+        if (UNLIKELY(!--m_remainingSteps || m_stack.size() > maxBacktrackEntries)) {
+            m_failed = true;
+            return false;
+        }
+        return true;
+    }
+
+    ALWAYS_INLINE void setSlot(unsigned* slot, unsigned value)
+    {
+        m_stack.push_back(BacktrackEntry(BacktrackEntry::RestoreSlot, 0, 0, *slot, slot));
+        *slot = value;
+    }
+
+    ALWAYS_INLINE void pushResume(BacktrackEntry::Type type, unsigned pc, unsigned pos, unsigned value)
+    {
+        m_stack.push_back(BacktrackEntry(type, pc, pos, value, nullptr));
+    }
+
+    // returns false when the pattern cannot iterate
+    bool enterLoop(const MatcherInstruction& loop, unsigned loopPc, unsigned pos, unsigned& pc);
+    bool iterate(const MatcherInstruction& loop, unsigned pos, unsigned& pc);
+    // returns false when no backtracking point is left
+    bool backtrack(unsigned& pc, unsigned& pos);
+
+    const MatcherProgram& m_program;
+    const CharType* m_input;
+    unsigned m_length;
+    unsigned* m_output;
+    unsigned* m_groupStarts;
+    unsigned* m_loopCounts;
+    unsigned* m_loopStarts;
+    unsigned m_matchEnd;
+    unsigned m_remainingSteps;
+    bool m_failed;
+    std::vector<BacktrackEntry> m_stack;
+};
+
+template <typename CharType>
+bool MatchState<CharType>::run(unsigned pc, unsigned pos)
+{
+    ASSERT(m_stack.empty());
+    const MatcherInstruction* instructions = m_program.m_instructions.data();
+    while (true) {
+        const MatcherInstruction& inst = instructions[pc];
+        bool matched = true;
+        switch (inst.m_opcode) {
+        case MatcherOpcode::Literal: {
+            if (m_length - pos < inst.m_count) {
+                matched = false;
+                break;
+            }
+            const CharacterAtom* characters = m_program.m_characters.data() + inst.m_index;
+            const CharType* input = m_input + pos;
+            for (unsigned i = 0; i < inst.m_count; i++) {
+                if (!characters[i].test(input[i])) {
+                    matched = false;
+                    break;
+                }
+            }
+            pos += inst.m_count;
+            pc = inst.m_next;
+            break;
+        }
+        case MatcherOpcode::FixedRepeat: {
+            if (m_length - pos < inst.m_count) {
+                matched = false;
+                break;
+            }
+            const CharType* input = m_input + pos;
+            for (unsigned i = 0; i < inst.m_count; i++) {
+                if (!inst.testAtom(input[i])) {
+                    matched = false;
+                    break;
+                }
+            }
+            pos += inst.m_count;
+            pc = inst.m_next;
+            break;
+        }
+        case MatcherOpcode::GreedyRepeat: {
+            // consume as much as possible and then give back one character at a time
+            const CharType* input = m_input + pos;
+            unsigned limit = std::min(inst.m_max, m_length - pos);
+            unsigned count = 0;
+            while (count < limit && inst.testAtom(input[count])) {
+                count++;
+            }
+            if (count < inst.m_min) {
+                matched = false;
+                break;
+            }
+            if (count > inst.m_min) {
+                pushResume(BacktrackEntry::ResumeGreedyRepeat, pc, pos, count);
+            }
+            pos += count;
+            pc = inst.m_next;
+            break;
+        }
+        case MatcherOpcode::NonGreedyRepeat: {
+            const CharType* input = m_input + pos;
+            unsigned limit = std::min(inst.m_max, m_length - pos);
+            if (limit < inst.m_min) {
+                matched = false;
+                break;
+            }
+            for (unsigned i = 0; i < inst.m_min; i++) {
+                if (!inst.testAtom(input[i])) {
+                    matched = false;
+                    break;
+                }
+            }
+            if (matched && inst.m_min < limit) {
+                pushResume(BacktrackEntry::ResumeNonGreedyRepeat, pc, pos, inst.m_min);
+            }
+            pos += inst.m_min;
+            pc = inst.m_next;
+            break;
+        }
+        case MatcherOpcode::BOL:
+            matched = !pos || (inst.m_flag && inst.m_characterClass->test(m_input[pos - 1]));
+            pc = inst.m_next;
+            break;
+        case MatcherOpcode::EOL:
+            matched = pos == m_length || (inst.m_flag && inst.m_characterClass->test(m_input[pos]));
+            pc = inst.m_next;
+            break;
+        case MatcherOpcode::WordBoundary: {
+            bool prevIsWordchar = pos && inst.m_characterClass->test(m_input[pos - 1]);
+            bool readIsWordchar = pos < m_length && inst.m_characterClass->test(m_input[pos]);
+            matched = (prevIsWordchar != readIsWordchar) != inst.m_flag;
+            pc = inst.m_next;
+            break;
+        }
+        case MatcherOpcode::Disjunction:
+            pushResume(BacktrackEntry::ResumeAlternative, pc, pos, 1);
+            pc = m_program.m_alternatives[inst.m_index];
+            break;
+        case MatcherOpcode::BeginCapture:
+            setSlot(m_groupStarts + inst.m_index, pos);
+            pc = inst.m_next;
+            break;
+        case MatcherOpcode::EndCapture: {
+            unsigned* output = m_output + (inst.m_index << 1);
+            setSlot(output, m_groupStarts[inst.m_index]);
+            setSlot(output + 1, pos);
+            pc = inst.m_next;
+            break;
+        }
+        case MatcherOpcode::Loop:
+            setSlot(m_loopCounts + inst.m_index, 0);
+            setSlot(m_loopStarts + inst.m_index, pos);
+            matched = enterLoop(inst, pc, pos, pc);
+            break;
+        case MatcherOpcode::LoopBack: {
+            // like RepeatMatcher of the spec, an empty iteration beyond the minimum count fails
+            const MatcherInstruction& loop = instructions[inst.m_body];
+            if (pos == m_loopStarts[loop.m_index] && m_loopCounts[loop.m_index] > loop.m_min) {
+                matched = false;
+                break;
+            }
+            matched = enterLoop(loop, inst.m_body, pos, pc);
+            break;
+        }
+        case MatcherOpcode::Accept:
+            m_matchEnd = pos;
+            m_stack.clear();
+            return true;
+        }
+
+        if (!matched && !backtrack(pc, pos)) {
+            return false;
+        }
+    }
+}
+
+// decides between another iteration and the exit of the loop
+template <typename CharType>
+bool MatchState<CharType>::enterLoop(const MatcherInstruction& loop, unsigned loopPc, unsigned pos, unsigned& pc)
+{
+    unsigned count = m_loopCounts[loop.m_index];
+    if (count < loop.m_min) {
+        return iterate(loop, pos, pc);
+    }
+
+    if (count >= loop.m_max) {
+        pc = loop.m_next;
+        return true;
+    }
+
+    if (loop.m_flag) {
+        pushResume(BacktrackEntry::ResumeAt, loop.m_next, pos, 0);
+        return iterate(loop, pos, pc);
+    }
+
+    pushResume(BacktrackEntry::ResumeLoopIteration, loopPc, pos, 0);
+    pc = loop.m_next;
+    return true;
+}
+
+// like RepeatMatcher of the spec, captures of the body are cleared before each iteration
+template <typename CharType>
+bool MatchState<CharType>::iterate(const MatcherInstruction& loop, unsigned pos, unsigned& pc)
+{
+    if (!consumeStep()) {
+        return false;
+    }
+
+    setSlot(m_loopCounts + loop.m_index, m_loopCounts[loop.m_index] + 1);
+    setSlot(m_loopStarts + loop.m_index, pos);
+    for (unsigned i = loop.m_firstCapture; i <= loop.m_lastCapture; i++) {
+        setSlot(m_output + (i << 1), offsetNoMatch);
+        setSlot(m_output + (i << 1) + 1, offsetNoMatch);
+    }
+    pc = loop.m_body;
+    return true;
+}
+
+template <typename CharType>
+bool MatchState<CharType>::backtrack(unsigned& pc, unsigned& pos)
+{
+    while (!m_stack.empty()) {
+        BacktrackEntry& entry = m_stack.back();
+        if (entry.m_type == BacktrackEntry::RestoreSlot) {
+            *entry.m_slot = entry.m_value;
+            m_stack.pop_back();
+            continue;
+        }
+
+        if (UNLIKELY(m_failed || !consumeStep())) {
+            // slots are still restored, so output is left clean
+            m_stack.pop_back();
+            continue;
+        }
+
+        const MatcherInstruction& inst = m_program.m_instructions[entry.m_pc];
+        switch (entry.m_type) {
+        case BacktrackEntry::ResumeAlternative: {
+            unsigned alternative = entry.m_value++;
+            pos = entry.m_pos;
+            pc = m_program.m_alternatives[inst.m_index + alternative];
+            if (entry.m_value == inst.m_count) {
+                m_stack.pop_back();
+            }
+            return true;
+        }
+        case BacktrackEntry::ResumeGreedyRepeat: {
+            unsigned count = --entry.m_value;
+            pos = entry.m_pos + count;
+            pc = inst.m_next;
+            if (count == inst.m_min) {
+                m_stack.pop_back();
+            }
+            return true;
+        }
+        case BacktrackEntry::ResumeNonGreedyRepeat: {
+            unsigned start = entry.m_pos;
+            unsigned count = entry.m_value;
+            if (!inst.testAtom(m_input[start + count])) {
+                m_stack.pop_back();
+                continue;
+            }
+            count = ++entry.m_value;
+            pos = start + count;
+            pc = inst.m_next;
+            if (count == std::min(inst.m_max, m_length - start)) {
+                m_stack.pop_back();
+            }
+            return true;
+        }
+        case BacktrackEntry::ResumeAt:
+            pos = entry.m_pos;
+            pc = entry.m_pc;
+            m_stack.pop_back();
+            return true;
+        case BacktrackEntry::ResumeLoopIteration:
+            pos = entry.m_pos;
+            m_stack.pop_back();
+            if (iterate(inst, pos, pc)) {
+                return true;
+            }
+            continue;
+        case BacktrackEntry::RestoreSlot:
+            break;
+        }
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+    return false;
+}
+
+typedef std::map<std::pair<const CharacterClass*, bool>, CharacterClassMatcher*> CharacterClassMatcherMap;
+
+class MatcherCompiler {
+public:
+    MatcherCompiler(YarrPattern& pattern, CompiledMatcher* matcher)
+        : m_pattern(pattern)
+        , m_matcher(matcher)
+        , m_program(*matcher->m_program)
+        , m_failed(false)
+        , m_numLoops(0)
+    {
+    }
+
+    bool compile()
+    {
+        unsigned accept = create(MatcherOpcode::Accept, noInstruction);
+        PatternDisjunction* body = m_pattern.m_body;
+
+        std::vector<unsigned> alternatives;
+        std::vector<unsigned> loopAlternatives;
+        for (size_t i = 0; i < body->m_alternatives.size(); i++) {
+            unsigned alternative = compileAlternative(body->m_alternatives[i].get(), accept);
+            alternatives.push_back(alternative);
+            if (!body->m_alternatives[i]->onceThrough()) {
+                loopAlternatives.push_back(alternative);
+            }
+        }
+
+        if (m_failed || !m_stackCheck.isSafeToRecurse()) {
+            return false;
+        }
+
+        bool hasOnceThrough = alternatives.size() != loopAlternatives.size();
+        m_matcher->m_roots[0] = createDisjunction(alternatives);
+        m_matcher->m_roots[1] = hasOnceThrough ? (loopAlternatives.size() ? createDisjunction(loopAlternatives) : noInstruction) : m_matcher->m_roots[0];
+        m_matcher->m_numLoops = m_numLoops;
+        return true;
+    }
+
+private:
+    unsigned create(MatcherOpcode opcode, unsigned next)
+    {
+        m_program.m_instructions.push_back(MatcherInstruction(opcode, next));
+        return m_program.m_instructions.size() - 1;
+    }
+
+    MatcherInstruction& instruction(unsigned pc)
+    {
+        return m_program.m_instructions[pc];
+    }
+
+    unsigned createDisjunction(const std::vector<unsigned>& alternatives)
+    {
+        if (alternatives.size() == 1) {
+            return alternatives[0];
+        }
+        unsigned pc = create(MatcherOpcode::Disjunction, noInstruction);
+        instruction(pc).m_index = m_program.m_alternatives.size();
+        instruction(pc).m_count = alternatives.size();
+        m_program.m_alternatives.insert(m_program.m_alternatives.end(), alternatives.begin(), alternatives.end());
+        return pc;
+    }
+
+    unsigned createAssertion(MatcherOpcode opcode, unsigned next, const CharacterClassMatcher* characterClass, bool flag)
+    {
+        unsigned pc = create(opcode, next);
+        instruction(pc).m_characterClass = characterClass;
+        instruction(pc).m_flag = flag;
+        return pc;
+    }
+
+    CharacterClassMatcher* characterClassMatcher(const CharacterClass* characterClass, bool invert)
+    {
+        auto key = std::make_pair(characterClass, invert);
+        auto iter = m_characterClasses.find(key);
+        if (iter != m_characterClasses.end()) {
+            return iter->second;
+        }
+        CharacterClassMatcher* result = new CharacterClassMatcher(characterClass, invert);
+        m_program.m_characterClasses.push_back(std::unique_ptr<CharacterClassMatcher>(result));
+        m_characterClasses.insert(std::make_pair(key, result));
+        return result;
+    }
+
+    unsigned compileDisjunction(PatternDisjunction* disjunction, unsigned next)
+    {
+        std::vector<unsigned> alternatives;
+        for (size_t i = 0; i < disjunction->m_alternatives.size(); i++) {
+            alternatives.push_back(compileAlternative(disjunction->m_alternatives[i].get(), next));
+        }
+        return createDisjunction(alternatives);
+    }
+
+    // terms are compiled from the last one so that each instruction knows its continuation
+    unsigned compileAlternative(PatternAlternative* alternative, unsigned next)
+    {
+        if (alternative->matchDirection() != Forward || !m_stackCheck.isSafeToRecurse()) {
+            m_failed = true;
+            return next;
+        }
+
+        Vector<PatternTerm>& terms = alternative->m_terms;
+        size_t index = terms.size();
+        while (index && !m_failed) {
+            if (isSingleCharacter(terms[index - 1])) {
+                size_t end = index;
+                while (index && isSingleCharacter(terms[index - 1])) {
+                    index--;
+                }
+                unsigned pc = create(MatcherOpcode::Literal, next);
+                instruction(pc).m_index = m_program.m_characters.size();
+                instruction(pc).m_count = end - index;
+                for (size_t i = index; i < end; i++) {
+                    m_program.m_characters.push_back(characterAtom(terms[i].patternCharacter));
+                }
+                next = pc;
+            } else {
+                next = compileTerm(terms[index - 1], next);
+                index--;
+            }
+        }
+        return next;
+    }
+
+    static bool isSingleCharacter(PatternTerm& term)
+    {
+        return term.type == PatternTerm::Type::PatternCharacter && term.quantityType == QuantifierType::FixedCount && term.quantityMaxCount.unsafeGet() == 1;
+    }
+
+    // same case folding as ByteCompiler::atomPatternCharacter
+    CharacterAtom characterAtom(char32_t ch)
+    {
+        if (!m_pattern.ignoreCase()) {
+            return CharacterAtom(ch, ch);
+        }
+#if defined(ENABLE_ICU)
+        if (ch < 128) {
+            return CharacterAtom(tolower(ch), toupper(ch));
+        }
+        if (u_getIntPropertyValue(ch, UProperty::UCHAR_ALPHABETIC)) {
+            return CharacterAtom(ch, ch);
+        }
+        return CharacterAtom(u_tolower(ch), u_toupper(ch));
+#else
+        return CharacterAtom(tolower(ch), toupper(ch));
+#endif
+    }
+
+    unsigned compileAtom(PatternTerm& term, CharacterAtom atom, const CharacterClassMatcher* characterClass, unsigned next)
+    {
+        MatcherOpcode opcode = MatcherOpcode::FixedRepeat;
+        switch (term.quantityType) {
+        case QuantifierType::FixedCount:
+            break;
+        case QuantifierType::Greedy:
+            opcode = MatcherOpcode::GreedyRepeat;
+            break;
+        case QuantifierType::NonGreedy:
+            opcode = MatcherOpcode::NonGreedyRepeat;
+            break;
+        }
+
+        unsigned pc = create(opcode, next);
+        MatcherInstruction& inst = instruction(pc);
+        inst.m_atom = atom;
+        inst.m_characterClass = characterClass;
+        inst.m_min = term.quantityMinCount.unsafeGet();
+        inst.m_max = term.quantityMaxCount.unsafeGet();
+        inst.m_count = inst.m_max;
+        return pc;
+    }
+
+    unsigned compileParentheses(PatternTerm& term, unsigned next)
+    {
+        unsigned subpatternId = term.parentheses.subpatternId;
+        bool capture = term.capture();
+
+        if (term.quantityType == QuantifierType::FixedCount && term.quantityMaxCount.unsafeGet() == 1) {
+            unsigned tail = next;
+            if (capture) {
+                tail = create(MatcherOpcode::EndCapture, next);
+                instruction(tail).m_index = subpatternId;
+            }
+            unsigned body = compileDisjunction(term.parentheses.disjunction, tail);
+            if (capture) {
+                body = create(MatcherOpcode::BeginCapture, body);
+                instruction(body).m_index = subpatternId;
+            }
+            return body;
+        }
+
+        unsigned loop = create(MatcherOpcode::Loop, next);
+        instruction(loop).m_index = m_numLoops++;
+        instruction(loop).m_min = term.quantityMinCount.unsafeGet();
+        instruction(loop).m_max = term.quantityMaxCount.unsafeGet();
+        instruction(loop).m_flag = term.quantityType != QuantifierType::NonGreedy;
+        if (term.containsAnyCaptures()) {
+            instruction(loop).m_firstCapture = subpatternId;
+            instruction(loop).m_lastCapture = term.parentheses.lastSubpatternId;
+        }
+
+        unsigned tail = create(MatcherOpcode::LoopBack, noInstruction);
+        instruction(tail).m_body = loop;
+        if (capture) {
+            tail = create(MatcherOpcode::EndCapture, tail);
+            instruction(tail).m_index = subpatternId;
+        }
+        unsigned body = compileDisjunction(term.parentheses.disjunction, tail);
+        if (capture) {
+            body = create(MatcherOpcode::BeginCapture, body);
+            instruction(body).m_index = subpatternId;
+        }
+        instruction(loop).m_body = body;
+        return loop;
+    }
+
+    unsigned compileTerm(PatternTerm& term, unsigned next)
+    {
+        if (term.matchDirection() != Forward) {
+            m_failed = true;
+            return next;
+        }
+
+        switch (term.type) {
+        case PatternTerm::Type::AssertionBOL:
+            return createAssertion(MatcherOpcode::BOL, next, characterClassMatcher(m_pattern.newlineCharacterClass(), false), m_pattern.multiline());
+        case PatternTerm::Type::AssertionEOL:
+            return createAssertion(MatcherOpcode::EOL, next, characterClassMatcher(m_pattern.newlineCharacterClass(), false), m_pattern.multiline());
+        case PatternTerm::Type::AssertionWordBoundary:
+            return createAssertion(MatcherOpcode::WordBoundary, next, characterClassMatcher(m_pattern.wordcharCharacterClass(), false), term.invert());
+        case PatternTerm::Type::PatternCharacter:
+            return compileAtom(term, characterAtom(term.patternCharacter), nullptr, next);
+        case PatternTerm::Type::CharacterClass:
+            if (term.characterClass->hasStrings()) {
+                break;
+            }
+            return compileAtom(term, CharacterAtom(), characterClassMatcher(term.characterClass, term.invert()), next);
+        case PatternTerm::Type::ParenthesesSubpattern:
+            return compileParentheses(term, next);
+        case PatternTerm::Type::BackReference:
+        case PatternTerm::Type::ForwardReference:
+        case PatternTerm::Type::ParentheticalAssertion:
+        case PatternTerm::Type::DotStarEnclosure:
+            break;
+        }
+
+        m_failed = true;
+        return next;
+    }
+
+    YarrPattern& m_pattern;
+    CompiledMatcher* m_matcher;
+    MatcherProgram& m_program;
+    CharacterClassMatcherMap m_characterClasses;
+    StackCheck m_stackCheck;
+    bool m_failed;
+    unsigned m_numLoops;
+};
+
+CompiledMatcher::CompiledMatcher(YarrPattern& pattern)
+    : m_program(new MatcherProgram())
+    , m_numSubpatterns(pattern.m_numSubpatterns)
+    , m_numLoops(0)
+    , m_minimumSize(pattern.m_body->m_minimumSize)
+    , m_sticky(pattern.sticky())
+    , m_prefilter(pattern.m_prefilter)
+{
+    m_roots[0] = m_roots[1] = noInstruction;
+
+    GC_REGISTER_FINALIZER_NO_ORDER(
+        this, [](void* obj, void*) {
+            CompiledMatcher* self = static_cast<CompiledMatcher*>(obj);
+            self->~CompiledMatcher();
+        },
+        nullptr, nullptr, nullptr);
+}
+
+CompiledMatcher::~CompiledMatcher()
+{
+}
+
+size_t CompiledMatcher::estimatedSizeInBytes() const
+{
+    size_t size = sizeof(CompiledMatcher) + sizeof(MatcherProgram);
+    size += m_program->m_instructions.capacity() * sizeof(MatcherInstruction);
+    size += m_program->m_alternatives.capacity() * sizeof(unsigned);
+    size += m_program->m_characters.capacity() * sizeof(CharacterAtom);
+    for (size_t i = 0; i < m_program->m_characterClasses.size(); i++) {
+        size += m_program->m_characterClasses[i]->estimatedSizeInBytes();
+    }
+    return size;
+}
+
+CompiledMatcher* CompiledMatcher::compile(YarrPattern& pattern)
+{
+    // unicode patterns read surrogate pairs and case fold with canonicalization tables
+    // backreferences and lookaround need the interpreter
+    if (pattern.eitherUnicode() || pattern.m_containsBackreferences || pattern.m_containsLookbehinds
+        || pattern.hasDuplicateNamedCaptureGroups() || pattern.m_containsUnsignedLengthPattern) {
+        return nullptr;
+    }
+
+    CompiledMatcher* matcher = new CompiledMatcher(pattern);
+    if (!MatcherCompiler(pattern, matcher).compile()) {
+        return nullptr;
+    }
+    return matcher;
+}
+
+template <typename CharType>
+JSRegExpResult CompiledMatcher::matchImpl(const CharType* input, unsigned length, unsigned start, unsigned* output)
+{
+    for (unsigned i = 0; i < (m_numSubpatterns + 1) * 2; i++) {
+        output[i] = offsetNoMatch;
+    }
+    if (start > length) {
+        return JSRegExpResult::NoMatch;
+    }
+
+    // group starts, loop counts and loop starts
+    const size_t inlineScratchSize = 32;
+    size_t scratchSize = m_numSubpatterns + 1 + m_numLoops * 2;
+    unsigned inlineScratch[inlineScratchSize];
+    std::unique_ptr<unsigned[]> heapScratch;
+    unsigned* scratch = inlineScratch;
+    if (UNLIKELY(scratchSize > inlineScratchSize)) {
+        heapScratch.reset(new unsigned[scratchSize]);
+        scratch = heapScratch.get();
+    }
+    memset(scratch, 0, sizeof(unsigned) * scratchSize);
+
+    unsigned* loopCounts = scratch + m_numSubpatterns + 1;
+    MatchState<CharType> state(*m_program, input, length, output, scratch, loopCounts, loopCounts + m_numLoops);
+
+    unsigned root = m_roots[0];
+    unsigned pos = start;
+    while (true) {
+        unsigned candidate = m_prefilter.nextCandidate(input, length, pos);
+        if (candidate == offsetNoMatch || (m_sticky && candidate != start) || length - candidate < m_minimumSize) {
+            break;
+        }
+        pos = candidate;
+        state.resetBudget();
+        if (state.run(root, pos)) {
+            output[0] = pos;
+            output[1] = state.matchEnd();
+            return JSRegExpResult::Match;
+        }
+        if (UNLIKELY(state.failed())) {
+            return JSRegExpResult::JITCodeFailure;
+        }
+        root = m_roots[1];
+        if (m_sticky || root == noInstruction || pos == length) {
+            break;
+        }
+        pos++;
+    }
+    return JSRegExpResult::NoMatch;
+}
+
+JSRegExpResult CompiledMatcher::match(const LChar* input, unsigned length, unsigned start, unsigned* output)
+{
+    return matchImpl(input, length, start, output);
+}
+
+JSRegExpResult CompiledMatcher::match(const UChar* input, unsigned length, unsigned start, unsigned* output)
+{
+    return matchImpl(input, length, start, output);
+}
+
+} } // namespace JSC::Yarr
+
+#endif // ENABLE_REGEXP_COMPILED_MATCHER || ESCARGOT_ENABLE_TEST
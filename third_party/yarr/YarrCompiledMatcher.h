@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ */
+
+#pragma once
+
+#include "Yarr.h"
+#include "YarrPattern.h"
+
+namespace JSC { namespace Yarr {
+
+struct MatcherProgram;
+class MatcherCompiler;
+
+// CompiledMatcher is the compiled backend of Yarr
+// A common subset of patterns is translated into a flat program of specialized instructions
+// which runs with an explicit backtracking stack, so matching runs without the bytecode dispatch,
+// the context allocations and the native recursion of the interpreter
+// Unsupported patterns are not compiled, and a match which runs out of step budget at a start position
+// or of backtracking entries returns JSRegExpResult::JITCodeFailure so that the caller can retry with the interpreter
+struct CompiledMatcher : public gc {
+    // returns nullptr when the pattern uses constructs that are not supported
+    static CompiledMatcher* compile(YarrPattern& pattern);
+
+    JSRegExpResult match(const LChar* input, unsigned length, unsigned start, unsigned* output);
+    JSRegExpResult match(const UChar* input, unsigned length, unsigned start, unsigned* output);
+
+    unsigned numSubpatterns() const
+    {
+        return m_numSubpatterns;
+    }
+
+    size_t estimatedSizeInBytes() const;
+
+private:
+    CompiledMatcher(YarrPattern& pattern);
+    ~CompiledMatcher();
+
+    template <typename CharType>
+    JSRegExpResult matchImpl(const CharType* input, unsigned length, unsigned start, unsigned* output);
+
+    friend class MatcherCompiler;
+
+    // one program serves both 8-bit and 16-bit inputs
+    std::unique_ptr<MatcherProgram> m_program;
+    // roots[0] runs at the start position, roots[1] at the following positions
+    // they differ when Yarr unrolled alternatives beginning with BOL into once through alternatives
+    unsigned m_roots[2];
+    unsigned m_numSubpatterns;
+    unsigned m_numLoops;
+    unsigned m_minimumSize;
+    bool m_sticky;
+    Prefilter m_prefilter;
+};
+
+} } // namespace JSC::Yarr
@@ -333,6 +333,11 @@ public:
             return pos;
         }
 
+        const CharType* characters()
+        {
+            return input;
+        }
+
         void setPos(unsigned p)
         {
             pos = p;
@@ -1954,6 +1959,11 @@ public:
 
             input.next();
 
+            if (!skipToCandidate()) {
+                DUMP_EXTRA("- Return NoMatch\n");
+                return JSRegExpResult::NoMatch;
+            }
+
             context->matchBegin = input.getPos();
 
             if (currentTerm().alternative.onceThrough)
@@ -2094,6 +2104,9 @@ public:
         for (unsigned i = pattern->m_offsetVectorBaseForNamedCaptures; i < pattern->m_offsetsSize; ++i)
             output[i] = 0;
 
+        if (!skipToCandidate())
+            return offsetNoMatch;
+
         allocatorPool = pattern->m_allocator->startAllocator();
         RELEASE_ASSERT(allocatorPool);
 
@@ -2134,6 +2147,18 @@ private:
 
     inline bool isSafeToRecurse() { return m_stackCheck.isSafeToRecurse(); }
 
+    // moves input to the next position where the prefilter allows a match
+    // a sticky pattern can not move from its start position
+    bool skipToCandidate()
+    {
+        unsigned pos = input.getPos();
+        unsigned candidate = pattern->m_prefilter.nextCandidate(input.characters(), input.end(), pos);
+        if (candidate == offsetNoMatch || (candidate != pos && pattern->sticky()))
+            return false;
+        input.setPos(candidate);
+        return true;
+    }
+
     BytecodePattern* pattern;
     CompileMode compileMode;
     unsigned* output;
@@ -461,6 +461,7 @@ public:
         , m_offsetVectorBaseForNamedCaptures(offsetVectorBaseForNamedCaptures)
         , m_offsetsSize(offsetsSize)
         , m_duplicateNamedGroupForSubpatternId(pattern.m_duplicateNamedGroupForSubpatternId)
+        , m_prefilter(pattern.m_prefilter)
     {
         m_body->terms.shrinkToFit();
 
@@ -526,6 +527,7 @@ public:
     unsigned m_offsetVectorBaseForNamedCaptures;
     unsigned m_offsetsSize;
     Vector<unsigned> m_duplicateNamedGroupForSubpatternId;
+    Prefilter m_prefilter;
 
     CharacterClass* newlineCharacterClass;
     CharacterClass* wordcharCharacterClass;
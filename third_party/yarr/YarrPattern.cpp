@@ -2089,6 +2089,8 @@ ErrorCode YarrPattern::compile(StringView patternString)
 
     constructor.setupNamedCaptures();
 
+    m_prefilter = Prefilter(*this);
+
     return ErrorCode::NoError;
 }
 
@@ -2113,6 +2115,23 @@ YarrPattern::YarrPattern(StringView pattern, OptionSet<Flags> flags, ErrorCode&
         nullptr, nullptr, nullptr);
 }
 
+size_t YarrPattern::estimatedSizeInBytes() const
+{
+    size_t size = sizeof(YarrPattern);
+    for (auto& disjunction : m_disjunctions) {
+        size += sizeof(PatternDisjunction);
+        for (auto& alternative : disjunction->m_alternatives) {
+            size += sizeof(PatternAlternative) + alternative->m_terms.capacity() * sizeof(PatternTerm);
+        }
+    }
+    // the character classes move to the BytecodePattern once it is compiled
+    for (auto& characterClass : m_userCharacterClasses) {
+        size += sizeof(CharacterClass) + (characterClass->m_matches.capacity() + characterClass->m_matchesUnicode.capacity()) * sizeof(char32_t)
+            + (characterClass->m_ranges.capacity() + characterClass->m_rangesUnicode.capacity()) * sizeof(CharacterRange);
+    }
+    return size;
+}
+
 std::unique_ptr<CharacterClass> anycharCreate()
 {
     auto characterClass = makeUnique<CharacterClass>();
@@ -28,6 +28,7 @@
 
 #include "YarrErrorCode.h"
 #include "YarrFlags.h"
+#include "YarrPrefilter.h"
 #include "YarrUnicodeProperties.h"
 #include "CheckedArithmetic.h"
 
@@ -535,6 +536,8 @@ struct YarrPattern : public gc {
         return m_containsUnsignedLengthPattern;
     }
 
+    size_t estimatedSizeInBytes() const;
+
     CharacterClass* anyCharacterClass()
     {
         if (!anycharCached) {
@@ -693,6 +696,7 @@ struct YarrPattern : public gc {
     // duplicateNamedGroupId. Subsequent vector entries are the subpatternId's for that duplicateNamedGroupId.
     HashMap<String, Vector<unsigned>> m_namedGroupToParenIndices;
     Vector<unsigned> m_duplicateNamedGroupForSubpatternId;
+    Prefilter m_prefilter;
 
     void* operator new(size_t size)
     {
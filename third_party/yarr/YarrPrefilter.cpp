@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "WTFBridge.h"
+#include "YarrPrefilter.h"
+#include "YarrPattern.h"
+
+namespace JSC { namespace Yarr {
+
+// longer literal prefixes do not make the search faster
+static constexpr size_t maximumPrefixLength = 64;
+
+class PrefilterBuilder {
+public:
+    enum class FirstCharacterResult {
+        Consuming, // the terms always consume a character which is added to the set
+        MayBeEmpty, // the terms can match without consuming any character
+        Unknown,
+    };
+
+    PrefilterBuilder(YarrPattern& pattern, Prefilter& prefilter)
+        : m_pattern(pattern)
+        , m_prefilter(prefilter)
+    {
+    }
+
+    void build()
+    {
+        PatternDisjunction* body = m_pattern.m_body;
+        if (!body || !body->m_alternatives.size()) {
+            return;
+        }
+
+        if (isAnchored(body)) {
+            m_prefilter.m_type = Prefilter::Type::Anchored;
+            return;
+        }
+
+        if (!m_pattern.ignoreCase()) {
+            std::vector<char16_t> prefix;
+            for (size_t i = 0; i < body->m_alternatives.size(); i++) {
+                std::vector<char16_t> alternativePrefix;
+                appendLiteralPrefix(body->m_alternatives[i].get(), alternativePrefix);
+                if (!i) {
+                    prefix = std::move(alternativePrefix);
+                } else {
+                    size_t common = 0;
+                    while (common < prefix.size() && common < alternativePrefix.size() && prefix[common] == alternativePrefix[common]) {
+                        common++;
+                    }
+                    prefix.resize(common);
+                }
+                if (prefix.empty()) {
+                    break;
+                }
+            }
+            if (prefix.size()) {
+                m_prefilter.m_type = Prefilter::Type::LiteralPrefix;
+                m_prefilter.m_prefix = std::move(prefix);
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < body->m_alternatives.size(); i++) {
+            if (addFirstCharacters(body->m_alternatives[i].get()) != FirstCharacterResult::Consuming) {
+                return;
+            }
+        }
+        m_prefilter.m_type = Prefilter::Type::FirstCharacter;
+    }
+
+private:
+    // a dot star enclosure moves the beginning of a match back to the line start
+    bool isAnchored(PatternDisjunction* body)
+    {
+        if (m_pattern.multiline() || m_pattern.m_saveInitialStartValue) {
+            return false;
+        }
+        for (size_t i = 0; i < body->m_alternatives.size(); i++) {
+            Vector<PatternTerm>& terms = body->m_alternatives[i]->m_terms;
+            if (!terms.size() || terms[0].type != PatternTerm::Type::AssertionBOL) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // returns true when every term of the alternative is a part of the prefix
+    bool appendLiteralPrefix(PatternAlternative* alternative, std::vector<char16_t>& prefix)
+    {
+        for (size_t i = 0; i < alternative->m_terms.size(); i++) {
+            PatternTerm& term = alternative->m_terms[i];
+            if (term.matchDirection() != Forward || prefix.size() >= maximumPrefixLength) {
+                return false;
+            }
+
+            switch (term.type) {
+            case PatternTerm::Type::AssertionBOL:
+            case PatternTerm::Type::AssertionEOL:
+            case PatternTerm::Type::AssertionWordBoundary:
+                break;
+            case PatternTerm::Type::PatternCharacter: {
+                if (term.quantityType != QuantifierType::FixedCount || term.patternCharacter > 0xFFFF) {
+                    return false;
+                }
+                size_t count = std::min<size_t>(term.quantityMaxCount.unsafeGet(), maximumPrefixLength - prefix.size());
+                prefix.insert(prefix.end(), count, static_cast<char16_t>(term.patternCharacter));
+                break;
+            }
+            case PatternTerm::Type::ParenthesesSubpattern:
+                if (term.quantityType != QuantifierType::FixedCount || term.quantityMaxCount.unsafeGet() != 1
+                    || term.parentheses.disjunction->m_alternatives.size() != 1) {
+                    return false;
+                }
+                if (!appendLiteralPrefix(term.parentheses.disjunction->m_alternatives[0].get(), prefix)) {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+
+    FirstCharacterResult addFirstCharacters(PatternDisjunction* disjunction)
+    {
+        FirstCharacterResult result = FirstCharacterResult::Consuming;
+        for (size_t i = 0; i < disjunction->m_alternatives.size(); i++) {
+            FirstCharacterResult alternativeResult = addFirstCharacters(disjunction->m_alternatives[i].get());
+            if (alternativeResult == FirstCharacterResult::Unknown) {
+                return alternativeResult;
+            }
+            if (alternativeResult == FirstCharacterResult::MayBeEmpty) {
+                result = alternativeResult;
+            }
+        }
+        return result;
+    }
+
+    FirstCharacterResult addFirstCharacters(PatternAlternative* alternative)
+    {
+        if (!m_stackCheck.isSafeToRecurse()) {
+            return FirstCharacterResult::Unknown;
+        }
+
+        for (size_t i = 0; i < alternative->m_terms.size(); i++) {
+            PatternTerm& term = alternative->m_terms[i];
+            if (term.matchDirection() != Forward) {
+                return FirstCharacterResult::Unknown;
+            }
+
+            bool consuming = term.quantityMinCount.unsafeGet() > 0;
+            switch (term.type) {
+            case PatternTerm::Type::AssertionBOL:
+            case PatternTerm::Type::AssertionEOL:
+            case PatternTerm::Type::AssertionWordBoundary:
+            case PatternTerm::Type::ParentheticalAssertion:
+                // zero width terms do not change where the match begins
+                consuming = false;
+                break;
+            case PatternTerm::Type::PatternCharacter:
+                addPatternCharacter(term.patternCharacter);
+                break;
+            case PatternTerm::Type::CharacterClass:
+                if (term.characterClass->hasStrings()) {
+                    return FirstCharacterResult::Unknown;
+                }
+                addCharacterClass(term.characterClass, term.invert());
+                break;
+            case PatternTerm::Type::ParenthesesSubpattern: {
+                FirstCharacterResult result = addFirstCharacters(term.parentheses.disjunction);
+                if (result == FirstCharacterResult::Unknown) {
+                    return result;
+                }
+                consuming = consuming && result == FirstCharacterResult::Consuming;
+                break;
+            }
+            default:
+                return FirstCharacterResult::Unknown;
+            }
+
+            if (consuming) {
+                return FirstCharacterResult::Consuming;
+            }
+        }
+        return FirstCharacterResult::MayBeEmpty;
+    }
+
+    void addCharacter(char32_t ch)
+    {
+        if (ch < 256) {
+            m_prefilter.m_firstCharacters[ch >> 5] |= 1u << (ch & 31);
+        } else {
+            // characters out of BMP begin with a lead surrogate
+            m_prefilter.m_nonLatin1FirstCharacter = true;
+        }
+    }
+
+    // covers the case folding of ByteCompiler::atomPatternCharacter
+    void addPatternCharacter(char32_t ch)
+    {
+        addCharacter(ch);
+        if (!m_pattern.ignoreCase()) {
+            return;
+        }
+#if defined(ENABLE_ICU)
+        if (ch >= 128) {
+            addCharacter(u_tolower(ch));
+            addCharacter(u_toupper(ch));
+            return;
+        }
+#endif
+        addCharacter(tolower(ch));
+        addCharacter(toupper(ch));
+    }
+
+    void addCharacterClass(const CharacterClass* characterClass, bool invert)
+    {
+        if (invert || characterClass->m_anyCharacter || characterClass->m_matchesUnicode.size() || characterClass->m_rangesUnicode.size()) {
+            m_prefilter.m_nonLatin1FirstCharacter = true;
+        }
+        for (char32_t ch = 0; ch < 256; ch++) {
+            if (containsCharacter(characterClass, ch) != invert) {
+                addCharacter(ch);
+            }
+        }
+    }
+
+    // same rule as Interpreter::testCharacterClass
+    static bool containsCharacter(const CharacterClass* characterClass, char32_t ch)
+    {
+        if (characterClass->m_anyCharacter) {
+            return true;
+        }
+
+        const Vector<char32_t>& matches = isASCII(ch) ? characterClass->m_matches : characterClass->m_matchesUnicode;
+        const Vector<CharacterRange>& ranges = isASCII(ch) ? characterClass->m_ranges : characterClass->m_rangesUnicode;
+        for (size_t i = 0; i < matches.size(); i++) {
+            if (matches[i] == ch) {
+                return true;
+            }
+        }
+        for (size_t i = 0; i < ranges.size(); i++) {
+            if (ch >= ranges[i].begin && ch <= ranges[i].end) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    YarrPattern& m_pattern;
+    Prefilter& m_prefilter;
+    StackCheck m_stackCheck;
+};
+
+Prefilter::Prefilter(YarrPattern& pattern)
+    : Prefilter()
+{
+    PrefilterBuilder(pattern, *this).build();
+}
+
+} } // namespace JSC::Yarr
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ */
+
+#pragma once
+
+#include "Yarr.h"
+
+namespace JSC { namespace Yarr {
+
+struct YarrPattern;
+
+// Prefilter finds the positions of input where a match can start
+// It is computed once from a YarrPattern, and the interpreter and the compiled matcher
+// use it to skip the other positions instead of running a match attempt at every offset
+class Prefilter {
+public:
+    enum class Type : uint8_t {
+        None, // every position can start a match
+        Anchored, // only the beginning of input can start a match
+        LiteralPrefix, // every match begins with m_prefix
+        FirstCharacter, // every match begins with a character in m_firstCharacters
+    };
+
+    Prefilter()
+        : m_type(Type::None)
+        , m_nonLatin1FirstCharacter(false)
+    {
+        memset(m_firstCharacters, 0, sizeof(m_firstCharacters));
+    }
+
+    explicit Prefilter(YarrPattern& pattern);
+
+    Type type() const
+    {
+        return m_type;
+    }
+
+    const std::vector<char16_t>& prefix() const
+    {
+        return m_prefix;
+    }
+
+    // returns the first candidate position which is not less than pos or offsetNoMatch
+    template <typename CharType>
+    unsigned nextCandidate(const CharType* input, unsigned length, unsigned pos) const
+    {
+        switch (m_type) {
+        case Type::None:
+            return pos;
+        case Type::Anchored:
+            return pos ? offsetNoMatch : pos;
+        case Type::LiteralPrefix: {
+            size_t found = Escargot::StringKernels::findSubstring(input, length, m_prefix.data(), m_prefix.size(), pos);
+            return found == SIZE_MAX ? offsetNoMatch : static_cast<unsigned>(found);
+        }
+        case Type::FirstCharacter:
+            for (; pos < length; pos++) {
+                if (isFirstCharacter(input[pos])) {
+                    return pos;
+                }
+            }
+            return offsetNoMatch;
+        }
+        return pos;
+    }
+
+private:
+    ALWAYS_INLINE bool isFirstCharacter(char16_t ch) const
+    {
+        if (ch < 256) {
+            return m_firstCharacters[ch >> 5] & (1u << (ch & 31));
+        }
+        return m_nonLatin1FirstCharacter;
+    }
+
+    friend class PrefilterBuilder;
+
+    Type m_type;
+    bool m_nonLatin1FirstCharacter;
+    uint32_t m_firstCharacters[256 / 32];
+    std::vector<char16_t> m_prefix;
+};
+
+} } // namespace JSC::Yarr
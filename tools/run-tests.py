@@ -158,6 +158,15 @@ def run_octane_loading(engine, arch, extra_arg):
          cwd=OCTANE_DIR)
 
 
+@runner('micro-benchmarks')
+def run_micro_benchmarks(engine, arch, extra_arg):
+    MICRO_BENCHMARKS_DIR = join(PROJECT_SOURCE_DIR, 'tools', 'test', 'micro-benchmarks')
+    harness = join(MICRO_BENCHMARKS_DIR, 'harness.js')
+    for benchmark in sorted(glob(join(MICRO_BENCHMARKS_DIR, '*.js'))):
+        if benchmark != harness:
+            run([engine, harness, benchmark])
+
+
 @runner('modifiedVendorTest', default=True)
 def run_internal_test(engine, arch, extra_arg):
     INTERNAL_OVERRIDE_DIR = join(PROJECT_SOURCE_DIR, 'tools', 'test', 'ModifiedVendorTest')
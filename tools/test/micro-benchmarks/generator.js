@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// yield on top level of generator body resumes without resume code
+// yield inside a block or try statement needs resume code
+// short generators reuse register files of finished ones
+
+function* generatorCount(n) {
+    for (var i = 0; i < n; i++) {
+        yield i;
+    }
+}
+
+function* generatorCountInTry(n) {
+    for (var i = 0; i < n; i++) {
+        try {
+            yield i;
+        } finally {
+            n = n | 0;
+        }
+    }
+}
+
+function* generatorPair(a, b) {
+    yield a;
+    yield b;
+}
+
+benchmark('generator yield', 2000000, function(n) {
+    var sum = 0;
+    for (var v of generatorCount(n)) {
+        sum += v;
+    }
+    return sum;
+});
+
+benchmark('generator yield in try', 2000000, function(n) {
+    var sum = 0;
+    for (var v of generatorCountInTry(n)) {
+        sum += v;
+    }
+    return sum;
+});
+
+benchmark('generator create and finish', 500000, function(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        for (var v of generatorPair(i, 1)) {
+            sum += v;
+        }
+    }
+    return sum;
+});
+
+async function* asyncGeneratorCount(n) {
+    for (var i = 0; i < n; i++) {
+        yield i;
+    }
+}
+
+// async iteration completes through the job queue, so it is measured separately
+(async function() {
+    var n = 200000;
+    var start = Date.now();
+    var sum = 0;
+    for await (var v of asyncGeneratorCount(n)) {
+        sum += v;
+    }
+    print('async generator iteration: ' + (Date.now() - start) + ' ms (' + n + ' iterations, result ' + sum + ')');
+})();
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// common part of micro-benchmarks
+// each benchmark is run as `escargot harness.js <benchmark>.js` (see tools/run-tests.py)
+
+// fn(n) should run the measured operation n times and return a value depending on all of them
+function benchmark(name, iterations, fn) {
+    // warm up bytecode generation and inline caches
+    fn(Math.min(iterations, 1000));
+
+    var start = Date.now();
+    var result = fn(iterations);
+    var elapsed = Date.now() - start;
+    print(name + ': ' + elapsed + ' ms (' + iterations + ' iterations, result ' + result + ')');
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// number to string conversion through StaticStrings::dtoa
+// integers, repeated values hitting the cache, fractions and CSV generation
+
+benchmark('number to string integer', 2000000, function(n) {
+    var length = 0;
+    for (var i = 0; i < n; i++) {
+        length += ('' + (i + 1000)).length;
+    }
+    return length;
+});
+
+benchmark('number to string repeated', 2000000, function(n) {
+    var values = [0.5, 1.25, 3.14159, 2.718281828, 1e21, 1e-7, -42.5, 65536.125];
+    var length = 0;
+    for (var i = 0; i < n; i++) {
+        length += String(values[i & 7]).length;
+    }
+    return length;
+});
+
+benchmark('number to string fraction', 1000000, function(n) {
+    var length = 0;
+    for (var i = 0; i < n; i++) {
+        length += String(i / 7).length;
+    }
+    return length;
+});
+
+benchmark('number to string array index', 1000000, function(n) {
+    var object = {};
+    for (var i = 0; i < n; i++) {
+        object[i % 4096 + 1000] = i;
+    }
+    return Object.keys(object).length;
+});
+
+benchmark('number to string csv', 20000, function(n) {
+    var length = 0;
+    for (var i = 0; i < n; i++) {
+        var row = [];
+        for (var j = 0; j < 10; j++) {
+            row.push(i * 10 + j, (i + j) * 0.01);
+        }
+        length += row.join(',').length;
+    }
+    return length;
+});
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// patterns whose start positions are skipped by Yarr::Prefilter
+// literal prefix, first-character set and anchored, over a log of about 4MB
+
+var regexpLogLines = [];
+for (var i = 0; i < 50000; i++) {
+    regexpLogLines.push(i % 100 == 99 ? 'ERROR: ' + i + ' disk failure on node' : 'INFO: request served in ' + (i % 97) + ' ms by worker pool');
+}
+var regexpLog = regexpLogLines.join('\n');
+
+benchmark('regexp literal prefix', 20, function(n) {
+    var count = 0;
+    for (var i = 0; i < n; i++) {
+        count += regexpLog.match(/ERROR: (\d+)/g).length;
+    }
+    return count;
+});
+
+benchmark('regexp first character', 20, function(n) {
+    var count = 0;
+    for (var i = 0; i < n; i++) {
+        count += regexpLog.match(/[EW](?:RROR|ARN): \d+/g).length;
+    }
+    return count;
+});
+
+benchmark('regexp anchored miss', 200000, function(n) {
+    var count = 0;
+    for (var i = 0; i < n; i++) {
+        count += /^ERROR/.test(regexpLog) ? 1 : 0;
+    }
+    return count;
+});
+
+benchmark('regexp sticky', 2000000, function(n) {
+    var re = /INFO/y;
+    var count = 0;
+    for (var i = 0; i < n; i++) {
+        re.lastIndex = i % 2 ? 0 : 1;
+        count += re.test(regexpLog) ? 1 : 0;
+    }
+    return count;
+});
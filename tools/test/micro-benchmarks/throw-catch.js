@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// throw statement placed directly in a try block leaves its exception pending
+// the others unwind the C++ stack
+
+benchmark('throw-catch direct', 1000000, function(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        try {
+            throw i;
+        } catch (e) {
+            sum += e;
+        }
+    }
+    return sum;
+});
+
+benchmark('throw-catch error object', 200000, function(n) {
+    var count = 0;
+    for (var i = 0; i < n; i++) {
+        try {
+            throw new Error('e');
+        } catch (e) {
+            count += e.message.length;
+        }
+    }
+    return count;
+});
+
+function throwFromCallee(i) {
+    throw i;
+}
+
+benchmark('throw-catch from callee', 1000000, function(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        try {
+            throwFromCallee(i);
+        } catch (e) {
+            sum += e;
+        }
+    }
+    return sum;
+});
+
+benchmark('throw-catch from builtin', 200000, function(n) {
+    var count = 0;
+    for (var i = 0; i < n; i++) {
+        try {
+            null.x;
+        } catch (e) {
+            count++;
+        }
+    }
+    return count;
+});